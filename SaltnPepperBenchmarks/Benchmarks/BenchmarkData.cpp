@@ -0,0 +1,85 @@
+#include "BenchmarkData.hpp"
+#include "Utilities/Math/Random.hpp"
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		namespace
+		{
+			Quaternion RandomRotation(Math::RandomGenerator& random)
+			{
+				const Vector3 axis = random.OnSphere();
+				const float angle = random.Range(-PI, PI);
+
+				Quaternion rotation;
+				XMStoreFloat4(&rotation, XMQuaternionRotationAxis(XMLoadFloat3(&axis), angle));
+				return rotation;
+			}
+		}
+
+		BenchmarkData::BenchmarkData(uint64_t seed)
+		{
+			Math::RandomGenerator random(seed);
+			const size_t count = BENCHMARKELEMENTS;
+
+			auto range = [&random]() { return random.Range(-100.0f, 100.0f); };
+
+			for (size_t index = 0; index < count; ++index)
+			{
+				floatsA.push_back(range());
+				floatsB.push_back(range());
+				weights.push_back(random.NextFloat());
+				angles.push_back(random.Range(-PI, PI));
+				unitFloats.push_back(random.Range(-1.0f, 1.0f));
+
+				vector2A.emplace_back(range(), range());
+				vector2B.emplace_back(range(), range());
+				vector3A.emplace_back(range(), range(), range());
+				vector3B.emplace_back(range(), range(), range());
+				vector4A.emplace_back(range(), range(), range(), range());
+				vector4B.emplace_back(range(), range(), range(), range());
+
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					soaA[axis].push_back(axis == 0 ? vector3A.back().x : axis == 1 ? vector3A.back().y : vector3A.back().z);
+					soaB[axis].push_back(axis == 0 ? vector3B.back().x : axis == 1 ? vector3B.back().y : vector3B.back().z);
+				}
+
+				rotationsA.push_back(RandomRotation(random));
+				rotationsB.push_back(RandomRotation(random));
+
+				const float* rotationA = &rotationsA.back().x;
+				const float* rotationB = &rotationsB.back().x;
+				for (int component = 0; component < 4; ++component)
+				{
+					rotationSoaA[component].push_back(rotationA[component]);
+					rotationSoaB[component].push_back(rotationB[component]);
+				}
+
+				Components::Transform transform;
+				transform.localPosition = vector3A.back();
+				transform.localRotation = rotationsA.back();
+				transform.localScale = Vector3(random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f));
+				transform.UpdateTransform();
+
+				transforms.push_back(transform);
+				matrices.push_back(transform.GetWorldMatrix());
+				affineMatrices.push_back(Math::ToAffine(matrices.back()));
+			}
+
+			floatOutput.resize(count);
+			floatOutputB.resize(count);
+			for (auto& output : soaOutput) { output.resize(count); }
+			vector2Output.resize(count);
+			vector3Output.resize(count);
+			vector4Output.resize(count);
+			rotationOutput.resize(count);
+			matrixOutput.resize(count);
+			affineOutput.resize(count);
+
+			// Wide enough for any packed format / encoded transform stream
+			byteOutput.resize(count * 32);
+		}
+	}
+}
@@ -0,0 +1,134 @@
+#ifndef BENCHMARKDATA_H
+#define BENCHMARKDATA_H
+#include "Utilities/Math/MathDefinitions.hpp"
+#include "Utilities/Profiling/Benchmark.hpp"
+#include "Core/Components/Transform.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		/// <summary>
+		/// Elements every case walks per iteration , small enough that the working set stays in L1 / L2
+		/// so the numbers track the math and not the memory system
+		/// </summary>
+		inline static constexpr size_t BENCHMARKELEMENTS = 1024;
+
+		/// <summary>
+		/// Random inputs (AoS and SoA views of the same values) and output buffers shared by all cases
+		/// </summary>
+		struct BenchmarkData
+		{
+			explicit BenchmarkData(uint64_t seed);
+
+			// Scalars
+			std::vector<float> floatsA;
+			std::vector<float> floatsB;
+			std::vector<float> weights;
+			std::vector<float> angles;
+			std::vector<float> unitFloats;
+
+			// Vectors
+			std::vector<Vector2> vector2A;
+			std::vector<Vector2> vector2B;
+			std::vector<Vector3> vector3A;
+			std::vector<Vector3> vector3B;
+			std::vector<Vector4> vector4A;
+			std::vector<Vector4> vector4B;
+
+			// Vector3A / Vector3B as structure of arrays
+			std::vector<float> soaA[3];
+			std::vector<float> soaB[3];
+
+			// Unit quaternions , AoS and SoA
+			std::vector<Quaternion> rotationsA;
+			std::vector<Quaternion> rotationsB;
+			std::vector<float> rotationSoaA[4];
+			std::vector<float> rotationSoaB[4];
+
+			// Transforms with up to date world matrices
+			std::vector<Components::Transform> transforms;
+			std::vector<Matrix> matrices;
+			std::vector<Math::Matrix3X4> affineMatrices;
+
+			// Outputs
+			std::vector<float> floatOutput;
+			std::vector<float> floatOutputB;
+			std::vector<float> soaOutput[4];
+			std::vector<Vector2> vector2Output;
+			std::vector<Vector3> vector3Output;
+			std::vector<Vector4> vector4Output;
+			std::vector<Quaternion> rotationOutput;
+			std::vector<Matrix> matrixOutput;
+			std::vector<Math::Matrix3X4> affineOutput;
+			std::vector<uint8_t> byteOutput;
+		};
+
+		/// <summary>
+		/// Wraps a per element body into a case that walks all BENCHMARKELEMENTS elements once per iteration
+		/// </summary>
+		template <typename Body>
+		inline Profiling::BenchmarkFunction ForEachElement(Body body)
+		{
+			return [body](uint64_t iterations)
+			{
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					for (size_t index = 0; index < BENCHMARKELEMENTS; ++index) { body(index); }
+
+					// Acts as a compiler barrier so the outputs must be recomputed every iteration
+					Profiling::KeepAlive(iteration);
+				}
+			};
+		}
+
+		/// <summary>
+		/// Wraps a whole array call into a case , the call must process BENCHMARKELEMENTS elements
+		/// </summary>
+		template <typename Body>
+		inline Profiling::BenchmarkFunction ForEachIteration(Body body)
+		{
+			return [body](uint64_t iterations)
+			{
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					body();
+					Profiling::KeepAlive(iteration);
+				}
+			};
+		}
+
+		// Variant names used in the JSON output
+		inline static constexpr const char* SCALARVARIANT = "Scalar";
+		inline static constexpr const char* DIRECTXVARIANT = "DirectXMath";
+		inline static constexpr const char* BATCHEDVARIANT = "Batched";
+
+		// Every MathDefinitions.hpp function , as the engine wrapper (Scalar) , raw DirectXMath and SoA / kernel (Batched)
+		void RegisterMathBenchmarks(Profiling::BenchmarkSuite& suite, BenchmarkData& data);
+
+		// Transform getters and the local matrix
+		void RegisterTransformBenchmarks(Profiling::BenchmarkSuite& suite, BenchmarkData& data);
+
+		// TransformHierarchy updates and restructuring at 100k and 1M nodes against a pointer based scene graph
+		void RegisterHierarchyBenchmarks(Profiling::BenchmarkSuite& suite, BenchmarkData& data);
+
+		// ECS iteration , creation and structural changes at 1M entities against heap allocated game objects
+		void RegisterECSBenchmarks(Profiling::BenchmarkSuite& suite, BenchmarkData& data);
+
+		// World partition streaming around a camera flying over a synthetic 4M entity world
+		void RegisterStreamingBenchmarks(Profiling::BenchmarkSuite& suite, BenchmarkData& data);
+
+		// The dispatched batch kernels (trig , quaternion blends , packing , random , noise)
+		void RegisterKernelBenchmarks(Profiling::BenchmarkSuite& suite, BenchmarkData& data);
+
+		/// <summary>
+		/// Accuracy and regression checks of the engine math (every supported SIMD tier) , run before any case is timed.
+		/// Logs each failure , returns false if there was one
+		/// </summary>
+		bool RunSelfTests();
+	}
+}
+
+#endif // !BENCHMARKDATA_H
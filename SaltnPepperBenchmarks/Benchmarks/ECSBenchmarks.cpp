@@ -0,0 +1,317 @@
+#include "BenchmarkData.hpp"
+#include "Core/ECS/CommandBuffer.hpp"
+#include "Core/ECS/Prefab.hpp"
+#include "Core/ECS/Query.hpp"
+#include "Core/ECS/World.hpp"
+#include "Utilities/Math/Random.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		using Profiling::BenchmarkFunction;
+		using Profiling::BenchmarkSuite;
+
+		namespace
+		{
+			inline static constexpr uint32_t ENTITYCOUNT = 1000000;
+
+			// Entities that get a component added and removed again per AddRemove iteration
+			inline static constexpr uint32_t STRUCTURALCOUNT = 10000;
+
+			// Entities with a Velocity in the UpdateChanged scene , the rest of it never moves
+			inline static constexpr uint32_t MOVINGCOUNT = ENTITYCOUNT / 10;
+
+			// Entities spawned per Instantiate iteration , a wave of units
+			inline static constexpr uint32_t INSTANCECOUNT = 10000;
+
+			inline static constexpr float TIMESTEP = 1.0f / 60.0f;
+
+			struct Velocity
+			{
+				Vector3 linear = Vector3{ 0.0f,0.0f,0.0f };
+			};
+
+			/// <summary>
+			/// Per unit type data : what a mesh / material / tuning table stands for , identical across every unit of the type
+			/// </summary>
+			struct UnitArchetype
+			{
+				std::vector<float> damageCurve = std::vector<float>(32, 1.0f);
+				std::vector<uint32_t> lodMeshes = { 0, 1, 2, 3 };
+				float speed = 4.0f;
+			};
+
+			// Zero size marker , moves the entity to a neighbouring archetype
+			struct Selected {};
+
+			/// <summary>
+			/// The layout the ECS replaces : a heap object per game object with its components behind their own pointers
+			/// </summary>
+			struct GameObject
+			{
+				std::unique_ptr<Components::Transform> transform;
+				std::unique_ptr<Velocity> velocity;
+			};
+
+			/// <summary>
+			/// The same entities as a World and as scattered GameObjects , built on first use so filtered out cases cost nothing
+			/// </summary>
+			struct ECSScene
+			{
+				ECSScene() : random(Math::DEFAULTRANDOMSEED, ENTITYCOUNT) {}
+
+				void Build()
+				{
+					if (!entities.empty()) { return; }
+
+					transforms.resize(ENTITYCOUNT);
+					velocities.resize(ENTITYCOUNT);
+					for (uint32_t index = 0; index < ENTITYCOUNT; ++index)
+					{
+						transforms[index].localPosition = Vector3(random.Range(-100.0f, 100.0f), random.Range(-100.0f, 100.0f), random.Range(-100.0f, 100.0f));
+						velocities[index].linear = random.OnSphere(5.0f);
+					}
+
+					world.Reserve(ENTITYCOUNT);
+					entities.reserve(ENTITYCOUNT);
+					for (uint32_t index = 0; index < ENTITYCOUNT; ++index) { entities.push_back(world.Create(transforms[index], velocities[index])); }
+
+					// Allocate in shuffled order so neighbouring objects end up all over the heap , like objects spawned over a session
+					std::vector<uint32_t> allocationOrder(ENTITYCOUNT);
+					for (uint32_t index = 0; index < ENTITYCOUNT; ++index) { allocationOrder[index] = index; }
+					for (uint32_t index = ENTITYCOUNT - 1; index > 0; --index) { std::swap(allocationOrder[index], allocationOrder[random.NextBounded(index + 1)]); }
+
+					objects.resize(ENTITYCOUNT);
+					for (uint32_t index : allocationOrder)
+					{
+						objects[index] = std::make_unique<GameObject>();
+						objects[index]->transform = std::make_unique<Components::Transform>(transforms[index]);
+						objects[index]->velocity = std::make_unique<Velocity>(velocities[index]);
+					}
+				}
+
+				Math::RandomGenerator random;
+				std::vector<Components::Transform> transforms;
+				std::vector<Velocity> velocities;
+
+				ECS::World world;
+				std::vector<ECS::Entity> entities;
+				std::vector<std::unique_ptr<GameObject>> objects;
+			};
+
+			/// <summary>
+			/// Mostly static world : MOVINGCOUNT entities with a Velocity , the rest only a Transform.
+			/// Each variant owns a world so the versions one leaves behind don't leak into the other
+			/// </summary>
+			struct ChangeScene
+			{
+				ChangeScene()
+					: moveQuery(batchedWorld)
+					, updateQuery(batchedWorld)
+				{
+					updateQuery.Changed<Components::Transform>();
+				}
+
+				void Build()
+				{
+					if (scalarWorld.GetEntityCount() != 0) { return; }
+
+					Math::RandomGenerator random(Math::DEFAULTRANDOMSEED, ENTITYCOUNT);
+					for (ECS::World* world : { &scalarWorld, &batchedWorld })
+					{
+						world->Reserve(ENTITYCOUNT);
+						for (uint32_t index = 0; index < ENTITYCOUNT; ++index)
+						{
+							Components::Transform transform;
+							transform.localPosition = Vector3(random.Range(-100.0f, 100.0f), random.Range(-100.0f, 100.0f), random.Range(-100.0f, 100.0f));
+
+							if (index < MOVINGCOUNT) { world->Create(transform, Velocity{ random.OnSphere(5.0f) }); }
+							else { world->Create(transform); }
+						}
+					}
+				}
+
+				ECS::World scalarWorld;
+				ECS::World batchedWorld;
+
+				ECS::Query<Components::Transform, const Velocity> moveQuery;
+				ECS::Query<Components::Transform> updateQuery;
+			};
+		}
+
+		void RegisterECSBenchmarks(BenchmarkSuite& suite, BenchmarkData& benchmarkData)
+		{
+			(void)benchmarkData;
+
+			// One operation is one entity
+			auto add = [&suite](const std::string& name, const char* variant, uint64_t operations, BenchmarkFunction function) { suite.Add("ECS", name, variant, operations, std::move(function)); };
+			const std::string count = std::to_string(ENTITYCOUNT);
+
+			auto scene = std::make_shared<ECSScene>();
+			auto changeScene = std::make_shared<ChangeScene>();
+
+			// Position += velocity * dt over every entity : pointer chasing through GameObjects against walking chunk columns
+			add("Iterate" + count, SCALARVARIANT, ENTITYCOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					for (const std::unique_ptr<GameObject>& object : scene->objects)
+					{
+						object->transform->localPosition += object->velocity->linear * TIMESTEP;
+					}
+					Profiling::KeepAlive(iteration);
+				}
+			});
+			add("Iterate" + count, BATCHEDVARIANT, ENTITYCOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					scene->world.Each<Components::Transform, const Velocity>([](Components::Transform& transform, const Velocity& velocity)
+					{
+						transform.localPosition += velocity.linear * TIMESTEP;
+					});
+					Profiling::KeepAlive(iteration);
+				}
+			});
+
+			// Spawning every entity into an empty container and tearing it down again
+			add("Create" + count, SCALARVARIANT, ENTITYCOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					std::vector<std::unique_ptr<GameObject>> objects;
+					objects.reserve(ENTITYCOUNT);
+					for (uint32_t index = 0; index < ENTITYCOUNT; ++index)
+					{
+						objects.push_back(std::make_unique<GameObject>());
+						objects.back()->transform = std::make_unique<Components::Transform>(scene->transforms[index]);
+						objects.back()->velocity = std::make_unique<Velocity>(scene->velocities[index]);
+					}
+					Profiling::KeepAlive(iteration);
+				}
+			});
+			add("Create" + count, BATCHEDVARIANT, ENTITYCOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					ECS::World world;
+					world.Reserve(ENTITYCOUNT);
+					for (uint32_t index = 0; index < ENTITYCOUNT; ++index) { world.Create(scene->transforms[index], scene->velocities[index]); }
+					Profiling::KeepAlive(iteration);
+				}
+			});
+
+			// Spawning a wave of units of one type , at their own positions. Each entity deep copying the type data against
+			// a prefab that shares it and fills the instances' rows column by column
+			add("Instantiate", SCALARVARIANT, INSTANCECOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				const UnitArchetype unitType;
+				ECS::World world;
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					for (uint32_t index = 0; index < INSTANCECOUNT; ++index) { world.Create(scene->transforms[index], Velocity{}, unitType); }
+					world.Clear();
+					Profiling::KeepAlive(iteration);
+				}
+			});
+			add("Instantiate", BATCHEDVARIANT, INSTANCECOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				ECS::Prefab prefab;
+				prefab.Add(Velocity{});
+				prefab.Share(UnitArchetype{});
+
+				ECS::World world;
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					world.Instantiate(prefab, INSTANCECOUNT, scene->transforms.data());
+					world.Clear();
+					Profiling::KeepAlive(iteration);
+				}
+			});
+
+			// Structural changes : a random set of entities gets a marker and loses it again , two row moves each.
+			// Straight through the world (one entity at a time , main thread only) against recording from the job workers
+			// into a command buffer and playing it back sorted and batched
+			add("AddRemove", SCALARVARIANT, STRUCTURALCOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				std::vector<ECS::Entity> selection(STRUCTURALCOUNT);
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					for (ECS::Entity& entity : selection)
+					{
+						entity = scene->entities[scene->random.NextBounded(ENTITYCOUNT)];
+						scene->world.Add<Selected>(entity);
+					}
+					for (ECS::Entity entity : selection) { scene->world.Remove<Selected>(entity); }
+					Profiling::KeepAlive(iteration);
+				}
+			});
+			add("AddRemove", BATCHEDVARIANT, STRUCTURALCOUNT, [scene](uint64_t iterations)
+			{
+				scene->Build();
+				std::vector<ECS::Entity> selection(STRUCTURALCOUNT);
+				ECS::CommandBuffer commands;
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					for (ECS::Entity& entity : selection) { entity = scene->entities[scene->random.NextBounded(ENTITYCOUNT)]; }
+
+					Jobs::JobSystem::ParallelFor(selection.size(), 256, [&](size_t begin, size_t end)
+					{
+						for (size_t index = begin; index < end; ++index) { commands.Add<Selected>(selection[index]); }
+					});
+					commands.Playback(scene->world);
+
+					Jobs::JobSystem::ParallelFor(selection.size(), 256, [&](size_t begin, size_t end)
+					{
+						for (size_t index = begin; index < end; ++index) { commands.Remove<Selected>(selection[index]); }
+					});
+					commands.Playback(scene->world);
+					Profiling::KeepAlive(iteration);
+				}
+			});
+
+			// A frame of the mostly static world : move the entities with a Velocity , then refresh world matrices.
+			// The DIRTY bit has to be looked at on every entity , the version filtered query only walks the chunks that moved
+			add("UpdateChanged", SCALARVARIANT, ENTITYCOUNT, [changeScene](uint64_t iterations)
+			{
+				changeScene->Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					changeScene->scalarWorld.Each<Components::Transform, const Velocity>([](Components::Transform& transform, const Velocity& velocity)
+					{
+						transform.localPosition += velocity.linear * TIMESTEP;
+						transform.SetDirty();
+					});
+					changeScene->scalarWorld.Each<Components::Transform>([](Components::Transform& transform) { transform.UpdateTransform(); });
+					Profiling::KeepAlive(iteration);
+				}
+			});
+			add("UpdateChanged", BATCHEDVARIANT, ENTITYCOUNT, [changeScene](uint64_t iterations)
+			{
+				changeScene->Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					changeScene->moveQuery.ParallelForEach([](Components::Transform& transform, const Velocity& velocity)
+					{
+						transform.localPosition += velocity.linear * TIMESTEP;
+						transform.SetDirty();
+					});
+					changeScene->updateQuery.ParallelForEach([](Components::Transform& transform) { transform.UpdateTransform(); });
+					Profiling::KeepAlive(iteration);
+				}
+			});
+		}
+	}
+}
@@ -0,0 +1,313 @@
+#include "BenchmarkData.hpp"
+#include "Core/Components/TransformHierarchy.hpp"
+#include "Core/Scene/SceneFile.hpp"
+#include "Utilities/Math/Random.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		using Profiling::BenchmarkFunction;
+		using Profiling::BenchmarkSuite;
+
+		namespace
+		{
+			// One in ROOTRATE nodes starts a new tree , the others hang off a random earlier node (about 2.7 * ln(n) deep)
+			inline static constexpr uint32_t ROOTRATE = 64;
+
+			// Nodes moved to a new parent per Restructure iteration
+			inline static constexpr uint32_t RESTRUCTURECOUNT = 256;
+
+			// One in PARTIALRATE nodes gets a new local position per UpdatePartial iteration (moves per UpdateLevel iteration)
+			inline static constexpr uint32_t PARTIALRATE = 100;
+
+			/// <summary>
+			/// Pointer based scene graph , the layout the hierarchy replaces : every node is its own heap block
+			/// </summary>
+			struct SceneNode
+			{
+				Components::Transform transform;
+				std::vector<SceneNode*> children;
+			};
+
+			/// <summary>
+			/// The same random scene as a TransformHierarchy and as a scattered SceneNode graph , built on first use
+			/// so filtered out sizes cost nothing
+			/// </summary>
+			struct HierarchyScene
+			{
+				explicit HierarchyScene(uint32_t count) : nodeCount(count), random(Math::DEFAULTRANDOMSEED, count) {}
+
+				void Build()
+				{
+					if (!handles.empty()) { return; }
+
+					std::vector<uint32_t> parents(nodeCount, UINT32_MAX);
+					std::vector<Components::Transform> locals(nodeCount);
+					for (uint32_t index = 0; index < nodeCount; ++index)
+					{
+						if (index > 0 && random.NextBounded(ROOTRATE) != 0) { parents[index] = random.NextBounded(index); }
+
+						Components::Transform& local = locals[index];
+						local.localPosition = Vector3(random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f));
+						local.localScale = Vector3(random.Range(0.9f, 1.1f), random.Range(0.9f, 1.1f), random.Range(0.9f, 1.1f));
+
+						const Vector3 axis = random.OnSphere();
+						XMStoreFloat4(&local.localRotation, XMQuaternionRotationAxis(XMLoadFloat3(&axis), random.Range(-PI, PI)));
+					}
+
+					hierarchy.Reserve(nodeCount);
+					handles.reserve(nodeCount);
+					for (uint32_t index = 0; index < nodeCount; ++index)
+					{
+						handles.push_back(hierarchy.Create(locals[index], parents[index] != UINT32_MAX ? handles[parents[index]] : Components::TransformHandle{}));
+						if (parents[index] == UINT32_MAX) { rootHandles.push_back(handles.back()); }
+					}
+					hierarchy.Update();
+
+					// Allocate the graph nodes in shuffled order so siblings end up all over the heap
+					std::vector<uint32_t> allocationOrder(nodeCount);
+					for (uint32_t index = 0; index < nodeCount; ++index) { allocationOrder[index] = index; }
+					for (uint32_t index = nodeCount - 1; index > 0; --index) { std::swap(allocationOrder[index], allocationOrder[random.NextBounded(index + 1)]); }
+
+					graph.resize(nodeCount);
+					for (uint32_t index : allocationOrder)
+					{
+						graph[index] = std::make_unique<SceneNode>();
+						graph[index]->transform = locals[index];
+					}
+					for (uint32_t index = 0; index < nodeCount; ++index)
+					{
+						if (parents[index] == UINT32_MAX) { roots.push_back(graph[index].get()); }
+						else { graph[parents[index]]->children.push_back(graph[index].get()); }
+					}
+				}
+
+				static void UpdateGraph(SceneNode* node)
+				{
+					for (SceneNode* child : node->children)
+					{
+						child->transform.UpdateParentTransform(node->transform);
+						UpdateGraph(child);
+					}
+				}
+
+				uint32_t nodeCount;
+
+				// Shared by the cases so repeated calls keep making new changes
+				Math::RandomGenerator random;
+				Components::TransformHierarchy hierarchy;
+				std::vector<Components::TransformHandle> handles;
+				std::vector<Components::TransformHandle> rootHandles;
+				std::vector<std::unique_ptr<SceneNode>> graph;
+				std::vector<SceneNode*> roots;
+			};
+
+			/// <summary>
+			/// A hierarchy saved as a scene file in the temp directory , deleted again with the benchmark suite
+			/// </summary>
+			struct SavedScene
+			{
+				~SavedScene()
+				{
+					std::error_code error;
+					if (!path.empty()) { std::filesystem::remove(path, error); }
+				}
+
+				void Save(const Components::TransformHierarchy& hierarchy)
+				{
+					const std::string target = (std::filesystem::temp_directory_path() / ("SaltnPepperBenchmark" + std::to_string(hierarchy.GetCount()) + ".scene")).string();
+
+					Scene::SceneWriter writer;
+					if (writer.AddHierarchy(hierarchy) && writer.Save(target)) { path = target; }
+				}
+
+				std::string path;
+			};
+		}
+
+		void RegisterHierarchyBenchmarks(BenchmarkSuite& suite, BenchmarkData& benchmarkData)
+		{
+			(void)benchmarkData;
+
+			for (uint32_t nodeCount : { 100000u, 1000000u })
+			{
+				// One operation is one node
+				auto add = [&suite, nodeCount](const std::string& name, const char* variant, BenchmarkFunction function) { suite.Add("Hierarchy", name + std::to_string(nodeCount), variant, nodeCount, std::move(function)); };
+
+				auto scene = std::make_shared<HierarchyScene>(nodeCount);
+
+				// Everything moves : the graph walks every node through UpdateParentTransform , the hierarchy gets its roots marked dirty.
+				// UpdateAll splits levels and the deep tail across the job system , UpdateAllSerial is the single threaded sweep
+				add("UpdateAll", SCALARVARIANT, [scene](uint64_t iterations)
+				{
+					scene->Build();
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						for (SceneNode* root : scene->roots)
+						{
+							root->transform.SetDirty();
+							root->transform.UpdateTransform();
+							HierarchyScene::UpdateGraph(root);
+						}
+						Profiling::KeepAlive(iteration);
+					}
+				});
+				for (const bool parallel : { true, false })
+				{
+					add(parallel ? "UpdateAll" : "UpdateAllSerial", BATCHEDVARIANT, [scene, parallel](uint64_t iterations)
+					{
+						scene->Build();
+						for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+						{
+							for (Components::TransformHandle root : scene->rootHandles) { scene->hierarchy.SetDirty(root); }
+							scene->hierarchy.Update(parallel);
+							Profiling::KeepAlive(iteration);
+						}
+					});
+				}
+
+				// A typical frame : a scattered 1 % of the nodes move
+				add("UpdatePartial", BATCHEDVARIANT, [scene](uint64_t iterations)
+				{
+					scene->Build();
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						for (uint32_t move = 0; move < scene->nodeCount / PARTIALRATE; ++move)
+						{
+							const Components::TransformHandle node = scene->handles[scene->random.NextBounded(scene->nodeCount)];
+							scene->hierarchy.SetLocalPosition(node, Vector3(scene->random.Range(-10.0f, 10.0f), 0.0f, 0.0f));
+						}
+						scene->hierarchy.Update();
+						Profiling::KeepAlive(iteration);
+					}
+				});
+
+				// Nothing moves , the cost of walking the flags
+				add("UpdateClean", BATCHEDVARIANT, [scene](uint64_t iterations)
+				{
+					scene->Build();
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						scene->hierarchy.Update();
+						Profiling::KeepAlive(iteration);
+					}
+				});
+
+				// Copying every world matrix into a 4x4 staging buffer , a memcpy for 4x4 storage , expanded on the fly with SNP_AFFINE_WORLDMATRIX
+				add("Upload", BATCHEDVARIANT, [scene](uint64_t iterations)
+				{
+					scene->Build();
+					std::vector<Matrix> staging(scene->nodeCount);
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						scene->hierarchy.CopyWorldMatrices(0, scene->nodeCount, staging.data());
+						Profiling::KeepAlive(iteration);
+					}
+				});
+
+				// A level where most nodes never move : a scattered 1 % (with their subtrees) get marked dirty every frame.
+				// UpdateLevel sweeps every depth level that holds a moving node , UpdateLevelFrozen freezes the whole scene and
+				// unfreezes just the moving nodes , so the sweeps only walk those
+				for (const bool frozen : { false, true })
+				{
+					auto levelScene = std::make_shared<HierarchyScene>(nodeCount);
+					auto movingNodes = std::make_shared<std::vector<Components::TransformHandle>>();
+
+					add(frozen ? "UpdateLevelFrozen" : "UpdateLevel", BATCHEDVARIANT, [levelScene, movingNodes, frozen](uint64_t iterations)
+					{
+						if (movingNodes->empty())
+						{
+							levelScene->Build();
+							for (uint32_t move = 0; move < levelScene->nodeCount / PARTIALRATE; ++move)
+							{
+								movingNodes->push_back(levelScene->handles[levelScene->random.NextBounded(levelScene->nodeCount)]);
+							}
+
+							if (frozen)
+							{
+								for (Components::TransformHandle root : levelScene->rootHandles) { levelScene->hierarchy.Freeze(root); }
+								for (Components::TransformHandle node : *movingNodes) { levelScene->hierarchy.Unfreeze(node); }
+							}
+							levelScene->hierarchy.Update();
+						}
+
+						for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+						{
+							for (Components::TransformHandle node : *movingNodes) { levelScene->hierarchy.SetDirty(node); }
+							levelScene->hierarchy.Update();
+							Profiling::KeepAlive(iteration);
+						}
+					});
+				}
+
+				// Loading the scene into a fresh hierarchy : node by node through Create plus an Update for the world matrices ,
+				// the way a parsed level file gets built , against mapping a saved scene file and Assign copying its columns in.
+				// The file stays in the OS cache after the first iteration , so this is the load cost without the disk
+				add("Load", SCALARVARIANT, [scene](uint64_t iterations)
+				{
+					scene->Build();
+					const Components::TransformHierarchy& source = scene->hierarchy;
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						Components::TransformHierarchy hierarchy;
+						std::vector<Components::TransformHandle> handles;
+						hierarchy.Reserve(scene->nodeCount);
+						handles.reserve(scene->nodeCount);
+
+						for (uint32_t slot = 0; slot < scene->nodeCount; ++slot)
+						{
+							Components::Transform local;
+							local.localPosition = source.GetLocalPositions()[slot];
+							local.localRotation = source.GetLocalRotations()[slot];
+							local.localScale = source.GetLocalScales()[slot];
+
+							const uint32_t parentSlot = source.GetParentSlots()[slot];
+							handles.push_back(hierarchy.Create(local, parentSlot != Components::TransformHierarchy::INVALIDSLOT ? handles[parentSlot] : Components::TransformHandle{}));
+						}
+						hierarchy.Update();
+						Profiling::KeepAlive(hierarchy.GetCount());
+					}
+				});
+				auto sceneFile = std::make_shared<SavedScene>();
+				add("Load", BATCHEDVARIANT, [scene, sceneFile](uint64_t iterations)
+				{
+					if (sceneFile->path.empty())
+					{
+						scene->Build();
+						sceneFile->Save(scene->hierarchy);
+					}
+
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						Components::TransformHierarchy hierarchy;
+						Scene::SceneFile file;
+						if (file.Open(sceneFile->path)) { Scene::LoadHierarchy(file.GetView(), hierarchy); }
+						Profiling::KeepAlive(hierarchy.GetCount());
+					}
+				});
+
+				// A few reparents per frame , each forcing a full Compact
+				add("Restructure", BATCHEDVARIANT, [scene](uint64_t iterations)
+				{
+					scene->Build();
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						for (uint32_t move = 0; move < RESTRUCTURECOUNT; ++move)
+						{
+							const Components::TransformHandle node = scene->handles[scene->random.NextBounded(scene->nodeCount)];
+							const Components::TransformHandle parent = scene->handles[scene->random.NextBounded(scene->nodeCount)];
+							scene->hierarchy.SetParent(node, parent, true);
+						}
+						scene->hierarchy.Update();
+						Profiling::KeepAlive(iteration);
+					}
+				});
+			}
+		}
+	}
+}
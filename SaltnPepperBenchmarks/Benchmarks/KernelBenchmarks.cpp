@@ -0,0 +1,198 @@
+#include "BenchmarkData.hpp"
+#include "Utilities/Math/PackedConversion.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+#include "Utilities/Math/Random.hpp"
+#include "Utilities/Math/Noise.hpp"
+#include "Utilities/Math/BoundingVolumes.hpp"
+#include "Core/Components/TransformCodec.hpp"
+#include <memory>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		using Profiling::BenchmarkFunction;
+		using Profiling::BenchmarkSuite;
+
+		namespace
+		{
+			// Large enough for PackFloats / UnpackFloats to split the work across the job system
+			inline static constexpr size_t PACKEDLARGEELEMENTS = 1 << 20;
+
+			// The dispatched kernel called directly , what the Batched large cases would cost without ParallelFor
+			inline static constexpr const char* SINGLETHREADVARIANT = "SingleThread";
+
+			void RegisterPackedBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, BenchmarkFunction function) { suite.Add("Packed", name, BATCHEDVARIANT, BENCHMARKELEMENTS, std::move(function)); };
+
+				const float* source = data->unitFloats.data();
+				float* output = data->floatOutput.data();
+				uint8_t* packed = data->byteOutput.data();
+
+				const struct { const char* pack; const char* unpack; Math::PackedFormat format; } formats[] =
+				{
+					{ "PackHalf", "UnpackHalf", Math::PackedFormat::Half },
+					{ "PackSNorm8", "UnpackSNorm8", Math::PackedFormat::SNorm8 },
+					{ "PackSNorm16", "UnpackSNorm16", Math::PackedFormat::SNorm16 },
+					{ "PackUNorm8", "UnpackUNorm8", Math::PackedFormat::UNorm8 },
+					{ "PackUNorm16", "UnpackUNorm16", Math::PackedFormat::UNorm16 }
+				};
+
+				for (const auto& entry : formats)
+				{
+					const Math::PackedFormat format = entry.format;
+					add(entry.pack, ForEachIteration([=]() { Math::PackFloats(source, packed, BENCHMARKELEMENTS, format); }));
+					add(entry.unpack, ForEachIteration([=]() { Math::UnpackFloats(packed, output, BENCHMARKELEMENTS, format); }));
+				}
+
+				suite.Add("Packed", "PackHalf", DIRECTXVARIANT, BENCHMARKELEMENTS, ForEachIteration([=]()
+				{
+					DirectX::PackedVector::XMConvertFloatToHalfStream(reinterpret_cast<HALF*>(packed), sizeof(HALF), source, sizeof(float), BENCHMARKELEMENTS);
+				}));
+				suite.Add("Packed", "UnpackHalf", DIRECTXVARIANT, BENCHMARKELEMENTS, ForEachIteration([=]()
+				{
+					DirectX::PackedVector::XMConvertHalfToFloatStream(output, sizeof(float), reinterpret_cast<const HALF*>(packed), sizeof(HALF), BENCHMARKELEMENTS);
+				}));
+
+				// Large arrays , these measure ParallelFor scaling rather than the kernels
+				auto largeSource = std::make_shared<std::vector<float>>(PACKEDLARGEELEMENTS);
+				auto largePacked = std::make_shared<std::vector<uint16_t>>(PACKEDLARGEELEMENTS);
+				auto largeOutput = std::make_shared<std::vector<float>>(PACKEDLARGEELEMENTS);
+
+				for (size_t index = 0; index < PACKEDLARGEELEMENTS; ++index)
+				{
+					(*largeSource)[index] = data->unitFloats[index % BENCHMARKELEMENTS];
+				}
+
+				auto addLarge = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Packed", name, variant, PACKEDLARGEELEMENTS, std::move(function)); };
+
+				addLarge("PackHalfLarge", BATCHEDVARIANT, ForEachIteration([=]() { Math::PackFloats(largeSource->data(), largePacked->data(), PACKEDLARGEELEMENTS, Math::PackedFormat::Half); }));
+				addLarge("PackHalfLarge", SINGLETHREADVARIANT, ForEachIteration([=]()
+				{
+					Math::MathDispatch::GetKernels().PackFloats(largeSource->data(), largePacked->data(), PACKEDLARGEELEMENTS, Math::PackedFormat::Half);
+				}));
+				addLarge("UnpackHalfLarge", BATCHEDVARIANT, ForEachIteration([=]() { Math::UnpackFloats(largePacked->data(), largeOutput->data(), PACKEDLARGEELEMENTS, Math::PackedFormat::Half); }));
+				addLarge("UnpackHalfLarge", SINGLETHREADVARIANT, ForEachIteration([=]()
+				{
+					Math::MathDispatch::GetKernels().UnpackFloats(largePacked->data(), largeOutput->data(), PACKEDLARGEELEMENTS, Math::PackedFormat::Half);
+				}));
+			}
+
+			void RegisterRandomBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Random", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				// Generators are shared by the cases and only ever advance , which is all a throughput run needs
+				auto generator = std::make_shared<Math::RandomGenerator>(Math::DEFAULTRANDOMSEED);
+				auto batch = std::make_shared<Math::RandomBatch>(Math::DEFAULTRANDOMSEED);
+
+				float* output = data->floatOutput.data();
+				float* x = data->soaOutput[0].data();
+				float* y = data->soaOutput[1].data();
+				float* z = data->soaOutput[2].data();
+
+				add("Float", SCALARVARIANT, ForEachElement([=](size_t i) { output[i] = generator->NextFloat(); }));
+				add("Float", BATCHEDVARIANT, ForEachIteration([=]() { batch->FillFloat(output, BENCHMARKELEMENTS); }));
+				add("Gaussian", SCALARVARIANT, ForEachElement([=](size_t i) { output[i] = generator->Gaussian(); }));
+				add("Gaussian", BATCHEDVARIANT, ForEachIteration([=]() { batch->FillGaussian(output, BENCHMARKELEMENTS); }));
+				add("OnSphere", SCALARVARIANT, ForEachElement([=](size_t i) { data->vector3Output[i] = generator->OnSphere(); }));
+				add("OnSphere", BATCHEDVARIANT, ForEachIteration([=]() { batch->FillOnSphere(x, y, z, BENCHMARKELEMENTS); }));
+			}
+
+			void RegisterNoiseBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				// One operation is one sample , so samples per second = 1e9 / ns per op
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Noise", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				const float* x = data->soaA[0].data();
+				const float* y = data->soaA[1].data();
+				const float* z = data->soaA[2].data();
+				const float* w = data->soaB[0].data();
+				float* output = data->floatOutput.data();
+
+				const struct { const char* name; Math::NoiseType type; Math::NoiseFractal fractal; } variants[] =
+				{
+					{ "Simplex", Math::NoiseType::Simplex, Math::NoiseFractal::None },
+					{ "SimplexFBm", Math::NoiseType::Simplex, Math::NoiseFractal::FBm },
+					{ "SimplexRidged", Math::NoiseType::Simplex, Math::NoiseFractal::Ridged },
+					{ "Value", Math::NoiseType::Value, Math::NoiseFractal::None },
+					{ "ValueFBm", Math::NoiseType::Value, Math::NoiseFractal::FBm }
+				};
+
+				for (const auto& variant : variants)
+				{
+					Math::NoiseSettings settings;
+					settings.type = variant.type;
+					settings.fractal = variant.fractal;
+					settings.frequency = 0.05f;
+
+					const std::string name = variant.name;
+
+					add((name + "2D").c_str(), SCALARVARIANT, ForEachElement([=](size_t i) { output[i] = Math::EvaluateNoise(settings, x[i], y[i]); }));
+					add((name + "2D").c_str(), BATCHEDVARIANT, ForEachIteration([=]() { Math::EvaluateNoise2D(settings, x, y, output, BENCHMARKELEMENTS); }));
+					add((name + "3D").c_str(), SCALARVARIANT, ForEachElement([=](size_t i) { output[i] = Math::EvaluateNoise(settings, x[i], y[i], z[i]); }));
+					add((name + "3D").c_str(), BATCHEDVARIANT, ForEachIteration([=]() { Math::EvaluateNoise3D(settings, x, y, z, output, BENCHMARKELEMENTS); }));
+					add((name + "4D").c_str(), SCALARVARIANT, ForEachElement([=](size_t i) { output[i] = Math::EvaluateNoise(settings, x[i], y[i], z[i], w[i]); }));
+					add((name + "4D").c_str(), BATCHEDVARIANT, ForEachIteration([=]() { Math::EvaluateNoise4D(settings, x, y, z, w, output, BENCHMARKELEMENTS); }));
+				}
+
+				// 32 x 32 grid , same sample count as the point arrays
+				Math::NoiseSettings settings;
+				add("SimplexFBmGrid2D", BATCHEDVARIANT, ForEachIteration([=]() { Math::EvaluateNoiseGrid2D(settings, Vector2(0.0f, 0.0f), Vector2(1.0f, 1.0f), 32, BENCHMARKELEMENTS / 32, output); }));
+			}
+
+			void RegisterBoundsBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				// One operation is one point
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Bounds", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				const Vector3* points = data->vector3A.data();
+
+				// 64 point ranges , the usual meshlet size
+				auto ranges = std::make_shared<std::vector<Math::BoundsRange>>();
+				for (uint32_t first = 0; first < BENCHMARKELEMENTS; first += 64) { ranges->push_back({ first, 64 }); }
+				auto boxes = std::make_shared<std::vector<BoundingBox>>(ranges->size());
+				auto spheres = std::make_shared<std::vector<BoundingSphere>>(ranges->size());
+
+				add("Box", DIRECTXVARIANT, ForEachIteration([=]() { BoundingBox box; BoundingBox::CreateFromPoints(box, BENCHMARKELEMENTS, points, sizeof(Vector3)); Profiling::KeepAlive(box); }));
+				add("Box", BATCHEDVARIANT, ForEachIteration([=]() { Profiling::KeepAlive(Math::ComputeBoundingBox(points, BENCHMARKELEMENTS)); }));
+				add("Sphere", DIRECTXVARIANT, ForEachIteration([=]() { BoundingSphere sphere; BoundingSphere::CreateFromPoints(sphere, BENCHMARKELEMENTS, points, sizeof(Vector3)); Profiling::KeepAlive(sphere); }));
+				add("Sphere", BATCHEDVARIANT, ForEachIteration([=]() { Profiling::KeepAlive(Math::ComputeBoundingSphere(points, BENCHMARKELEMENTS)); }));
+				add("SphereExact", BATCHEDVARIANT, ForEachIteration([=]() { Profiling::KeepAlive(Math::ComputeBoundingSphereExact(points, BENCHMARKELEMENTS)); }));
+				add("OrientedBox", DIRECTXVARIANT, ForEachIteration([=]() { BoundingOrientedBox box; BoundingOrientedBox::CreateFromPoints(box, BENCHMARKELEMENTS, points, sizeof(Vector3)); Profiling::KeepAlive(box); }));
+				add("OrientedBox", BATCHEDVARIANT, ForEachIteration([=]() { Profiling::KeepAlive(Math::ComputeOrientedBoundingBox(points, BENCHMARKELEMENTS)); }));
+
+				add("MeshletBoxes", DIRECTXVARIANT, ForEachIteration([=]() { for (size_t index = 0; index < ranges->size(); ++index) { BoundingBox::CreateFromPoints((*boxes)[index], 64, points + (*ranges)[index].first, sizeof(Vector3)); } }));
+				add("MeshletBoxes", BATCHEDVARIANT, ForEachIteration([=]() { Math::ComputeBoundingBoxes(points, sizeof(Vector3), ranges->data(), ranges->size(), boxes->data()); }));
+				add("MeshletSpheres", DIRECTXVARIANT, ForEachIteration([=]() { for (size_t index = 0; index < ranges->size(); ++index) { BoundingSphere::CreateFromPoints((*spheres)[index], 64, points + (*ranges)[index].first, sizeof(Vector3)); } }));
+				add("MeshletSpheres", BATCHEDVARIANT, ForEachIteration([=]() { Math::ComputeBoundingSpheres(points, sizeof(Vector3), ranges->data(), ranges->size(), spheres->data()); }));
+			}
+
+			void RegisterCodecBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, BenchmarkFunction function) { suite.Add("TransformCodec", name, BATCHEDVARIANT, BENCHMARKELEMENTS, std::move(function)); };
+
+				auto codec = std::make_shared<Components::TransformCodec>();
+				auto decoded = std::make_shared<std::vector<Components::Transform>>(data->transforms);
+
+				// Own buffer so Decode always reads a valid stream , whatever ran before it
+				auto stream = std::make_shared<std::vector<uint8_t>>(codec->GetEncodedSize(BENCHMARKELEMENTS));
+				codec->Encode(data->transforms.data(), BENCHMARKELEMENTS, stream->data());
+
+				add("Encode", ForEachIteration([=]() { codec->Encode(data->transforms.data(), BENCHMARKELEMENTS, stream->data()); }));
+				add("Decode", ForEachIteration([=]() { codec->Decode(stream->data(), BENCHMARKELEMENTS, decoded->data()); }));
+			}
+		}
+
+		void RegisterKernelBenchmarks(BenchmarkSuite& suite, BenchmarkData& data)
+		{
+			RegisterPackedBenchmarks(suite, &data);
+			RegisterRandomBenchmarks(suite, &data);
+			RegisterNoiseBenchmarks(suite, &data);
+			RegisterBoundsBenchmarks(suite, &data);
+			RegisterCodecBenchmarks(suite, &data);
+		}
+	}
+}
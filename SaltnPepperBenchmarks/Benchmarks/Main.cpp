@@ -0,0 +1,80 @@
+#include "BenchmarkData.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <string>
+#include <string_view>
+
+// Usage : SaltnPepperBenchmarks [--out=results.json] [--filter=Vector3/] [--samples=31] [--label=<commit>] [--simd-tier=avx2] [--workers=7] [--self-test]
+// The filter matches any part of "group/name/variant". Results go to stdout through the log and , with --out , to a JSON file.
+// The self tests run first , a failure exits with 2 before anything is timed. --self-test stops after them
+int main(int argc, char** argv)
+{
+	using namespace SaltnPepperEngine;
+
+	Debug::Log::OnInit();
+	Math::MathDispatch::OnInit(argc, argv);
+
+	std::string outputPath;
+	std::string filter;
+	std::string label;
+	std::string workers;
+	bool selfTestOnly = false;
+	Profiling::BenchmarkSettings settings;
+
+	for (int index = 1; index < argc; ++index)
+	{
+		const std::string_view argument = argv[index];
+
+		auto readValue = [&argument](std::string_view option, std::string& value)
+		{
+			if (argument.substr(0, option.size()) != option) { return false; }
+			value = std::string(argument.substr(option.size()));
+			return true;
+		};
+
+		std::string samples;
+		if (readValue("--out=", outputPath) || readValue("--filter=", filter) || readValue("--label=", label)) { continue; }
+		if (readValue("--samples=", samples)) { settings.samples = static_cast<uint32_t>(std::stoul(samples)); continue; }
+		if (readValue("--workers=", workers)) { continue; }
+		if (argument == "--self-test") { selfTestOnly = true; continue; }
+	}
+
+	// Only the cases that split work across the job system (hierarchy updates , large bounds builds) use the workers
+	Jobs::JobSystem::OnInit(workers.empty() ? 0 : static_cast<uint32_t>(std::stoul(workers)));
+
+	const bool selfTestsPassed = Benchmarks::RunSelfTests();
+	if (!selfTestsPassed || selfTestOnly)
+	{
+		Jobs::JobSystem::OnDestroy();
+		return selfTestsPassed ? 0 : 2;
+	}
+
+	Benchmarks::BenchmarkData data(Math::DEFAULTRANDOMSEED);
+	Profiling::BenchmarkSuite suite(settings);
+
+	Benchmarks::RegisterMathBenchmarks(suite, data);
+	Benchmarks::RegisterTransformBenchmarks(suite, data);
+	Benchmarks::RegisterHierarchyBenchmarks(suite, data);
+	Benchmarks::RegisterECSBenchmarks(suite, data);
+	Benchmarks::RegisterKernelBenchmarks(suite, data);
+	Benchmarks::RegisterStreamingBenchmarks(suite, data);
+
+	suite.SetMetadata("label", label);
+	suite.SetMetadata("simdTier", Math::MathDispatch::GetTierName(Math::MathDispatch::GetTier()));
+	suite.SetMetadata("elements", std::to_string(Benchmarks::BENCHMARKELEMENTS));
+	suite.SetMetadata("threads", std::to_string(Jobs::JobSystem::GetThreadCount()));
+#if defined(SNP_DEBUG)
+	suite.SetMetadata("configuration", "Debug");
+#else
+	suite.SetMetadata("configuration", "Release");
+#endif
+
+	suite.Run(filter);
+
+	Jobs::JobSystem::OnDestroy();
+
+	if (!outputPath.empty() && !suite.WriteJson(outputPath)) { return 1; }
+
+	return 0;
+}
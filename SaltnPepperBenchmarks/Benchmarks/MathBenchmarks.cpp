@@ -0,0 +1,231 @@
+#include "BenchmarkData.hpp"
+#include "Utilities/Math/AffineMatrix.hpp"
+#include "Utilities/Math/FastTrig.hpp"
+#include "Utilities/Math/QuaternionBatch.hpp"
+#include <cmath>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		using Profiling::BenchmarkFunction;
+		using Profiling::BenchmarkSuite;
+
+		namespace
+		{
+			void RegisterScalarBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Float", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				add("SquareRoot", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::SquareRoot(data->weights[i]); }));
+				add("SquareRoot", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorSqrt(XMVectorReplicate(data->weights[i]))); }));
+
+				add("Min", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Min(data->floatsA[i], data->floatsB[i]); }));
+				add("Max", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Max(data->floatsA[i], data->floatsB[i]); }));
+				add("Clamp", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Clamp(data->floatsA[i], -50.0f, 50.0f); }));
+				add("Clamp", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorClamp(XMVectorReplicate(data->floatsA[i]), XMVectorReplicate(-50.0f), XMVectorReplicate(50.0f))); }));
+				add("Lerp", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Lerp(data->floatsA[i], data->floatsB[i], data->weights[i]); }));
+				add("Lerp", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorLerp(XMVectorReplicate(data->floatsA[i]), XMVectorReplicate(data->floatsB[i]), data->weights[i])); }));
+				add("ToRadians", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::ToRadians(data->floatsA[i]); }));
+				add("ToRadians", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMConvertToRadians(data->floatsA[i]); }));
+				add("ToDegrees", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::ToDegrees(data->angles[i]); }));
+				add("ToDegrees", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMConvertToDegrees(data->angles[i]); }));
+
+				// Base two / ten logarithms through the LogTwo / LogTen constants (inputs in [1 , 2) keep clear of log(0))
+				add("LogTwo", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = std::log(1.0f + data->weights[i]) / Math::LogTwo<float>(); }));
+				add("LogTwo", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorLog2(XMVectorReplicate(1.0f + data->weights[i]))); }));
+				add("LogTen", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = std::log(1.0f + data->weights[i]) / Math::LogTen<float>(); }));
+				add("LogTen", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorLog10(XMVectorReplicate(1.0f + data->weights[i]))); }));
+
+				// Trigonometry , the batched variants are the dispatched FastTrig kernels at full precision
+				const float* angles = data->angles.data();
+				float* output = data->floatOutput.data();
+				float* outputB = data->floatOutputB.data();
+
+				add("Sin", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Sin(data->angles[i]); }));
+				add("Sin", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMScalarSin(data->angles[i]); }));
+				add("Sin", BATCHEDVARIANT, ForEachIteration([=]() { Math::FastSinArray(angles, output, BENCHMARKELEMENTS, Math::TrigPrecision::Full); }));
+				add("Cos", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Cos(data->angles[i]); }));
+				add("Cos", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMScalarCos(data->angles[i]); }));
+				add("Cos", BATCHEDVARIANT, ForEachIteration([=]() { Math::FastCosArray(angles, output, BENCHMARKELEMENTS, Math::TrigPrecision::Full); }));
+				add("SinCos", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMScalarSinCos(&data->floatOutput[i], &data->floatOutputB[i], data->angles[i]); }));
+				add("SinCos", BATCHEDVARIANT, ForEachIteration([=]() { Math::FastSinCosArray(angles, output, outputB, BENCHMARKELEMENTS, Math::TrigPrecision::Full); }));
+				add("Tan", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Tan(data->angles[i]); }));
+				add("Tan", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorTan(XMVectorReplicate(data->angles[i]))); }));
+				add("Tan", BATCHEDVARIANT, ForEachIteration([=]() { Math::FastTanArray(angles, output, BENCHMARKELEMENTS, Math::TrigPrecision::Full); }));
+				add("ASin", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::ASin(data->unitFloats[i]); }));
+				add("ASin", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMScalarASin(data->unitFloats[i]); }));
+				add("ACos", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::ACos(data->unitFloats[i]); }));
+				add("ACos", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMScalarACos(data->unitFloats[i]); }));
+				add("ATan", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::ATan(data->floatsA[i]); }));
+				add("ATan", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorATan(XMVectorReplicate(data->floatsA[i]))); }));
+				add("ATan2", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::ATan2(data->floatsA[i], data->floatsB[i]); }));
+				add("ATan2", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVectorATan2(XMVectorReplicate(data->floatsA[i]), XMVectorReplicate(data->floatsB[i]))); }));
+				add("ATan2", BATCHEDVARIANT, ForEachIteration([=]() { Math::FastATan2Array(data->floatsA.data(), data->floatsB.data(), output, BENCHMARKELEMENTS, Math::TrigPrecision::Full); }));
+			}
+
+			void RegisterVector2Benchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Vector2", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				add("Clamp", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector2Output[i] = Math::Clamp(data->vector2A[i], Vector2(-50.0f, -50.0f), Vector2(50.0f, 50.0f)); }));
+				add("Clamp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat2(&data->vector2Output[i], XMVectorClamp(XMLoadFloat2(&data->vector2A[i]), XMVectorReplicate(-50.0f), XMVectorReplicate(50.0f))); }));
+				add("LengthSquared", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::LengthSquared(data->vector2A[i]); }));
+				add("LengthSquared", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector2LengthSq(XMLoadFloat2(&data->vector2A[i]))); }));
+				add("Length", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Length(data->vector2A[i]); }));
+				add("Length", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector2Length(XMLoadFloat2(&data->vector2A[i]))); }));
+				add("Distance", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Distance(data->vector2A[i], data->vector2B[i]); }));
+				add("Distance", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector2Length(XMVectorSubtract(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i])))); }));
+				add("DistanceSquared", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::DistanceSquared(data->vector2A[i], data->vector2B[i]); }));
+				add("DistanceSquared", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector2LengthSq(XMVectorSubtract(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i])))); }));
+				add("DistanceEstimated", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::DistanceEstimated(data->vector2A[i], data->vector2B[i]); }));
+				add("DistanceEstimated", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector2LengthEst(XMVectorSubtract(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i])))); }));
+				add("Dot", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Dot(data->vector2A[i], data->vector2B[i]); }));
+				add("Dot", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector2Dot(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i]))); }));
+				add("Cross", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector2Output[i] = Math::Cross(data->vector2A[i], data->vector2B[i]); }));
+				add("Cross", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat2(&data->vector2Output[i], XMVector2Cross(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i]))); }));
+				add("Max", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector2Output[i] = Math::Max(data->vector2A[i], data->vector2B[i]); }));
+				add("Max", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat2(&data->vector2Output[i], XMVectorMax(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i]))); }));
+				add("GetAngle", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::GetAngle(data->vector2A[i], data->vector2B[i]); }));
+				add("GetAngle", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector2AngleBetweenVectors(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i]))); }));
+				add("Lerp", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector2Output[i] = Math::Lerp(data->vector2A[i], data->vector2B[i], data->weights[i]); }));
+				add("Lerp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat2(&data->vector2Output[i], XMVectorLerp(XMLoadFloat2(&data->vector2A[i]), XMLoadFloat2(&data->vector2B[i]), data->weights[i])); }));
+			}
+
+			void RegisterVector3Benchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Vector3", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				add("Clamp", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = Math::Clamp(data->vector3A[i], Vector3(-50.0f, -50.0f, -50.0f), Vector3(50.0f, 50.0f, 50.0f)); }));
+				add("Clamp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], XMVectorClamp(XMLoadFloat3(&data->vector3A[i]), XMVectorReplicate(-50.0f), XMVectorReplicate(50.0f))); }));
+				add("LengthSquared", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::LengthSquared(data->vector3A[i]); }));
+				add("LengthSquared", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector3LengthSq(XMLoadFloat3(&data->vector3A[i]))); }));
+				add("Length", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Length(data->vector3A[i]); }));
+				add("Length", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector3Length(XMLoadFloat3(&data->vector3A[i]))); }));
+				add("Distance", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Distance(data->vector3A[i], data->vector3B[i]); }));
+				add("Distance", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector3Length(XMVectorSubtract(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i])))); }));
+				add("DistanceSquared", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::DistanceSquared(data->vector3A[i], data->vector3B[i]); }));
+				add("DistanceSquared", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i])))); }));
+				add("DistanceEstimated", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::DistanceEstimated(data->vector3A[i], data->vector3B[i]); }));
+				add("DistanceEstimated", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector3LengthEst(XMVectorSubtract(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i])))); }));
+				add("Dot", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Dot(data->vector3A[i], data->vector3B[i]); }));
+				add("Dot", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector3Dot(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i]))); }));
+				add("Cross", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = Math::Cross(data->vector3A[i], data->vector3B[i]); }));
+				add("Cross", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], XMVector3Cross(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i]))); }));
+				add("Max", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = Math::Max(data->vector3A[i], data->vector3B[i]); }));
+				add("Max", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], XMVectorMax(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i]))); }));
+				add("GetAngle", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::GetAngle(data->vector3A[i], data->vector3B[i], Vector3(0.0f, 1.0f, 0.0f), PI); }));
+				add("GetAngle", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector3AngleBetweenVectors(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i]))); }));
+				add("Lerp", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = Math::Lerp(data->vector3A[i], data->vector3B[i], data->weights[i]); }));
+				add("Lerp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], XMVectorLerp(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i]), data->weights[i])); }));
+
+				// Structure of arrays , plain loops the compiler vectorises
+				const float* ax = data->soaA[0].data(); const float* ay = data->soaA[1].data(); const float* az = data->soaA[2].data();
+				const float* bx = data->soaB[0].data(); const float* by = data->soaB[1].data(); const float* bz = data->soaB[2].data();
+				const float* weights = data->weights.data();
+				float* output = data->floatOutput.data();
+				float* ox = data->soaOutput[0].data(); float* oy = data->soaOutput[1].data(); float* oz = data->soaOutput[2].data();
+
+				add("LengthSquared", BATCHEDVARIANT, ForEachElement([=](size_t i) { output[i] = ax[i] * ax[i] + ay[i] * ay[i] + az[i] * az[i]; }));
+				add("Length", BATCHEDVARIANT, ForEachElement([=](size_t i) { output[i] = std::sqrt(ax[i] * ax[i] + ay[i] * ay[i] + az[i] * az[i]); }));
+				add("DistanceSquared", BATCHEDVARIANT, ForEachElement([=](size_t i)
+				{
+					const float dx = ax[i] - bx[i], dy = ay[i] - by[i], dz = az[i] - bz[i];
+					output[i] = dx * dx + dy * dy + dz * dz;
+				}));
+				add("Dot", BATCHEDVARIANT, ForEachElement([=](size_t i) { output[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i]; }));
+				add("Cross", BATCHEDVARIANT, ForEachElement([=](size_t i)
+				{
+					ox[i] = ay[i] * bz[i] - az[i] * by[i];
+					oy[i] = az[i] * bx[i] - ax[i] * bz[i];
+					oz[i] = ax[i] * by[i] - ay[i] * bx[i];
+				}));
+				add("Lerp", BATCHEDVARIANT, ForEachElement([=](size_t i)
+				{
+					ox[i] = ax[i] + (bx[i] - ax[i]) * weights[i];
+					oy[i] = ay[i] + (by[i] - ay[i]) * weights[i];
+					oz[i] = az[i] + (bz[i] - az[i]) * weights[i];
+				}));
+			}
+
+			void RegisterVector4Benchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Vector4", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				add("Clamp", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector4Output[i] = Math::Clamp(data->vector4A[i], Vector4(-50.0f, -50.0f, -50.0f, -50.0f), Vector4(50.0f, 50.0f, 50.0f, 50.0f)); }));
+				add("Clamp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4(&data->vector4Output[i], XMVectorClamp(XMLoadFloat4(&data->vector4A[i]), XMVectorReplicate(-50.0f), XMVectorReplicate(50.0f))); }));
+				add("LengthSquared", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::LengthSquared(data->vector4A[i]); }));
+				add("LengthSquared", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector4LengthSq(XMLoadFloat4(&data->vector4A[i]))); }));
+				add("Length", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Length(data->vector4A[i]); }));
+				add("Length", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector4Length(XMLoadFloat4(&data->vector4A[i]))); }));
+				add("Dot", SCALARVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Dot(data->vector4A[i], data->vector4B[i]); }));
+				add("Dot", DIRECTXVARIANT, ForEachElement([data](size_t i) { data->floatOutput[i] = XMVectorGetX(XMVector4Dot(XMLoadFloat4(&data->vector4A[i]), XMLoadFloat4(&data->vector4B[i]))); }));
+				add("Cross", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector4Output[i] = Math::Cross(data->vector4A[i], data->vector4B[i]); }));
+				add("Max", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector4Output[i] = Math::Max(data->vector4A[i], data->vector4B[i]); }));
+				add("Max", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4(&data->vector4Output[i], XMVectorMax(XMLoadFloat4(&data->vector4A[i]), XMLoadFloat4(&data->vector4B[i]))); }));
+				add("Lerp", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector4Output[i] = Math::Lerp(data->vector4A[i], data->vector4B[i], data->weights[i]); }));
+				add("Lerp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4(&data->vector4Output[i], XMVectorLerp(XMLoadFloat4(&data->vector4A[i]), XMLoadFloat4(&data->vector4B[i]), data->weights[i])); }));
+			}
+
+			void RegisterXMVectorBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				// The XMVECTOR overloads in MathDefinitions.hpp , inputs are loaded from Vector3 like the wrappers do
+				auto add = [&suite](const char* name, BenchmarkFunction function) { suite.Add("XMVECTOR", name, SCALARVARIANT, BENCHMARKELEMENTS, std::move(function)); };
+
+				add("Distance", ForEachElement([data](size_t i) { data->floatOutput[i] = Math::Distance(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i])); }));
+				add("DistanceSquared", ForEachElement([data](size_t i) { data->floatOutput[i] = Math::DistanceSquared(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i])); }));
+				add("DistanceEstimated", ForEachElement([data](size_t i) { data->floatOutput[i] = Math::DistanceEstimated(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i])); }));
+				add("Lerp", ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], Math::Lerp(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i]), XMVectorReplicate(data->weights[i]))); }));
+				add("GetAngle", ForEachElement([data](size_t i) { data->floatOutput[i] = Math::GetAngle(XMLoadFloat3(&data->vector3A[i]), XMLoadFloat3(&data->vector3B[i]), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), PI); }));
+			}
+
+			void RegisterMatrixBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Matrix", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				add("GetForward", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = Math::GetForward(data->matrices[i]); }));
+				add("GetForward", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], XMLoadFloat4x4(&data->matrices[i]).r[2]); }));
+				add("GetUp", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = Math::GetUp(data->matrices[i]); }));
+				add("GetUp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], XMLoadFloat4x4(&data->matrices[i]).r[1]); }));
+				add("GetRight", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = Math::GetRight(data->matrices[i]); }));
+				add("GetRight", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], XMLoadFloat4x4(&data->matrices[i]).r[0]); }));
+
+				// Affine (3x4) storage against the full 4x4 , Scalar works on Matrix3X4 , DirectXMath on the general 4x4 functions
+				add("AffineMultiply", SCALARVARIANT, ForEachElement([data](size_t i) { data->affineOutput[i] = Math::AffineMultiply(data->affineMatrices[i], data->affineMatrices[(i + 1) % BENCHMARKELEMENTS]); }));
+				add("AffineMultiply", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4x4(&data->matrixOutput[i], XMMatrixMultiply(XMLoadFloat4x4(&data->matrices[i]), XMLoadFloat4x4(&data->matrices[(i + 1) % BENCHMARKELEMENTS]))); }));
+				add("AffineInverse", SCALARVARIANT, ForEachElement([data](size_t i) { data->affineOutput[i] = Math::AffineInverse(data->affineMatrices[i]); }));
+				add("AffineInverse", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4x4(&data->matrixOutput[i], XMMatrixInverse(nullptr, XMLoadFloat4x4(&data->matrices[i]))); }));
+				add("ExpandAffine", BATCHEDVARIANT, ForEachIteration([data]() { Math::ExpandAffine(data->affineMatrices.data(), data->matrixOutput.data(), BENCHMARKELEMENTS); }));
+				add("ExpandAffineTransposed", BATCHEDVARIANT, ForEachIteration([data]() { Math::ExpandAffineTransposed(data->affineMatrices.data(), data->matrixOutput.data(), BENCHMARKELEMENTS); }));
+			}
+
+			void RegisterQuaternionBenchmarks(BenchmarkSuite& suite, BenchmarkData* data)
+			{
+				auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Quaternion", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+				add("Slerp", SCALARVARIANT, ForEachElement([data](size_t i) { data->rotationOutput[i] = Math::Slerp(data->rotationsA[i], data->rotationsB[i], data->weights[i]); }));
+				add("Slerp", DIRECTXVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4(&data->rotationOutput[i], XMQuaternionSlerp(XMLoadFloat4(&data->rotationsA[i]), XMLoadFloat4(&data->rotationsB[i]), data->weights[i])); }));
+
+				Math::QuaternionSoA from{ data->rotationSoaA[0].data(), data->rotationSoaA[1].data(), data->rotationSoaA[2].data(), data->rotationSoaA[3].data() };
+				Math::QuaternionSoA to{ data->rotationSoaB[0].data(), data->rotationSoaB[1].data(), data->rotationSoaB[2].data(), data->rotationSoaB[3].data() };
+				Math::QuaternionSoA result{ data->soaOutput[0].data(), data->soaOutput[1].data(), data->soaOutput[2].data(), data->soaOutput[3].data() };
+				const float* weights = data->weights.data();
+
+				add("Slerp", BATCHEDVARIANT, ForEachIteration([=]() { Math::SlerpBatch(from, to, weights, 0.0f, result, BENCHMARKELEMENTS); }));
+				add("SlerpApprox", BATCHEDVARIANT, ForEachIteration([=]() { Math::SlerpApproxBatch(from, to, weights, 0.0f, result, BENCHMARKELEMENTS); }));
+				add("NLerp", BATCHEDVARIANT, ForEachIteration([=]() { Math::NLerpBatch(from, to, weights, 0.0f, result, BENCHMARKELEMENTS); }));
+			}
+		}
+
+		void RegisterMathBenchmarks(BenchmarkSuite& suite, BenchmarkData& data)
+		{
+			RegisterScalarBenchmarks(suite, &data);
+			RegisterVector2Benchmarks(suite, &data);
+			RegisterVector3Benchmarks(suite, &data);
+			RegisterVector4Benchmarks(suite, &data);
+			RegisterXMVectorBenchmarks(suite, &data);
+			RegisterMatrixBenchmarks(suite, &data);
+			RegisterQuaternionBenchmarks(suite, &data);
+		}
+	}
+}
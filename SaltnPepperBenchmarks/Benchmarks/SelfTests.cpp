@@ -0,0 +1,556 @@
+﻿#include "BenchmarkData.hpp"
+#include "Core/Components/TransformHierarchy.hpp"
+#include "Core/ECS/CommandBuffer.hpp"
+#include "Core/ECS/World.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include "Utilities/Math/BoundingVolumes.hpp"
+#include "Utilities/Math/DeterministicMath.hpp"
+#include "Utilities/Math/FastTrig.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+#include "Utilities/Math/Noise.hpp"
+#include "Utilities/Math/PackedConversion.hpp"
+#include "Utilities/Math/Random.hpp"
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		namespace
+		{
+			inline static constexpr Math::SimdTier TIERS[] = { Math::SimdTier::SSE42, Math::SimdTier::AVX2, Math::SimdTier::AVX512 };
+
+			/// <summary>
+			/// Runs a check once per tier the CPU supports , the tier picked at startup is restored afterwards
+			/// </summary>
+			template <typename Check>
+			bool ForEachTier(const char* name, Check check)
+			{
+				const Math::SimdTier selected = Math::MathDispatch::GetTier();
+
+				bool passed = true;
+				for (Math::SimdTier tier : TIERS)
+				{
+					if (!Math::MathDispatch::SetTier(tier)) { continue; }
+
+					if (!check())
+					{
+						LOG_ERROR("Self test {0} failed on {1}", name, Math::MathDispatch::GetTierName(tier));
+						passed = false;
+					}
+				}
+
+				Math::MathDispatch::SetTier(selected);
+				return passed;
+			}
+
+			/// <summary>
+			/// Every index runs exactly once , also when each slice submits a ParallelFor of its own (those must run inline , not deadlock)
+			/// </summary>
+			bool VerifyParallelFor()
+			{
+				constexpr size_t COUNT = 100003;
+				constexpr size_t OUTERCOUNT = 64;
+				constexpr size_t INNERCOUNT = 4099;
+
+				std::vector<uint32_t> hits(COUNT, 0);
+				Jobs::JobSystem::ParallelFor(COUNT, 64, [&](size_t begin, size_t end)
+				{
+					for (size_t index = begin; index < end; ++index) { ++hits[index]; }
+				});
+
+				for (size_t index = 0; index < COUNT; ++index)
+				{
+					if (hits[index] != 1)
+					{
+						LOG_ERROR("ParallelFor self test : index {0} ran {1} times", index, hits[index]);
+						return false;
+					}
+				}
+
+				std::vector<uint64_t> sums(OUTERCOUNT, 0);
+				Jobs::JobSystem::ParallelFor(OUTERCOUNT, 1, [&](size_t begin, size_t end)
+				{
+					for (size_t outer = begin; outer < end; ++outer)
+					{
+						Jobs::JobSystem::ParallelFor(INNERCOUNT, 16, [&](size_t innerBegin, size_t innerEnd)
+						{
+							for (size_t inner = innerBegin; inner < innerEnd; ++inner) { sums[outer] += inner; }
+						});
+					}
+				});
+
+				for (size_t outer = 0; outer < OUTERCOUNT; ++outer)
+				{
+					if (sums[outer] != INNERCOUNT * (INNERCOUNT - 1) / 2)
+					{
+						LOG_ERROR("ParallelFor self test : nested range {0} summed to {1}", outer, sums[outer]);
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			/// <summary>
+			/// Two hierarchies get the same random edits , reparents , removals and freezes , one updated serially and one in parallel.
+			/// Wide levels (level split) and long chains under them (deep tail split) both take their parallel paths , the slot arrays have to match bit for bit
+			/// </summary>
+			bool VerifyHierarchy()
+			{
+				constexpr uint32_t ROOTCOUNT = 8;
+				constexpr uint32_t WIDECOUNT = 24000;
+				constexpr uint32_t CHAINCOUNT = 32;
+				constexpr uint32_t CHAINLENGTH = 256;
+				constexpr uint32_t ROUNDCOUNT = 12;
+				constexpr uint32_t EDITCOUNT = 2000;
+				constexpr uint32_t REPARENTCOUNT = 16;
+				constexpr uint32_t REMOVECOUNT = 4;
+				constexpr uint32_t CREATECOUNT = 64;
+
+				Math::RandomGenerator random(Math::DEFAULTRANDOMSEED, 38);
+				Components::TransformHierarchy hierarchies[2];
+				std::vector<Components::TransformHandle> handles;
+				std::vector<Components::TransformHandle> roots;
+
+				auto create = [&](Components::TransformHandle parent)
+				{
+					Components::Transform local;
+					local.localPosition = Vector3(random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f));
+					local.localScale = Vector3(random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f), random.Range(0.5f, 2.0f));
+
+					const Vector3 axis = random.OnSphere();
+					XMStoreFloat4(&local.localRotation, XMQuaternionRotationAxis(XMLoadFloat3(&axis), random.Range(-PI, PI)));
+
+					const Components::TransformHandle node = hierarchies[0].Create(local, parent);
+					hierarchies[1].Create(local, parent);
+					handles.push_back(node);
+					return node;
+				};
+
+				// A live node picked at random , removed subtrees leave their handles behind in the list
+				auto pick = [&]()
+				{
+					Components::TransformHandle node = handles[random.NextBounded(static_cast<uint32_t>(handles.size()))];
+					while (!hierarchies[0].IsValid(node)) { node = handles[random.NextBounded(static_cast<uint32_t>(handles.size()))]; }
+					return node;
+				};
+
+				// Wide trees three levels deep , then chains hanging off random nodes of the bottom level
+				for (uint32_t root = 0; root < ROOTCOUNT; ++root) { roots.push_back(create(Components::TransformHandle{})); }
+				for (uint32_t index = 0; index < WIDECOUNT; ++index) { create(roots[index % ROOTCOUNT]); }
+				for (uint32_t index = 0; index < WIDECOUNT; ++index) { create(handles[ROOTCOUNT + random.NextBounded(WIDECOUNT)]); }
+				for (uint32_t chain = 0; chain < CHAINCOUNT; ++chain)
+				{
+					Components::TransformHandle node = handles[ROOTCOUNT + WIDECOUNT + random.NextBounded(WIDECOUNT)];
+					for (uint32_t link = 0; link < CHAINLENGTH; ++link) { node = create(node); }
+				}
+
+				for (uint32_t round = 0; round <= ROUNDCOUNT; ++round)
+				{
+					// Round 0 is the initial build , every other one changes a bit of everything (the last one nothing , only flags to clear)
+					if (round > 0 && round < ROUNDCOUNT)
+					{
+						for (uint32_t edit = 0; edit < EDITCOUNT; ++edit)
+						{
+							const Components::TransformHandle node = pick();
+							const Vector3 value(random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f), random.Range(-10.0f, 10.0f));
+							for (Components::TransformHierarchy& hierarchy : hierarchies) { hierarchy.SetLocalPosition(node, value); }
+						}
+
+						for (uint32_t reparent = 0; reparent < REPARENTCOUNT; ++reparent)
+						{
+							const Components::TransformHandle node = pick();
+							const Components::TransformHandle parent = random.NextBounded(8) == 0 ? Components::TransformHandle{} : pick();
+							const bool keepWorldTransform = random.NextBounded(2) == 0;
+							if (hierarchies[0].SetParent(node, parent, keepWorldTransform) != hierarchies[1].SetParent(node, parent, keepWorldTransform))
+							{
+								LOG_ERROR("Hierarchy self test : SetParent disagreed in round {0}", round);
+								return false;
+							}
+						}
+
+						for (uint32_t remove = 0; remove < REMOVECOUNT; ++remove)
+						{
+							const Components::TransformHandle node = pick();
+							for (Components::TransformHierarchy& hierarchy : hierarchies) { hierarchy.Remove(node); }
+						}
+
+						for (uint32_t index = 0; index < CREATECOUNT; ++index) { create(random.NextBounded(4) == 0 ? Components::TransformHandle{} : pick()); }
+
+						// A wide tree gets frozen for one round of edits and then thawed again , plus a random node thawed out of whatever is frozen
+						const Components::TransformHandle root = roots[(round / 2) % ROOTCOUNT];
+						for (Components::TransformHierarchy& hierarchy : hierarchies)
+						{
+							if (!hierarchy.IsValid(root)) { continue; }
+							if (round % 2 == 0) { hierarchy.Freeze(root); }
+							else { hierarchy.Unfreeze(root); }
+						}
+
+						const Components::TransformHandle thawed = pick();
+						for (Components::TransformHierarchy& hierarchy : hierarchies) { hierarchy.Unfreeze(thawed); }
+					}
+
+					hierarchies[0].Update(false);
+					hierarchies[1].Update(true);
+
+					const Components::TransformHierarchy& serial = hierarchies[0];
+					const Components::TransformHierarchy& parallel = hierarchies[1];
+					const size_t count = serial.GetCount();
+
+					if (parallel.GetCount() != count || parallel.GetFrozenCount() != serial.GetFrozenCount() ||
+						std::memcmp(serial.GetParentSlots(), parallel.GetParentSlots(), count * sizeof(uint32_t)) != 0)
+					{
+						LOG_ERROR("Hierarchy self test : slot layout differs after round {0}", round);
+						return false;
+					}
+
+					if (std::memcmp(serial.GetWorldMatrices(), parallel.GetWorldMatrices(), count * sizeof(Components::Transform::WorldMatrix)) != 0 ||
+						std::memcmp(serial.GetFlags(), parallel.GetFlags(), count * sizeof(uint8_t)) != 0)
+					{
+						LOG_ERROR("Hierarchy self test : parallel update differs from the serial one after round {0}", round);
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			struct SmallComponent
+			{
+				uint32_t value = 0;
+			};
+
+			// A chunk holds a few hundred of these , so the test entities spread over several chunks per archetype
+			struct WideComponent
+			{
+				uint32_t value = 0;
+				uint32_t padding[15] = {};
+			};
+
+			/// <summary>
+			/// Non trivial component owning its value on the heap. Counts its live instances , so a value the command buffer or
+			/// the world leaks or destroys twice shows up in the count (and a moved from one reads back as INVALIDVALUE)
+			/// </summary>
+			struct OwnedComponent
+			{
+				inline static constexpr uint32_t INVALIDVALUE = UINT32_MAX;
+				inline static std::atomic<int64_t> liveCount{ 0 };
+
+				OwnedComponent() : value(std::make_unique<uint32_t>(0)) { ++liveCount; }
+				explicit OwnedComponent(uint32_t number) : value(std::make_unique<uint32_t>(number)) { ++liveCount; }
+				OwnedComponent(const OwnedComponent& other) : value(std::make_unique<uint32_t>(other.Get())) { ++liveCount; }
+				OwnedComponent(OwnedComponent&& other) noexcept : value(std::move(other.value)) { ++liveCount; }
+				~OwnedComponent() { --liveCount; }
+
+				OwnedComponent& operator=(const OwnedComponent& other)
+				{
+					value = std::make_unique<uint32_t>(other.Get());
+					return *this;
+				}
+				OwnedComponent& operator=(OwnedComponent&& other) noexcept = default;
+
+				uint32_t Get() const { return value != nullptr ? *value : INVALIDVALUE; }
+
+				std::unique_ptr<uint32_t> value;
+			};
+
+			/// <summary>
+			/// Random command batches played back into a World , checked against a model that applies every entity's commands
+			/// one by one in recording order : spawns , destroys , adds , removes and sets of trivial and owned components , commands
+			/// on dead entities and on stand in ids of earlier batches , several lanes recording at once and a Clear. After every
+			/// Playback the world has to hold exactly the model's entities and values , and as many owned values as the model
+			/// </summary>
+			bool VerifyCommandBuffer()
+			{
+				constexpr uint32_t KINDCOUNT = 3;
+				constexpr uint32_t ROUNDCOUNT = 24;
+				constexpr uint32_t OPERATIONCOUNT = 3000;
+				constexpr uint32_t JOBCOUNT = 2048;
+				constexpr uint32_t STALECOUNT = 1;
+
+				enum class Operation : uint32_t { ADD, REMOVE, SET };
+
+				struct ModelEntity
+				{
+					// Stand in id until the Playback resolves it
+					ECS::Entity entity;
+					bool pending = true;
+					bool alive = true;
+					bool has[KINDCOUNT] = {};
+					uint32_t values[KINDCOUNT] = {};
+				};
+
+				Math::RandomGenerator random(Math::DEFAULTRANDOMSEED, 43);
+				std::vector<ModelEntity> model;
+				std::vector<ECS::Entity> staleIds;
+
+				auto record = [](ECS::CommandBuffer& commands, Operation operation, uint32_t kind, ECS::Entity entity, uint32_t value)
+				{
+					switch (operation)
+					{
+					case Operation::ADD:
+						if (kind == 0) { commands.Add(entity, SmallComponent{ value }); }
+						else if (kind == 1) { commands.Add(entity, WideComponent{ value }); }
+						else { commands.Add(entity, OwnedComponent(value)); }
+						break;
+
+					case Operation::REMOVE:
+						if (kind == 0) { commands.Remove<SmallComponent>(entity); }
+						else if (kind == 1) { commands.Remove<WideComponent>(entity); }
+						else { commands.Remove<OwnedComponent>(entity); }
+						break;
+
+					case Operation::SET:
+						if (kind == 0) { commands.Set(entity, SmallComponent{ value }); }
+						else if (kind == 1) { commands.Set(entity, WideComponent{ value }); }
+						else { commands.Set(entity, OwnedComponent(value)); }
+						break;
+					}
+				};
+
+				auto apply = [](ModelEntity& target, Operation operation, uint32_t kind, uint32_t value)
+				{
+					if (!target.alive) { return; }
+
+					switch (operation)
+					{
+					case Operation::ADD:
+						target.has[kind] = true;
+						target.values[kind] = value;
+						break;
+
+					case Operation::REMOVE:
+						target.has[kind] = false;
+						break;
+
+					case Operation::SET:
+						if (target.has[kind]) { target.values[kind] = value; }
+						break;
+					}
+				};
+
+				{
+					ECS::World world;
+					ECS::CommandBuffer commands;
+
+					for (uint32_t round = 0; round < ROUNDCOUNT; ++round)
+					{
+						// Every fourth round starts with a batch that gets thrown away , none of it may reach the world
+						if (round % 4 == 3)
+						{
+							for (uint32_t index = 0; index < OPERATIONCOUNT / 8; ++index)
+							{
+								const ECS::Entity spawned = commands.Spawn(OwnedComponent(index));
+								record(commands, Operation::ADD, index % KINDCOUNT, spawned, index);
+								if (!model.empty()) { record(commands, Operation::ADD, index % KINDCOUNT, model[random.NextBounded(static_cast<uint32_t>(model.size()))].entity, index); }
+								if (index < STALECOUNT) { staleIds.push_back(spawned); }
+							}
+							commands.Clear();
+
+							if (commands.Resolve(staleIds.back()) != ECS::NULLENTITY)
+							{
+								LOG_ERROR("CommandBuffer self test : a stand in id of a cleared batch resolved in round {0}", round);
+								return false;
+							}
+						}
+
+						// Ids kept past their batch , whatever gets recorded on them is dropped (taken for a spawn it would add an entity)
+						for (ECS::Entity stale : staleIds) { record(commands, Operation::ADD, random.NextBounded(KINDCOUNT), stale, round); }
+						staleIds.clear();
+
+						const size_t firstSpawn = model.size();
+						if (round % 3 == 2 && model.size() >= JOBCOUNT)
+						{
+							// Several lanes at once : every job spawns an entity and sets components on an entity no other job touches
+							const uint32_t offset = random.NextBounded(static_cast<uint32_t>(model.size()));
+							std::vector<ECS::Entity> spawns(JOBCOUNT);
+							Jobs::JobSystem::ParallelFor(JOBCOUNT, 64, [&](size_t begin, size_t end)
+							{
+								for (size_t index = begin; index < end; ++index)
+								{
+									const uint32_t value = round * JOBCOUNT + static_cast<uint32_t>(index);
+									spawns[index] = commands.Spawn(SmallComponent{ value }, OwnedComponent(value));
+
+									const ECS::Entity target = model[(offset + index) % model.size()].entity;
+									commands.Set(target, SmallComponent{ value });
+									commands.Set(target, OwnedComponent(value));
+								}
+							});
+
+							for (uint32_t index = 0; index < JOBCOUNT; ++index)
+							{
+								const uint32_t value = round * JOBCOUNT + index;
+
+								ModelEntity& target = model[(offset + index) % model.size()];
+								apply(target, Operation::SET, 0, value);
+								apply(target, Operation::SET, 2, value);
+							}
+							for (uint32_t index = 0; index < JOBCOUNT; ++index)
+							{
+								const uint32_t value = round * JOBCOUNT + index;
+
+								ModelEntity spawned;
+								spawned.entity = spawns[index];
+								spawned.has[0] = spawned.has[2] = true;
+								spawned.values[0] = spawned.values[2] = value;
+								model.push_back(spawned);
+							}
+						}
+						else
+						{
+							for (uint32_t index = 0; index < OPERATIONCOUNT; ++index)
+							{
+								const uint32_t choice = model.empty() ? 0 : random.NextBounded(10);
+								if (choice < 3)
+								{
+									ModelEntity spawned;
+									spawned.entity = choice == 0 ? commands.Spawn(WideComponent{ index }, OwnedComponent(index)) : commands.Spawn();
+									spawned.has[1] = spawned.has[2] = choice == 0;
+									spawned.values[1] = spawned.values[2] = index;
+									model.push_back(spawned);
+									continue;
+								}
+
+								ModelEntity& target = model[random.NextBounded(static_cast<uint32_t>(model.size()))];
+								if (choice == 3)
+								{
+									commands.Destroy(target.entity);
+									target.alive = false;
+									continue;
+								}
+
+								const Operation operation = static_cast<Operation>((choice - 4) % 3);
+								const uint32_t kind = random.NextBounded(KINDCOUNT);
+								const uint32_t value = random.NextUInt() & 0xFFFFFF;
+								record(commands, operation, kind, target.entity, value);
+								apply(target, operation, kind, value);
+							}
+						}
+
+						// Kept for the batch that throws one away (the LOG_WARN on every dropped id is expected)
+						const bool keepStale = round % 4 == 2;
+						for (size_t index = firstSpawn; keepStale && index < model.size() && staleIds.size() < STALECOUNT; ++index) { staleIds.push_back(model[index].entity); }
+
+						commands.Playback(world);
+
+						const ECS::World& constWorld = world;
+						size_t aliveCount = 0;
+						int64_t ownedCount = 0;
+						for (size_t index = 0; index < model.size(); ++index)
+						{
+							ModelEntity& expected = model[index];
+							if (expected.pending)
+							{
+								expected.entity = commands.Resolve(expected.entity);
+								expected.pending = false;
+
+								if ((expected.entity != ECS::NULLENTITY) != expected.alive)
+								{
+									LOG_ERROR("CommandBuffer self test : spawn {0} resolved wrongly in round {1}", index, round);
+									return false;
+								}
+							}
+
+							if (world.IsAlive(expected.entity) != expected.alive)
+							{
+								LOG_ERROR("CommandBuffer self test : entity {0} is {1} after round {2}", index, expected.alive ? "dead" : "alive", round);
+								return false;
+							}
+							if (!expected.alive) { continue; }
+
+							const SmallComponent* small = constWorld.Get<SmallComponent>(expected.entity);
+							const WideComponent* wide = constWorld.Get<WideComponent>(expected.entity);
+							const OwnedComponent* owned = constWorld.Get<OwnedComponent>(expected.entity);
+							const bool has[KINDCOUNT] = { small != nullptr, wide != nullptr, owned != nullptr };
+							const uint32_t values[KINDCOUNT] = { has[0] ? small->value : 0, has[1] ? wide->value : 0, has[2] ? owned->Get() : 0 };
+
+							for (uint32_t kind = 0; kind < KINDCOUNT; ++kind)
+							{
+								if (has[kind] != expected.has[kind] || (has[kind] && values[kind] != expected.values[kind]))
+								{
+									LOG_ERROR("CommandBuffer self test : entity {0} component {1} doesn't match the model after round {2}", index, kind, round);
+									return false;
+								}
+							}
+
+							++aliveCount;
+							ownedCount += expected.has[2] ? 1 : 0;
+						}
+
+						if (world.GetEntityCount() != aliveCount || OwnedComponent::liveCount != ownedCount)
+						{
+							LOG_ERROR("CommandBuffer self test : {0} entities / {1} owned values after round {2} , the model has {3} / {4}",
+								world.GetEntityCount(), OwnedComponent::liveCount.load(), round, aliveCount, ownedCount);
+							return false;
+						}
+					}
+
+					world.Clear();
+					if (OwnedComponent::liveCount != 0)
+					{
+						LOG_ERROR("CommandBuffer self test : {0} owned values left after World::Clear", OwnedComponent::liveCount.load());
+						return false;
+					}
+
+					// Left for the destructor , which has to destroy them
+					for (uint32_t index = 0; index < OPERATIONCOUNT / 8; ++index) { commands.Spawn(OwnedComponent(index)); }
+				}
+
+				if (OwnedComponent::liveCount != 0)
+				{
+					LOG_ERROR("CommandBuffer self test : {0} owned values left after destroying the buffer", OwnedComponent::liveCount.load());
+					return false;
+				}
+
+				return true;
+			}
+		}
+
+		bool RunSelfTests()
+		{
+			bool passed = ForEachTier("FastTrig", []() { return Math::VerifyTrig(); });
+			passed &= ForEachTier("PackedConversion", []() { return Math::VerifyPackedConversion(); });
+			passed &= ForEachTier("Noise", []() { return Math::VerifyNoise(); });
+			passed &= ForEachTier("Bounds", []() { return Math::VerifyBounds(); });
+
+			if (!VerifyParallelFor())
+			{
+				LOG_ERROR("Self test ParallelFor failed");
+				passed = false;
+			}
+
+			if (!VerifyHierarchy())
+			{
+				LOG_ERROR("Self test Hierarchy failed");
+				passed = false;
+			}
+
+			if (!VerifyCommandBuffer())
+			{
+				LOG_ERROR("Self test CommandBuffer failed");
+				passed = false;
+			}
+
+			// Integer only , the tier can't affect it , but the compiler and configuration can if anything regresses
+			if (!Math::Deterministic::VerifyDeterminism())
+			{
+				LOG_ERROR("Self test Deterministic failed");
+				passed = false;
+			}
+
+			if (!passed)
+			{
+				LOG_ERROR("Self tests FAILED , the benchmark numbers would not mean anything");
+				return false;
+			}
+
+			LOG_INFO("Self tests passed");
+			return true;
+		}
+	}
+}
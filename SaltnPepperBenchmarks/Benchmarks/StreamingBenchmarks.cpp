@@ -0,0 +1,134 @@
+#include "BenchmarkData.hpp"
+#include "Core/ECS/World.hpp"
+#include "Core/Scene/WorldPartition.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include "Utilities/Math/Random.hpp"
+#include "Utilities/Time/Timer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		using Profiling::BenchmarkFunction;
+		using Profiling::BenchmarkSuite;
+
+		namespace
+		{
+			// 64 x 64 cells of 64 m with CELLENTITIES entities each , a 4 km square world of 4M entities
+			inline static constexpr int32_t WORLDCELLS = 64;
+			inline static constexpr float CELLSIZE = 64.0f;
+			inline static constexpr uint32_t CELLENTITIES = 1024;
+
+			inline static constexpr float STREAMINGRADIUS = 320.0f;
+
+			// Metres the camera flies per frame , fast enough that new cells arrive every few frames
+			inline static constexpr float FLIGHTSPEED = 8.0f;
+
+			/// <summary>
+			/// Synthetic world streamed around a camera flying a closed loop over it. Cells are generated on the streaming
+			/// thread instead of read from disk , so the case measures the main thread's share : ranking , merging and unloading
+			/// </summary>
+			struct StreamingScene
+			{
+				explicit StreamingScene(uint32_t budget) : mergeBudget(budget)
+				{
+					Scene::WorldPartitionSettings settings;
+					settings.cellSize = CELLSIZE;
+					settings.mergeBudget = mergeBudget;
+					partition = std::make_unique<Scene::WorldPartition>(world, settings);
+
+					partition->SetLoadFunction([](Scene::CellCoord cell, const std::string&, Scene::CellContent& content)
+					{
+						// Seeded per cell , a cell comes back the same every time it streams in
+						Math::RandomGenerator random(Math::DEFAULTRANDOMSEED, (static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32) | static_cast<uint32_t>(cell.z));
+						content.storage.resize(CELLENTITIES);
+						for (Components::Transform& transform : content.storage)
+						{
+							transform.localPosition = Vector3(
+								(static_cast<float>(cell.x) + random.Range(0.0f, 1.0f)) * CELLSIZE,
+								random.Range(0.0f, 16.0f),
+								(static_cast<float>(cell.z) + random.Range(0.0f, 1.0f)) * CELLSIZE);
+						}
+
+						content.transforms = content.storage.data();
+						content.count = content.storage.size();
+						return true;
+					});
+
+					for (int32_t z = 0; z < WORLDCELLS; ++z)
+					{
+						for (int32_t x = 0; x < WORLDCELLS; ++x) { partition->AddCell(Scene::CellCoord{ x, z }, std::string(), CELLENTITIES * sizeof(Components::Transform)); }
+					}
+
+					// Start with the first frame's surroundings in , the way a level loads behind a loading screen
+					Advance();
+					partition->Flush(&source, 1);
+				}
+
+				~StreamingScene()
+				{
+					LOG_INFO("Streaming : merge budget {0} , worst frame {1:.3f} ms , {2} entities resident", mergeBudget, worstFrame * 1000.0, world.GetEntityCount());
+				}
+
+				/// <summary>
+				/// Moves the camera along a Lissajous loop that crosses the middle of the world and stays clear of its edges
+				/// </summary>
+				void Advance()
+				{
+					const float half = WORLDCELLS * CELLSIZE * 0.5f;
+					const float reach = half - STREAMINGRADIUS - CELLSIZE;
+					const float angle = distance / (reach * 4.0f);
+
+					source.position = Vector3(half + reach * std::sin(angle * 3.0f), 50.0f, half + reach * std::sin(angle * 2.0f));
+					source.loadRadius = STREAMINGRADIUS;
+					distance += FLIGHTSPEED;
+				}
+
+				void Frame()
+				{
+					const TimeStamp start = Timer::Now();
+
+					Advance();
+					partition->Update(&source, 1);
+
+					const std::chrono::duration<double> frame = Timer::Now() - start;
+					worstFrame = std::max(worstFrame, frame.count());
+				}
+
+				uint32_t mergeBudget;
+				ECS::World world;
+				std::unique_ptr<Scene::WorldPartition> partition;
+				Scene::StreamingSource source;
+				float distance = 0.0f;
+				double worstFrame = 0.0;
+			};
+		}
+
+		void RegisterStreamingBenchmarks(BenchmarkSuite& suite, BenchmarkData& benchmarkData)
+		{
+			(void)benchmarkData;
+
+			// One operation is one frame of the flight. Scalar merges every cell into the world the frame its load completes ,
+			// Batched spreads it over frames within the default merge budget. The worst single frame of each is logged at exit
+			for (const bool budgeted : { false, true })
+			{
+				auto scene = std::make_shared<std::unique_ptr<StreamingScene>>();
+				const uint32_t mergeBudget = budgeted ? Scene::WorldPartitionSettings{}.mergeBudget : UINT32_MAX;
+
+				suite.Add("Streaming", "FlyThrough", budgeted ? BATCHEDVARIANT : SCALARVARIANT, 1, [scene, mergeBudget](uint64_t iterations)
+				{
+					if (!*scene) { *scene = std::make_unique<StreamingScene>(mergeBudget); }
+
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						(*scene)->Frame();
+						Profiling::KeepAlive(iteration);
+					}
+				});
+			}
+		}
+	}
+}
@@ -0,0 +1,222 @@
+#include "BenchmarkData.hpp"
+#include "Core/Components/TransformInterpolation.hpp"
+#include "Core/Components/TransformJournal.hpp"
+#include "Core/Components/TransformReflection.hpp"
+#include "Utilities/Math/Random.hpp"
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Benchmarks
+	{
+		using Profiling::BenchmarkFunction;
+		using Profiling::BenchmarkSuite;
+
+		namespace
+		{
+			// Transforms in the change journal scene , one in JOURNALCHANGERATE of them moves per frame
+			inline static constexpr uint32_t JOURNALCOUNT = 1000000;
+			inline static constexpr uint32_t JOURNALCHANGERATE = 100;
+
+			/// <summary>
+			/// A frame's worth of scattered writes , the same ids every iteration so both variants see the same work
+			/// </summary>
+			struct JournalScene
+			{
+				void Build()
+				{
+					if (!transforms.empty()) { return; }
+
+					Math::RandomGenerator random(Math::DEFAULTRANDOMSEED, JOURNALCOUNT);
+					transforms.resize(JOURNALCOUNT);
+					for (Components::Transform& transform : transforms) { transform.SetDirty(false); }
+					for (uint32_t change = 0; change < JOURNALCOUNT / JOURNALCHANGERATE; ++change) { changedIds.push_back(random.NextBounded(JOURNALCOUNT)); }
+
+					journal = Memory::MakeUnique<Components::TransformJournal>(JOURNALCOUNT);
+				}
+
+				std::vector<Components::Transform> transforms;
+				std::vector<uint32_t> changedIds;
+				Memory::UniquePtr<Components::TransformJournal> journal;
+				Vector3 sum = Vector3{ 0.0f,0.0f,0.0f };
+			};
+
+			/// <summary>
+			/// What the reflected copy replaces : a serializer object per field , called through its vtable
+			/// </summary>
+			struct FieldSerializer
+			{
+				virtual ~FieldSerializer() = default;
+				virtual uint8_t* Write(const Components::Transform& transform, uint8_t* output) const = 0;
+			};
+
+			template <typename T>
+			struct MemberSerializer : FieldSerializer
+			{
+				explicit MemberSerializer(T Components::Transform::* member) : member(member) {}
+
+				uint8_t* Write(const Components::Transform& transform, uint8_t* output) const override
+				{
+					std::memcpy(output, &(transform.*member), sizeof(T));
+					return output + sizeof(T);
+				}
+
+				T Components::Transform::* member;
+			};
+		}
+
+		void RegisterTransformBenchmarks(BenchmarkSuite& suite, BenchmarkData& benchmarkData)
+		{
+			BenchmarkData* data = &benchmarkData;
+			auto add = [&suite](const char* name, const char* variant, BenchmarkFunction function) { suite.Add("Transform", name, variant, BENCHMARKELEMENTS, std::move(function)); };
+
+			add("GetPosition", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = data->transforms[i].GetPosition(); }));
+
+			// GetScale / GetRotation load the world TRS cached at update time. GetRotation/DirectXMath is the XMMatrixDecompose
+			// every call used to run , the GetScale variants rebuild the scale from the matrix rows
+			add("GetScale", SCALARVARIANT, ForEachElement([data](size_t i) { data->vector3Output[i] = data->transforms[i].GetScale(); }));
+			add("GetScale", DIRECTXVARIANT, ForEachElement([data](size_t i)
+			{
+				const XMMATRIX world = data->transforms[i].GetWorldMatrixRaw();
+				XMStoreFloat3(&data->vector3Output[i], XMVectorSet(XMVectorGetX(XMVector3Length(world.r[0])), XMVectorGetX(XMVector3Length(world.r[1])), XMVectorGetX(XMVector3Length(world.r[2])), 0.0f));
+			}));
+			add("GetScale", BATCHEDVARIANT, ForEachElement([data](size_t i)
+			{
+				// Row lengths straight from the stored matrix (valid without shear , which is what Decompose assumes too)
+				const Matrix world = data->transforms[i].GetWorldMatrix();
+				data->soaOutput[0][i] = std::sqrt(world._11 * world._11 + world._12 * world._12 + world._13 * world._13);
+				data->soaOutput[1][i] = std::sqrt(world._21 * world._21 + world._22 * world._22 + world._23 * world._23);
+				data->soaOutput[2][i] = std::sqrt(world._31 * world._31 + world._32 * world._32 + world._33 * world._33);
+			}));
+			add("GetRotation", SCALARVARIANT, ForEachElement([data](size_t i) { data->rotationOutput[i] = data->transforms[i].GetRotation(); }));
+			add("GetRotation", DIRECTXVARIANT, ForEachElement([data](size_t i)
+			{
+				XMVECTOR scale = XMVectorZero();
+				XMVECTOR rotation = XMQuaternionIdentity();
+				XMVECTOR translation = XMVectorZero();
+				XMMatrixDecompose(&scale, &rotation, &translation, data->transforms[i].GetWorldMatrixRaw());
+				XMStoreFloat4(&data->rotationOutput[i], rotation);
+			}));
+
+			add("GetScaleRaw", SCALARVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], data->transforms[i].GetScaleRaw()); }));
+			add("GetRotationRaw", SCALARVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4(&data->rotationOutput[i], data->transforms[i].GetRotationRaw()); }));
+
+			add("GetForwardRaw", SCALARVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], data->transforms[i].GetForwardRaw()); }));
+			add("GetRightRaw", SCALARVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], data->transforms[i].GetRightRaw()); }));
+			add("GetUpRaw", SCALARVARIANT, ForEachElement([data](size_t i) { XMStoreFloat3(&data->vector3Output[i], data->transforms[i].GetUpRaw()); }));
+
+			// Local matrix : S * R * T as three matrix products against the single affine build
+			add("GetlocalMatrix", SCALARVARIANT, ForEachElement([data](size_t i) { data->matrixOutput[i] = data->transforms[i].GetlocalMatrix(); }));
+			add("GetlocalMatrixRaw", SCALARVARIANT, ForEachElement([data](size_t i) { XMStoreFloat4x4(&data->matrixOutput[i], data->transforms[i].GetlocalMatrixRaw()); }));
+			add("GetlocalMatrixRaw", DIRECTXVARIANT, ForEachElement([data](size_t i)
+			{
+				const Components::Transform& transform = data->transforms[i];
+				const XMMATRIX local = XMMatrixAffineTransformation(XMLoadFloat3(&transform.localScale), XMVectorZero(), XMLoadFloat4(&transform.localRotation), XMLoadFloat3(&transform.localPosition));
+				XMStoreFloat4x4(&data->matrixOutput[i], local);
+			}));
+
+			// Includes refreshing the cached world TRS
+			add("UpdateTransform", SCALARVARIANT, ForEachElement([data](size_t i)
+			{
+				Components::Transform transform = data->transforms[i];
+				transform.SetDirty();
+				transform.UpdateTransform();
+				data->matrixOutput[i] = transform.GetWorldMatrix();
+			}));
+
+			add("UpdateParentTransform", SCALARVARIANT, ForEachElement([data](size_t i)
+			{
+				// Works on a copy so repeated runs don't keep compounding the parent scale
+				Components::Transform transform = data->transforms[i];
+				transform.UpdateParentTransform(data->transforms[(i + 1) % BENCHMARKELEMENTS]);
+				data->matrixOutput[i] = transform.GetWorldMatrix();
+			}));
+
+			// Render interpolation between two fixed steps (transform i blends towards transform i + 1) : per object lerp / slerp /
+			// affine build on the cached world TRS against the batched pass over the SoA interpolation buffer
+			constexpr float INTERPOLATIONALPHA = 0.37f;
+
+			add("Interpolate", DIRECTXVARIANT, ForEachElement([data](size_t i)
+			{
+				const Components::Transform& previous = data->transforms[i];
+				const Components::Transform& current = data->transforms[(i + 1) % BENCHMARKELEMENTS];
+
+				const XMVECTOR position = XMVectorLerp(previous.GetPositionRaw(), current.GetPositionRaw(), INTERPOLATIONALPHA);
+				const XMVECTOR rotation = XMQuaternionSlerp(previous.GetRotationRaw(), current.GetRotationRaw(), INTERPOLATIONALPHA);
+				const XMVECTOR scale = XMVectorLerp(previous.GetScaleRaw(), current.GetScaleRaw(), INTERPOLATIONALPHA);
+				XMStoreFloat4x4(&data->matrixOutput[i], XMMatrixAffineTransformation(scale, XMVectorZero(), rotation, position));
+			}));
+
+			auto interpolation = std::make_shared<Components::TransformInterpolation>(BENCHMARKELEMENTS);
+			interpolation->Capture(0, data->transforms.data(), BENCHMARKELEMENTS);
+			interpolation->BeginStep();
+			interpolation->Capture(0, data->transforms.data() + 1, BENCHMARKELEMENTS - 1);
+			interpolation->Capture(BENCHMARKELEMENTS - 1, data->transforms.data(), 1);
+
+			add("Interpolate", BATCHEDVARIANT, ForEachIteration([data, interpolation]() { interpolation->Interpolate(INTERPOLATIONALPHA, data->matrixOutput.data(), false); }));
+
+			// Serializing the saved fields (flags , local TRS) into a packed stream : a virtual call per field against the
+			// reflected field list , which collapses to one fixed size memcpy per transform
+			constexpr uint32_t PACKEDSIZE = Reflection::Layout<Components::Transform>::PACKEDSIZE;
+			auto stream = std::make_shared<std::vector<uint8_t>>(BENCHMARKELEMENTS * PACKEDSIZE);
+
+			auto serializers = std::make_shared<std::vector<Memory::UniquePtr<FieldSerializer>>>();
+			serializers->push_back(Memory::MakeUnique<MemberSerializer<uint32_t>>(&Components::Transform::flags));
+			serializers->push_back(Memory::MakeUnique<MemberSerializer<Vector3>>(&Components::Transform::localPosition));
+			serializers->push_back(Memory::MakeUnique<MemberSerializer<Vector3>>(&Components::Transform::localScale));
+			serializers->push_back(Memory::MakeUnique<MemberSerializer<Quaternion>>(&Components::Transform::localRotation));
+
+			add("Serialize", SCALARVARIANT, ForEachElement([data, stream, serializers](size_t i)
+			{
+				uint8_t* output = stream->data() + i * PACKEDSIZE;
+				for (const Memory::UniquePtr<FieldSerializer>& serializer : *serializers) { output = serializer->Write(data->transforms[i], output); }
+			}));
+			add("Serialize", BATCHEDVARIANT, ForEachElement([data, stream](size_t i) { Reflection::WriteFields(data->transforms[i], stream->data() + i * PACKEDSIZE); }));
+
+			// Finding the transforms that changed this frame (one operation is one transform in the scene) : scanning all of them
+			// for IsDirty against walking the journal the writes were recorded into , the writes themselves are in both
+			auto journalScene = std::make_shared<JournalScene>();
+			suite.Add("Transform", "ChangedSet", SCALARVARIANT, JOURNALCOUNT, [journalScene](uint64_t iterations)
+			{
+				JournalScene& scene = *journalScene;
+				scene.Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					for (uint32_t id : scene.changedIds)
+					{
+						scene.transforms[id].localPosition.x += 1.0f;
+						scene.transforms[id].SetDirty();
+					}
+
+					for (Components::Transform& transform : scene.transforms)
+					{
+						if (!transform.IsDirty()) { continue; }
+
+						scene.sum.x += transform.localPosition.x;
+						transform.SetDirty(false);
+					}
+					Profiling::KeepAlive(iteration);
+				}
+			});
+			suite.Add("Transform", "ChangedSet", BATCHEDVARIANT, JOURNALCOUNT, [journalScene](uint64_t iterations)
+			{
+				JournalScene& scene = *journalScene;
+				scene.Build();
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					for (uint32_t id : scene.changedIds)
+					{
+						scene.transforms[id].localPosition.x += 1.0f;
+						scene.journal->Record(id);
+					}
+
+					scene.journal->EndFrame();
+					for (const Components::TransformChange& change : scene.journal->GetChanges()) { scene.sum.x += scene.transforms[change.id].localPosition.x; }
+					Profiling::KeepAlive(iteration);
+				}
+			});
+		}
+	}
+}
@@ -6,62 +6,70 @@ namespace SaltnPepperEngine
 	{
 		const Vector3 Transform::GetPosition() const
 		{
-			return *((Vector3*)&worldMatrix._41);
+			return world.position;
 		}
 
 		const Vector3 Transform::GetScale() const
 		{
-			Vector3 scale{1.0f,1.0f,1.0f};
-			XMStoreFloat3(&scale, GetScaleRaw());
-			return scale;
-
+			return world.scale;
 		}
 
 		const Quaternion Transform::GetRotation() const
 		{
-			Quaternion rot{ 0.0f,0.0f,0.0f,1.0f };
-			XMStoreFloat4(&rot, GetRotationRaw());
-			return rot;
+			return world.rotation;
 		}
 
 		const XMVECTOR Transform::GetPositionRaw() const
 		{
-			return XMLoadFloat3((Vector3*)&worldMatrix._41);
+			return XMLoadFloat3(&world.position);
 		}
 
 		const XMVECTOR Transform::GetScaleRaw() const
 		{
-			XMVECTOR Scale;
-			XMVECTOR Rotation;
-			XMVECTOR Translation;
-
-			XMMatrixDecompose(&Scale, &Rotation, &Translation, XMLoadFloat4x4(&worldMatrix));
-			return Scale;
+			return XMLoadFloat3(&world.scale);
 		}
 
 		const XMVECTOR Transform::GetRotationRaw() const
+		{
+			return XMLoadFloat4(&world.rotation);
+		}
+
+		const Matrix Transform::GetWorldMatrix() const
+		{
+			return Math::ToMatrix(world.matrix);
+		}
+
+		const XMMATRIX Transform::GetWorldMatrixRaw() const
+		{
+			return Math::LoadMatrix(world.matrix);
+		}
+
+		void Transform::DecomposeWorldMatrix(Vector3& outPosition, Quaternion& outRotation, Vector3& outScale) const
 		{
 			XMVECTOR Scale;
 			XMVECTOR Rotation;
 			XMVECTOR Translation;
 
-			XMMatrixDecompose(&Scale, &Rotation, &Translation, XMLoadFloat4x4(&worldMatrix));
-			return Rotation;
+			XMMatrixDecompose(&Scale, &Rotation, &Translation, Math::LoadMatrix(world.matrix));
+
+			XMStoreFloat3(&outScale, Scale);
+			XMStoreFloat4(&outRotation, Rotation);
+			XMStoreFloat3(&outPosition, Translation);
 		}
 
 		inline const Vector3 Transform::GetForward() const
 		{
-			return Math::GetForward(worldMatrix);
+			return Math::GetForward(world.matrix);
 		}
 
 		inline const Vector3 Transform::GetRight() const
 		{
-			return Math::GetRight(worldMatrix);
+			return Math::GetRight(world.matrix);
 		}
 
 		inline const Vector3 Transform::GetUp() const
 		{
-			return Math::GetUp(worldMatrix);
+			return Math::GetUp(world.matrix);
 		}
 
 		const XMVECTOR Transform::GetForwardRaw() const
@@ -157,15 +165,28 @@ namespace SaltnPepperEngine
 			if (!IsDirty()) return;
 
 			SetDirty(false);
-			XMStoreFloat4x4(&worldMatrix, GetlocalMatrixRaw());
+			Math::StoreMatrix(world.matrix, GetlocalMatrixRaw());
+
+			world.position = localPosition;
+			world.rotation = localRotation;
+			world.scale = localScale;
 
 		}
 
 		void Transform::UpdateParentTransform(const Transform& parent)
 		{
-			// local matrix * parent's world matrix 
-			XMMATRIX World = GetlocalMatrixRaw() * XMLoadFloat4x4(&parent.worldMatrix);
-			XMStoreFloat4x4(&worldMatrix, World);
+			// local matrix * parent's world matrix , straight into the storage layout
+			world.matrix = Math::AffineMultiply(GetlocalMatrixRaw(), parent.world.matrix);
+
+			// World TRS without decomposing the result : the rotation is the product of the rotations up the chain and the scale
+			// the length of the basis rows , both exact unless the chain shears. The sign of a mirrored axis comes from the product
+			// of the scales (exact as long as no rotation sits between the mirror and this node)
+			world.position = Math::GetTranslation(world.matrix);
+			XMStoreFloat4(&world.rotation, XMQuaternionMultiply(XMLoadFloat4(&localRotation), parent.GetRotationRaw()));
+
+			const XMVECTOR signs = XMVectorAndInt(XMVectorMultiply(XMLoadFloat3(&localScale), parent.GetScaleRaw()), g_XMNegativeZero);
+			const Vector3 lengths = Math::GetScale(world.matrix);
+			XMStoreFloat3(&world.scale, XMVectorOrInt(XMLoadFloat3(&lengths), signs));
 		}
 
 		void Transform::ApplyTransform()
@@ -176,12 +197,21 @@ namespace SaltnPepperEngine
 			XMVECTOR Rotation;
 			XMVECTOR Translation;
 
-			XMMatrixDecompose(&Scale, &Rotation, &Translation, XMLoadFloat4x4(&worldMatrix));
+			XMMatrixDecompose(&Scale, &Rotation, &Translation, Math::LoadMatrix(world.matrix));
 
 			XMStoreFloat3(&localScale, Scale);
 			XMStoreFloat4(&localRotation, Rotation);
 			XMStoreFloat3(&localPosition, Translation);
 
+			world.position = localPosition;
+			world.rotation = localRotation;
+			world.scale = localScale;
+		}
+
+		void Transform::SetWorldMatrix(const Matrix& matrix)
+		{
+			Math::StoreMatrix(world.matrix, XMLoadFloat4x4(&matrix));
+			DecomposeWorldMatrix(world.position, world.rotation, world.scale);
 		}
 	}
 }
\ No newline at end of file
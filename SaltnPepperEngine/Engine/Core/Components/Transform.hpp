@@ -2,6 +2,7 @@
 #define TRANSFORM_H
 #include "Core/EngineDefines.hpp"
 #include "Utilities/Math/MathDefinitions.hpp"
+#include "Utilities/Math/AffineMatrix.hpp"
 
 namespace SaltnPepperEngine
 {
@@ -15,8 +16,19 @@ namespace SaltnPepperEngine
 				DIRTY = 1 << 0
 			};
 
+			// World matrix storage , SNP_AFFINE_WORLDMATRIX (defined for the engine and everything using it) switches to the
+			// 48 byte 3x4 affine layout , the default is the full 4x4. Go through the getters / Math::LoadMatrix to stay independent of it
+#ifdef SNP_AFFINE_WORLDMATRIX
+			using WorldMatrix = Math::Matrix3X4;
+			inline static constexpr WorldMatrix IDENTITYWORLD = Math::IDENTITYAFFINE;
+#else
+			using WorldMatrix = Matrix;
+			inline static constexpr WorldMatrix IDENTITYWORLD = Math::IDENTITYMATRIX;
+#endif
+
 
 			// =============== SERIALIZED VARILABLES =================
+			// Listed in Reflection::TypeInfo<Transform> (TransformReflection.hpp) , keep the two in sync
 
 			uint32_t flags = DIRTY;
 
@@ -32,8 +44,21 @@ namespace SaltnPepperEngine
 
 			// ================= NON SERIALIZED VARIBALES ==============
 
-			// The world transformation matrix used to get the final tranformations on the given Object
-			Matrix worldMatrix = IDENTITYMATRIX;
+			// The world transformation matrix used to get the final tranformations on the given Object , with the world space
+			// position , rotation and scale cached next to it so the getters below are plain loads.
+			// Only the update functions and SetWorldMatrix can write it , so the matrix and the cache never drift apart
+			// (the members are private to a nested type to keep Transform standard layout for the reflection offsets)
+			class WorldState
+			{
+				friend struct Transform;
+
+				WorldMatrix matrix = IDENTITYWORLD;
+				Vector3 position = Vector3{ 0.0f,0.0f,0.0f };
+				Quaternion rotation = Quaternion{ 0.0f,0.0f,0.0f,1.0f };
+				Vector3 scale = Vector3{ 1.0f,1.0f,1.0f };
+			};
+
+			WorldState world;
 
 
 			constexpr inline void SetDirty(bool value = true)
@@ -49,7 +74,10 @@ namespace SaltnPepperEngine
 
 			// ================ GETTERS ======================
 
-			// World postion rotation sand scale getters
+			// World postion rotation sand scale getters (cached , valid after the last update).
+			// Under a parent GetRotation is the product of the rotations up the chain and GetScale the length of the world matrix's
+			// basis rows , so both match a decomposition of it unless the chain shears (a non uniform scale above a rotated node
+			// whose rows stop being orthogonal) , where they are only approximate. Use DecomposeWorldMatrix for that case
 			const Vector3 GetPosition() const;
 			const Vector3 GetScale() const;
 			const Quaternion GetRotation() const;
@@ -59,6 +87,13 @@ namespace SaltnPepperEngine
 			const XMVECTOR GetScaleRaw() const;
 			const XMVECTOR GetRotationRaw() const;
 
+			// World matrix expanded to 4x4 whatever the storage
+			const Matrix GetWorldMatrix() const;
+			const XMMATRIX GetWorldMatrixRaw() const;
+
+			// Runs XMMatrixDecompose on the world matrix , slower than the cached getters but exact for the stored matrix
+			void DecomposeWorldMatrix(Vector3& outPosition, Quaternion& outRotation, Vector3& outScale) const;
+
 		
 			// Forward Right and Up Vectors
 			inline const Vector3 GetForward() const;
@@ -104,6 +139,9 @@ namespace SaltnPepperEngine
 
 			// Updates the local transform with the world space transform (Updates local position, scale and rotation)
 			void ApplyTransform();
+
+			// Sets the world matrix from outside the hierarchy (physics , animation) , decomposes it once to refresh the cached world TRS
+			void SetWorldMatrix(const Matrix& matrix);
 	
 			
 
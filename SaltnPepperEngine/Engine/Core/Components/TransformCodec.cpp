@@ -0,0 +1,350 @@
+#include "TransformCodec.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		namespace
+		{
+			inline static constexpr float INVERSESQRT2 = 0.70710678118f;
+
+			// Transforms per job slice , a multiple of 8 keeps every slice starting on a byte boundary
+			inline static constexpr size_t PARALLELGRAIN = 1024;
+
+			// Little endian bit stream , the first value written ends up in the low bits of the first byte
+			class BitWriter
+			{
+			public:
+
+				explicit BitWriter(uint8_t* output) : m_output(output) {}
+
+				void Write(uint64_t value, uint32_t bits)
+				{
+					while (bits > 0)
+					{
+						const uint32_t chunk = bits < 32 ? bits : 32;
+
+						m_buffer |= (value & ((uint64_t(1) << chunk) - 1)) << m_count;
+						m_count += chunk;
+						value >>= chunk;
+						bits -= chunk;
+
+						while (m_count >= 8)
+						{
+							*m_output++ = static_cast<uint8_t>(m_buffer);
+							m_buffer >>= 8;
+							m_count -= 8;
+						}
+					}
+				}
+
+				// Writes out the last partial byte (zero padded)
+				void Flush()
+				{
+					if (m_count > 0)
+					{
+						*m_output++ = static_cast<uint8_t>(m_buffer);
+						m_buffer = 0;
+						m_count = 0;
+					}
+				}
+
+			private:
+
+				uint8_t* m_output = nullptr;
+				uint64_t m_buffer = 0;
+				uint32_t m_count = 0;
+			};
+
+			class BitReader
+			{
+			public:
+
+				explicit BitReader(const uint8_t* input) : m_input(input) {}
+
+				uint64_t Read(uint32_t bits)
+				{
+					uint64_t result = 0;
+					uint32_t produced = 0;
+
+					while (produced < bits)
+					{
+						const uint32_t chunk = bits - produced < 32 ? bits - produced : 32;
+
+						while (m_count < chunk)
+						{
+							m_buffer |= uint64_t(*m_input++) << m_count;
+							m_count += 8;
+						}
+
+						result |= (m_buffer & ((uint64_t(1) << chunk) - 1)) << produced;
+						m_buffer >>= chunk;
+						m_count -= chunk;
+						produced += chunk;
+					}
+
+					return result;
+				}
+
+			private:
+
+				const uint8_t* m_input = nullptr;
+				uint64_t m_buffer = 0;
+				uint32_t m_count = 0;
+			};
+
+			inline uint8_t ClampBits(uint8_t bits, uint8_t maxBits)
+			{
+				return bits < 1 ? 1 : (bits > maxBits ? maxBits : bits);
+			}
+
+			inline float GetMaxQuantized(uint32_t bits)
+			{
+				return static_cast<float>((uint32_t(1) << bits) - 1);
+			}
+
+			// Linear mapping of [minimum , maximum] onto [0 , 2^bits - 1] with the divisions hoisted out of the loops
+			struct RangeQuantizer
+			{
+				float minimum;
+				float toQuantized;
+				float toValue;
+				float maxQuantized;
+
+				RangeQuantizer(float rangeMin, float rangeMax, uint32_t bits)
+					: minimum(rangeMin)
+					, toQuantized(GetMaxQuantized(bits) / (rangeMax - rangeMin))
+					, toValue((rangeMax - rangeMin) / GetMaxQuantized(bits))
+					, maxQuantized(GetMaxQuantized(bits))
+				{
+				}
+
+				// NaNs end up at 0
+				inline uint32_t Quantize(float value) const
+				{
+					const float scaled = (value - minimum) * toQuantized;
+					return static_cast<uint32_t>(std::nearbyint(scaled > 0.0f ? (scaled < maxQuantized ? scaled : maxQuantized) : 0.0f));
+				}
+
+				inline float Dequantize(uint64_t value) const
+				{
+					return minimum + static_cast<float>(value) * toValue;
+				}
+			};
+		}
+
+		TransformCodec::TransformCodec(const TransformCodecSettings& settings)
+			: m_settings(settings)
+		{
+			m_settings.positionBits = ClampBits(m_settings.positionBits, MAXPOSITIONBITS);
+			m_settings.rotationBits = ClampBits(m_settings.rotationBits, MAXROTATIONBITS);
+			m_settings.scaleBits = ClampBits(m_settings.scaleBits, MAXSCALEBITS);
+
+			if (m_settings.maxScale <= m_settings.minScale) { m_settings.maxScale = m_settings.minScale + 1.0f; }
+
+			const uint32_t scaleComponents = m_settings.scaleMode == TransformScaleMode::NonUniform ? 3 : (m_settings.scaleMode == TransformScaleMode::Uniform ? 1 : 0);
+			m_bitsPerTransform = 3 * m_settings.positionBits + 2 + 3 * m_settings.rotationBits + scaleComponents * m_settings.scaleBits;
+		}
+
+		size_t TransformCodec::GetEncodedSize(size_t count) const
+		{
+			return (count * m_bitsPerTransform + 7) / 8;
+		}
+
+		size_t TransformCodec::Encode(const Transform* transforms, size_t count, uint8_t* output) const
+		{
+			if (count < PARALLELTHRESHOLD)
+			{
+				EncodeRange(transforms, count, output);
+			}
+			else
+			{
+				Jobs::JobSystem::ParallelFor(count, PARALLELGRAIN, [&](size_t begin, size_t end)
+				{
+					EncodeRange(transforms + begin, end - begin, output + (begin * m_bitsPerTransform) / 8);
+				});
+			}
+
+			return GetEncodedSize(count);
+		}
+
+		void TransformCodec::Decode(const uint8_t* input, size_t count, Transform* transforms) const
+		{
+			if (count < PARALLELTHRESHOLD)
+			{
+				DecodeRange(input, count, transforms);
+				return;
+			}
+
+			Jobs::JobSystem::ParallelFor(count, PARALLELGRAIN, [&](size_t begin, size_t end)
+			{
+				DecodeRange(input + (begin * m_bitsPerTransform) / 8, end - begin, transforms + begin);
+			});
+		}
+
+		void TransformCodec::EncodeRange(const Transform* transforms, size_t count, uint8_t* output) const
+		{
+			const TransformCodecSettings& settings = m_settings;
+			const Vector3& origin = settings.cellOrigin;
+
+			const RangeQuantizer positionX(origin.x - settings.cellExtent, origin.x + settings.cellExtent, settings.positionBits);
+			const RangeQuantizer positionY(origin.y - settings.cellExtent, origin.y + settings.cellExtent, settings.positionBits);
+			const RangeQuantizer positionZ(origin.z - settings.cellExtent, origin.z + settings.cellExtent, settings.positionBits);
+			const RangeQuantizer scale(settings.minScale, settings.maxScale, settings.scaleBits);
+
+			BitWriter writer(output);
+
+			for (size_t index = 0; index < count; ++index)
+			{
+				const Transform& transform = transforms[index];
+
+				writer.Write(positionX.Quantize(transform.localPosition.x), settings.positionBits);
+				writer.Write(positionY.Quantize(transform.localPosition.y), settings.positionBits);
+				writer.Write(positionZ.Quantize(transform.localPosition.z), settings.positionBits);
+
+				writer.Write(PackRotation(transform.localRotation, settings.rotationBits), 2 + 3 * settings.rotationBits);
+
+				if (settings.scaleMode != TransformScaleMode::Unit)
+				{
+					writer.Write(scale.Quantize(transform.localScale.x), settings.scaleBits);
+				}
+
+				if (settings.scaleMode == TransformScaleMode::NonUniform)
+				{
+					writer.Write(scale.Quantize(transform.localScale.y), settings.scaleBits);
+					writer.Write(scale.Quantize(transform.localScale.z), settings.scaleBits);
+				}
+			}
+
+			writer.Flush();
+		}
+
+		void TransformCodec::DecodeRange(const uint8_t* input, size_t count, Transform* transforms) const
+		{
+			const TransformCodecSettings& settings = m_settings;
+			const Vector3& origin = settings.cellOrigin;
+
+			const RangeQuantizer positionX(origin.x - settings.cellExtent, origin.x + settings.cellExtent, settings.positionBits);
+			const RangeQuantizer positionY(origin.y - settings.cellExtent, origin.y + settings.cellExtent, settings.positionBits);
+			const RangeQuantizer positionZ(origin.z - settings.cellExtent, origin.z + settings.cellExtent, settings.positionBits);
+			const RangeQuantizer scale(settings.minScale, settings.maxScale, settings.scaleBits);
+
+			BitReader reader(input);
+
+			for (size_t index = 0; index < count; ++index)
+			{
+				Transform& transform = transforms[index];
+
+				transform.localPosition.x = positionX.Dequantize(reader.Read(settings.positionBits));
+				transform.localPosition.y = positionY.Dequantize(reader.Read(settings.positionBits));
+				transform.localPosition.z = positionZ.Dequantize(reader.Read(settings.positionBits));
+
+				transform.localRotation = UnpackRotation(reader.Read(2 + 3 * settings.rotationBits), settings.rotationBits);
+
+				switch (settings.scaleMode)
+				{
+				case TransformScaleMode::Unit:
+					transform.localScale = Vector3{ 1.0f,1.0f,1.0f };
+					break;
+
+				case TransformScaleMode::Uniform:
+					transform.localScale = Vector3(scale.Dequantize(reader.Read(settings.scaleBits)));
+					break;
+
+				default:
+					transform.localScale.x = scale.Dequantize(reader.Read(settings.scaleBits));
+					transform.localScale.y = scale.Dequantize(reader.Read(settings.scaleBits));
+					transform.localScale.z = scale.Dequantize(reader.Read(settings.scaleBits));
+					break;
+				}
+
+				transform.SetDirty();
+			}
+		}
+
+		float TransformCodec::GetPositionMaxError() const
+		{
+			// Half a quantization step , plus float rounding of coordinates that far from zero
+			const Vector3& origin = m_settings.cellOrigin;
+			const float farthest = std::max({ std::fabs(origin.x), std::fabs(origin.y), std::fabs(origin.z) }) + m_settings.cellExtent;
+
+			return m_settings.cellExtent / GetMaxQuantized(m_settings.positionBits) + farthest * std::numeric_limits<float>::epsilon();
+		}
+
+		float TransformCodec::GetRotationMaxError() const
+		{
+			// Each stored component is off by at most half a step of its [-1/sqrt2 , 1/sqrt2] range.
+			// Rebuilding the dropped component at most doubles the chord , and the rotation angle is twice the chord
+			const float componentError = INVERSESQRT2 / GetMaxQuantized(m_settings.rotationBits);
+			return 4.0f * 1.7320508f * componentError;
+		}
+
+		float TransformCodec::GetScaleMaxError() const
+		{
+			if (m_settings.scaleMode == TransformScaleMode::Unit) { return 0.0f; }
+			const float farthest = std::max(std::fabs(m_settings.minScale), std::fabs(m_settings.maxScale));
+			return 0.5f * (m_settings.maxScale - m_settings.minScale) / GetMaxQuantized(m_settings.scaleBits) + farthest * std::numeric_limits<float>::epsilon();
+		}
+
+		uint64_t TransformCodec::PackRotation(const Quaternion& rotation, uint32_t componentBits)
+		{
+			Quaternion normalized;
+			XMStoreFloat4(&normalized, XMQuaternionNormalize(XMLoadFloat4(&rotation)));
+
+			const float components[4] = { normalized.x, normalized.y, normalized.z, normalized.w };
+
+			uint32_t largest = 0;
+			for (uint32_t index = 1; index < 4; ++index)
+			{
+				if (std::fabs(components[index]) > std::fabs(components[largest])) { largest = index; }
+			}
+
+			// q and -q are the same rotation , flip so the dropped component is positive
+			const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+			const RangeQuantizer quantizer(-INVERSESQRT2, INVERSESQRT2, componentBits);
+
+			uint64_t packed = largest;
+			for (uint32_t index = 0; index < 4; ++index)
+			{
+				if (index == largest) { continue; }
+
+				packed = (packed << componentBits) | quantizer.Quantize(components[index] * sign);
+			}
+
+			return packed;
+		}
+
+		Quaternion TransformCodec::UnpackRotation(uint64_t packed, uint32_t componentBits)
+		{
+			const uint64_t componentMask = (uint64_t(1) << componentBits) - 1;
+			const RangeQuantizer quantizer(-INVERSESQRT2, INVERSESQRT2, componentBits);
+
+			float smallest[3];
+			for (int index = 2; index >= 0; --index)
+			{
+				smallest[index] = quantizer.Dequantize(packed & componentMask);
+				packed >>= componentBits;
+			}
+
+			const uint32_t largest = static_cast<uint32_t>(packed & 3);
+			const float sumSquares = smallest[0] * smallest[0] + smallest[1] * smallest[1] + smallest[2] * smallest[2];
+
+			float components[4];
+			components[largest] = std::sqrt(sumSquares < 1.0f ? 1.0f - sumSquares : 0.0f);
+
+			for (uint32_t index = 0, source = 0; index < 4; ++index)
+			{
+				if (index != largest) { components[index] = smallest[source++]; }
+			}
+
+			Quaternion result;
+			XMStoreFloat4(&result, XMQuaternionNormalize(XMVectorSet(components[0], components[1], components[2], components[3])));
+			return result;
+		}
+	}
+}
@@ -0,0 +1,120 @@
+#ifndef TRANSFORMCODEC_H
+#define TRANSFORMCODEC_H
+#include "Core/EngineDefines.hpp"
+#include "Core/Components/Transform.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		enum class TransformScaleMode : uint8_t
+		{
+			// Scale isn't stored , decodes to (1 , 1 , 1)
+			Unit,
+			// One value for all three axes (the x axis is stored)
+			Uniform,
+			// All three axes
+			NonUniform
+		};
+
+		/// <summary>
+		/// Precision of the compact Transform encoding. Bit counts are per component
+		/// </summary>
+		struct TransformCodecSettings
+		{
+			// Positions are stored relative to the cell origin , anything outside origin +- cellExtent gets clamped to the cell
+			Vector3 cellOrigin = Vector3{ 0.0f,0.0f,0.0f };
+			float cellExtent = 512.0f;
+			uint8_t positionBits = 18;
+
+			// Smallest three : 2 bit index + 3 components in [-1/sqrt2 , 1/sqrt2]
+			uint8_t rotationBits = 12;
+
+			TransformScaleMode scaleMode = TransformScaleMode::Uniform;
+			float minScale = 0.0f;
+			float maxScale = 16.0f;
+			uint8_t scaleBits = 12;
+		};
+
+		/// <summary>
+		/// Bit packs the local TRS of Transforms (the world matrix is not stored , decoded transforms are marked dirty).
+		/// Every transform takes the same number of bits , so element i starts at bit i * GetBitsPerTransform()
+		/// </summary>
+		class SNP_API TransformCodec
+		{
+		public:
+
+			// Limits the settings get clamped to
+			inline static constexpr uint8_t MAXPOSITIONBITS = 24;
+			inline static constexpr uint8_t MAXROTATIONBITS = 20;
+			inline static constexpr uint8_t MAXSCALEBITS = 24;
+
+			// Arrays with at least this many transforms get split across the job system
+			inline static constexpr size_t PARALLELTHRESHOLD = 4096;
+
+			explicit TransformCodec(const TransformCodecSettings& settings = TransformCodecSettings{});
+
+			const TransformCodecSettings& GetSettings() const { return m_settings; }
+
+			uint32_t GetBitsPerTransform() const { return m_bitsPerTransform; }
+
+			/// <summary>
+			/// Bytes needed to encode count transforms
+			/// </summary>
+			size_t GetEncodedSize(size_t count) const;
+
+			/// <summary>
+			/// Encodes count transforms into output (GetEncodedSize(count) bytes) and returns the bytes written
+			/// </summary>
+			size_t Encode(const Transform* transforms, size_t count, uint8_t* output) const;
+
+			/// <summary>
+			/// Decodes count transforms , only the local position , rotation and scale get overwritten
+			/// </summary>
+			void Decode(const uint8_t* input, size_t count, Transform* transforms) const;
+
+
+			// ================ ERROR BOUNDS ======================
+
+			/// <summary>
+			/// Max per axis position error for positions inside the cell (world units)
+			/// </summary>
+			float GetPositionMaxError() const;
+
+			/// <summary>
+			/// Max rotation error for unit quaternions (radians)
+			/// </summary>
+			float GetRotationMaxError() const;
+
+			/// <summary>
+			/// Max per axis scale error for scales inside [minScale , maxScale]
+			/// </summary>
+			float GetScaleMaxError() const;
+
+
+			// ================ SMALLEST THREE ======================
+
+			/// <summary>
+			/// Packs a unit quaternion into 2 + 3 * componentBits bits (index of the dropped component in the top 2 bits)
+			/// </summary>
+			static uint64_t PackRotation(const Quaternion& rotation, uint32_t componentBits);
+
+			/// <summary>
+			/// Rebuilds the unit quaternion from PackRotation's bits
+			/// </summary>
+			static Quaternion UnpackRotation(uint64_t packed, uint32_t componentBits);
+
+		private:
+
+			void EncodeRange(const Transform* transforms, size_t count, uint8_t* output) const;
+			void DecodeRange(const uint8_t* input, size_t count, Transform* transforms) const;
+
+			TransformCodecSettings m_settings;
+			uint32_t m_bitsPerTransform = 0;
+		};
+	}
+}
+
+#endif // !TRANSFORMCODEC_H
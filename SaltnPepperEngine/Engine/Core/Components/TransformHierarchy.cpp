@@ -0,0 +1,878 @@
+#include "TransformHierarchy.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		namespace
+		{
+			// What the getters hand back for invalid handles
+			inline static constexpr Vector3 ZEROVECTOR = Vector3{ 0.0f,0.0f,0.0f };
+			inline static constexpr Vector3 UNITSCALE = Vector3{ 1.0f,1.0f,1.0f };
+			inline static constexpr Quaternion IDENTITYROTATION = Quaternion{ 0.0f,0.0f,0.0f,1.0f };
+
+			/// <summary>
+			/// Local S * R * T built straight from the quaternion (same matrix as Transform::GetlocalMatrixRaw)
+			/// </summary>
+			inline XMMATRIX ComposeLocal(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+			{
+				XMMATRIX local = XMMatrixRotationQuaternion(XMLoadFloat4(&rotation));
+				local.r[0] = XMVectorScale(local.r[0], scale.x);
+				local.r[1] = XMVectorScale(local.r[1], scale.y);
+				local.r[2] = XMVectorScale(local.r[2], scale.z);
+				local.r[3] = XMVectorSetW(XMLoadFloat3(&position), 1.0f);
+				return local;
+			}
+		}
+
+		void TransformHierarchy::Reserve(size_t count)
+		{
+			m_localPositions.reserve(count);
+			m_localRotations.reserve(count);
+			m_localScales.reserve(count);
+			m_worldMatrices.reserve(count);
+			m_parents.reserve(count);
+			m_depths.reserve(count);
+			m_flags.reserve(count);
+			m_slotNodes.reserve(count);
+			m_nodeSlots.reserve(count);
+			m_generations.reserve(count);
+		}
+
+		void TransformHierarchy::Clear()
+		{
+			// Bump every live generation so old handles stay invalid once their indices get reused
+			for (uint32_t index = 0; index < m_nodeSlots.size(); ++index)
+			{
+				if (m_nodeSlots[index] == INVALIDSLOT) { continue; }
+
+				m_nodeSlots[index] = INVALIDSLOT;
+				++m_generations[index];
+				m_freeNodes.push_back(index);
+			}
+
+			m_localPositions.clear();
+			m_localRotations.clear();
+			m_localScales.clear();
+			m_worldMatrices.clear();
+			m_parents.clear();
+			m_depths.clear();
+			m_flags.clear();
+			m_slotNodes.clear();
+			m_levelStarts.clear();
+			m_levelFlags.clear();
+
+			m_frozenCount = 0;
+			m_sorted = true;
+			m_hasRemovals = false;
+			m_tailValid = false;
+		}
+
+		TransformHandle TransformHierarchy::Create(TransformHandle parent)
+		{
+			const uint32_t index = AllocateNode(GetCheckedSlot(parent));
+			return TransformHandle{ index, m_generations[index] };
+		}
+
+		TransformHandle TransformHierarchy::Create(const Transform& transform, TransformHandle parent)
+		{
+			const uint32_t index = AllocateNode(GetCheckedSlot(parent));
+
+			const uint32_t slot = m_nodeSlots[index];
+			m_localPositions[slot] = transform.localPosition;
+			m_localRotations[slot] = transform.localRotation;
+			m_localScales[slot] = transform.localScale;
+
+			return TransformHandle{ index, m_generations[index] };
+		}
+
+		uint32_t TransformHierarchy::AllocateNode(uint32_t parentSlot)
+		{
+			uint32_t index;
+			if (!m_freeNodes.empty())
+			{
+				index = m_freeNodes.back();
+				m_freeNodes.pop_back();
+			}
+			else
+			{
+				index = static_cast<uint32_t>(m_nodeSlots.size());
+				m_nodeSlots.push_back(INVALIDSLOT);
+				m_generations.push_back(0);
+			}
+
+			const uint32_t slot = static_cast<uint32_t>(m_parents.size());
+			const uint32_t depth = GetChildDepth(parentSlot);
+
+			// Appending keeps the depth order as long as nothing deeper is stored yet
+			if (m_sorted)
+			{
+				if (!m_depths.empty() && depth < m_depths.back()) { m_sorted = false; }
+				else if (depth == m_levelStarts.size())
+				{
+					m_levelStarts.push_back(slot);
+					m_levelFlags.push_back(LEVELDIRTY);
+				}
+				else { m_levelFlags[depth] |= LEVELDIRTY; }
+			}
+			m_tailValid = false;
+
+			m_localPositions.push_back(ZEROVECTOR);
+			m_localRotations.push_back(IDENTITYROTATION);
+			m_localScales.push_back(UNITSCALE);
+			m_worldMatrices.push_back(Transform::IDENTITYWORLD);
+			m_parents.push_back(parentSlot);
+			m_depths.push_back(depth);
+			m_flags.push_back(DIRTY);
+			m_slotNodes.push_back(index);
+
+			m_nodeSlots[index] = slot;
+			return index;
+		}
+
+		void TransformHierarchy::Remove(TransformHandle node)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return; }
+
+			// The slot stays until Compact , which also bumps the generation and recycles the index
+			m_flags[slot] |= REMOVED;
+			m_hasRemovals = true;
+		}
+
+		bool TransformHierarchy::SetParent(TransformHandle node, TransformHandle parent, bool keepWorldTransform)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT || (m_flags[slot] & FROZEN) != 0) { return false; }
+
+			const uint32_t parentSlot = GetCheckedSlot(parent);
+
+			// Refuse cycles : the new parent can't be the node or sit anywhere below it
+			for (uint32_t ancestor = parentSlot; ancestor != INVALIDSLOT; ancestor = m_parents[ancestor])
+			{
+				if (ancestor == slot) { return false; }
+			}
+
+			if (keepWorldTransform)
+			{
+				XMMATRIX local = Math::LoadMatrix(m_worldMatrices[slot]);
+				if (parentSlot != INVALIDSLOT)
+				{
+					local = Math::AffineMultiply(local, Math::AffineInverse(Math::LoadMatrix(m_worldMatrices[parentSlot])));
+				}
+
+				XMVECTOR scale, rotation, translation;
+				if (XMMatrixDecompose(&scale, &rotation, &translation, local))
+				{
+					XMStoreFloat3(&m_localScales[slot], scale);
+					XMStoreFloat4(&m_localRotations[slot], rotation);
+					XMStoreFloat3(&m_localPositions[slot], translation);
+				}
+			}
+
+			m_parents[slot] = parentSlot;
+			m_tailValid = false;
+
+			// Same depth keeps the order valid : the new parent is one level up , so it is stored before the node already
+			const uint32_t depth = GetChildDepth(parentSlot);
+			if (depth != m_depths[slot])
+			{
+				m_depths[slot] = depth;
+				m_sorted = false;
+			}
+
+			MarkDirty(slot);
+			return true;
+		}
+
+		TransformHandle TransformHierarchy::GetParent(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT || m_parents[slot] == INVALIDSLOT) { return TransformHandle{}; }
+
+			return GetHandle(m_parents[slot]);
+		}
+
+		bool TransformHierarchy::IsValid(TransformHandle node) const
+		{
+			return GetCheckedSlot(node) != INVALIDSLOT;
+		}
+
+		const Vector3& TransformHierarchy::GetLocalPosition(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			return slot != INVALIDSLOT ? m_localPositions[slot] : ZEROVECTOR;
+		}
+
+		const Quaternion& TransformHierarchy::GetLocalRotation(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			return slot != INVALIDSLOT ? m_localRotations[slot] : IDENTITYROTATION;
+		}
+
+		const Vector3& TransformHierarchy::GetLocalScale(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			return slot != INVALIDSLOT ? m_localScales[slot] : UNITSCALE;
+		}
+
+		void TransformHierarchy::SetLocalPosition(TransformHandle node, const Vector3& position)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return; }
+
+			m_localPositions[slot] = position;
+			MarkDirty(slot);
+		}
+
+		void TransformHierarchy::SetLocalRotation(TransformHandle node, const Quaternion& rotation)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return; }
+
+			m_localRotations[slot] = rotation;
+			MarkDirty(slot);
+		}
+
+		void TransformHierarchy::SetLocalScale(TransformHandle node, const Vector3& scale)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return; }
+
+			m_localScales[slot] = scale;
+			MarkDirty(slot);
+		}
+
+		void TransformHierarchy::SetLocalTransform(TransformHandle node, const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return; }
+
+			m_localPositions[slot] = position;
+			m_localRotations[slot] = rotation;
+			m_localScales[slot] = scale;
+			MarkDirty(slot);
+		}
+
+		void TransformHierarchy::SetDirty(TransformHandle node)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot != INVALIDSLOT) { MarkDirty(slot); }
+		}
+
+		bool TransformHierarchy::IsDirty(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			return slot != INVALIDSLOT && (m_flags[slot] & DIRTY) != 0;
+		}
+
+		const Matrix TransformHierarchy::GetWorldMatrix(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			return slot != INVALIDSLOT ? Math::ToMatrix(m_worldMatrices[slot]) : IDENTITYMATRIX;
+		}
+
+		bool TransformHierarchy::HasWorldChanged(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			return slot != INVALIDSLOT && (m_flags[slot] & WORLDCHANGED) != 0;
+		}
+
+		Transform TransformHierarchy::ToTransform(TransformHandle node) const
+		{
+			Transform transform;
+
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return transform; }
+
+			transform.localPosition = m_localPositions[slot];
+			transform.localRotation = m_localRotations[slot];
+			transform.localScale = m_localScales[slot];
+			transform.SetWorldMatrix(Math::ToMatrix(m_worldMatrices[slot]));
+			transform.SetDirty((m_flags[slot] & DIRTY) != 0);
+
+			return transform;
+		}
+
+		bool TransformHierarchy::Freeze(TransformHandle node)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return false; }
+
+			const uint32_t parentSlot = m_parents[slot];
+			if (parentSlot != INVALIDSLOT)
+			{
+				const uint8_t parentFlags = m_flags[parentSlot];
+				if ((parentFlags & (FROZEN | FREEZEPENDING)) == 0 || (parentFlags & UNFREEZEPENDING) != 0) { return false; }
+			}
+
+			// Set on frozen nodes too , live descendants left over from an Unfreeze further down get frozen again
+			m_flags[slot] = (m_flags[slot] & ~UNFREEZEPENDING) | FREEZEPENDING;
+
+			// Frozen nodes have to move into the prefix , which is Compact's job
+			m_sorted = false;
+			return true;
+		}
+
+		void TransformHierarchy::Unfreeze(TransformHandle node)
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			if (slot == INVALIDSLOT) { return; }
+
+			uint8_t& flags = m_flags[slot];
+			flags &= ~FREEZEPENDING;
+			if ((flags & FROZEN) != 0)
+			{
+				flags |= UNFREEZEPENDING;
+				m_sorted = false;
+			}
+		}
+
+		bool TransformHierarchy::IsFrozen(TransformHandle node) const
+		{
+			const uint32_t slot = GetCheckedSlot(node);
+			return slot != INVALIDSLOT && (m_flags[slot] & FROZEN) != 0;
+		}
+
+		void TransformHierarchy::Update(bool parallel)
+		{
+			if (NeedsCompact()) { Compact(); }
+
+			const uint32_t depthCount = GetDepthCount();
+
+			// Without workers the tail split would only add bookkeeping
+			parallel = parallel && Jobs::JobSystem::GetWorkerCount() > 0;
+
+			uint32_t tailLevel = depthCount;
+			if (parallel)
+			{
+				if (!m_tailValid) { BuildTail(); }
+				tailLevel = m_tailLevel;
+			}
+
+			bool parentChanged = false;
+			for (uint32_t depth = 0; depth < tailLevel; ++depth)
+			{
+				const uint32_t begin = m_levelStarts[depth];
+				const uint32_t end = GetLevelBegin(depth + 1);
+
+				uint8_t& levelFlags = m_levelFlags[depth];
+				bool changed = false;
+
+				if (parentChanged || (levelFlags & LEVELDIRTY) != 0)
+				{
+					changed = parallel && end - begin > PARALLELGRAIN ? UpdateRangeParallel(begin, end) : UpdateRange(begin, end);
+				}
+				else if ((levelFlags & LEVELCHANGED) != 0)
+				{
+					// Nothing to recompute , just last update's WORLDCHANGED marks to clear
+					std::memset(m_flags.data() + begin, NONE, end - begin);
+				}
+
+				levelFlags = changed ? LEVELCHANGED : 0;
+				parentChanged = changed;
+			}
+
+			if (tailLevel < depthCount) { UpdateTail(parentChanged); }
+		}
+
+		bool TransformHierarchy::UpdateSlot(uint32_t slot)
+		{
+			const uint32_t parentSlot = m_parents[slot];
+			uint8_t& flags = m_flags[slot];
+
+			// Parents were done first , so their WORLDCHANGED already describes this update
+			const bool changed = (flags & DIRTY) != 0 || (parentSlot != INVALIDSLOT && (m_flags[parentSlot] & WORLDCHANGED) != 0);
+			flags = changed ? WORLDCHANGED : NONE;
+
+			if (!changed) { return false; }
+
+			ComposeWorld(slot);
+			return true;
+		}
+
+		void TransformHierarchy::ComposeWorld(uint32_t slot)
+		{
+			const uint32_t parentSlot = m_parents[slot];
+
+			const XMMATRIX local = ComposeLocal(m_localPositions[slot], m_localRotations[slot], m_localScales[slot]);
+			if (parentSlot != INVALIDSLOT)
+			{
+				m_worldMatrices[slot] = Math::AffineMultiply(local, m_worldMatrices[parentSlot]);
+			}
+			else
+			{
+				Math::StoreMatrix(m_worldMatrices[slot], local);
+			}
+		}
+
+		bool TransformHierarchy::UpdateRange(uint32_t begin, uint32_t end)
+		{
+			bool changed = false;
+			for (uint32_t slot = begin; slot < end; ++slot) { changed |= UpdateSlot(slot); }
+			return changed;
+		}
+
+		bool TransformHierarchy::UpdateRangeParallel(uint32_t begin, uint32_t end)
+		{
+			std::atomic<bool> changed{ false };
+
+			// Slots of one level only read the level above , so any split works
+			Jobs::JobSystem::ParallelFor(end - begin, PARALLELGRAIN, [this, begin, &changed](size_t sliceBegin, size_t sliceEnd)
+			{
+				if (UpdateRange(begin + static_cast<uint32_t>(sliceBegin), begin + static_cast<uint32_t>(sliceEnd)))
+				{
+					changed.store(true, std::memory_order_relaxed);
+				}
+			});
+
+			return changed.load(std::memory_order_relaxed);
+		}
+
+		void TransformHierarchy::BuildTail()
+		{
+			const uint32_t depthCount = GetDepthCount();
+			const uint32_t count = static_cast<uint32_t>(m_parents.size());
+
+			m_tailValid = true;
+			m_tailLevel = depthCount;
+			m_tailOrder.clear();
+			m_tailChunks.clear();
+
+			// The tail is the run of narrow levels at the bottom , level by level it can't use more than one thread
+			uint32_t tailLevel = depthCount;
+			while (tailLevel > 0 && GetLevelBegin(tailLevel) - GetLevelBegin(tailLevel - 1) <= PARALLELGRAIN) { --tailLevel; }
+
+			const uint32_t tailBegin = GetLevelBegin(tailLevel);
+			const uint32_t groupCount = GetLevelBegin(tailLevel + 1) - tailBegin;
+			const uint32_t tailSize = count - tailBegin;
+
+			if (tailLevel == depthCount || tailSize <= PARALLELGRAIN || groupCount < 2) { return; }
+
+			// Every tail node belongs to the subtree of its ancestor on the tail's first level ,
+			// the subtrees are independent so each one can run start to finish on its own thread
+			std::vector<uint32_t> groups(tailSize);
+			std::vector<uint32_t> groupStarts(static_cast<size_t>(groupCount) + 1, 0);
+			for (uint32_t slot = tailBegin; slot < count; ++slot)
+			{
+				const uint32_t group = slot < tailBegin + groupCount ? slot - tailBegin : groups[m_parents[slot] - tailBegin];
+				groups[slot - tailBegin] = group;
+				++groupStarts[group + 1];
+			}
+			for (uint32_t group = 0; group < groupCount; ++group) { groupStarts[group + 1] += groupStarts[group]; }
+
+			// Stable by slot within a group , which keeps parents ahead of their children
+			m_tailOrder.resize(tailSize);
+			std::vector<uint32_t> cursor(groupStarts.begin(), groupStarts.end() - 1);
+			for (uint32_t slot = tailBegin; slot < count; ++slot) { m_tailOrder[cursor[groups[slot - tailBegin]]++] = slot; }
+
+			// Pack whole subtrees into jobs of roughly even size , a few per thread so one deep subtree doesn't stall the rest
+			const uint32_t chunkSize = std::max(TAILCHUNKMINIMUM, tailSize / (Jobs::JobSystem::GetThreadCount() * 4));
+			m_tailChunks.push_back(0);
+			for (uint32_t group = 0; group < groupCount; ++group)
+			{
+				if (groupStarts[group + 1] - m_tailChunks.back() >= chunkSize || group + 1 == groupCount) { m_tailChunks.push_back(groupStarts[group + 1]); }
+			}
+
+			m_tailLevel = tailLevel;
+		}
+
+		void TransformHierarchy::UpdateTail(bool parentChanged)
+		{
+			const uint32_t depthCount = GetDepthCount();
+			const uint32_t tailBegin = GetLevelBegin(m_tailLevel);
+
+			uint8_t tailFlags = 0;
+			for (uint32_t depth = m_tailLevel; depth < depthCount; ++depth) { tailFlags |= m_levelFlags[depth]; }
+
+			bool changed = false;
+			if (parentChanged || (tailFlags & LEVELDIRTY) != 0)
+			{
+				std::atomic<bool> anyChanged{ false };
+				Jobs::JobSystem::ParallelFor(m_tailChunks.size() - 1, 1, [this, &anyChanged](size_t chunkBegin, size_t chunkEnd)
+				{
+					bool sliceChanged = false;
+					for (uint32_t index = m_tailChunks[chunkBegin]; index < m_tailChunks[chunkEnd]; ++index) { sliceChanged |= UpdateSlot(m_tailOrder[index]); }
+
+					if (sliceChanged) { anyChanged.store(true, std::memory_order_relaxed); }
+				});
+				changed = anyChanged.load(std::memory_order_relaxed);
+			}
+			else if ((tailFlags & LEVELCHANGED) != 0)
+			{
+				std::memset(m_flags.data() + tailBegin, NONE, m_flags.size() - tailBegin);
+			}
+
+			// Tracked for the tail as a whole , a level marked changed only costs a flag clear next time
+			for (uint32_t depth = m_tailLevel; depth < depthCount; ++depth) { m_levelFlags[depth] = changed ? LEVELCHANGED : 0; }
+		}
+
+		void TransformHierarchy::Compact()
+		{
+			const uint32_t count = static_cast<uint32_t>(m_parents.size());
+
+			// Children lists (slot order) of everything still alive , filled back to front so the counts turn into start offsets
+			std::vector<uint32_t> childStarts(static_cast<size_t>(count) + 1, 0);
+			for (uint32_t slot = 0; slot < count; ++slot)
+			{
+				if ((m_flags[slot] & REMOVED) == 0 && m_parents[slot] != INVALIDSLOT) { ++childStarts[m_parents[slot]]; }
+			}
+			for (uint32_t slot = 1; slot <= count; ++slot) { childStarts[slot] += childStarts[slot - 1]; }
+
+			std::vector<uint32_t> children(childStarts[count]);
+			for (uint32_t slot = count; slot-- > 0;)
+			{
+				if ((m_flags[slot] & REMOVED) == 0 && m_parents[slot] != INVALIDSLOT) { children[--childStarts[m_parents[slot]]] = slot; }
+			}
+
+			// Breadth first from the roots gives depth order with siblings next to each other.
+			// Removed nodes are never queued , which drops their whole subtree
+			std::vector<uint32_t> order;
+			order.reserve(count);
+			for (uint32_t slot = 0; slot < count; ++slot)
+			{
+				if ((m_flags[slot] & REMOVED) == 0 && m_parents[slot] == INVALIDSLOT) { order.push_back(slot); }
+			}
+			for (size_t position = 0; position < order.size(); ++position)
+			{
+				const uint32_t slot = order[position];
+				for (uint32_t child = childStarts[slot]; child < childStarts[slot + 1]; ++child) { order.push_back(children[child]); }
+			}
+
+			OrderFrozen(order);
+
+			const uint32_t liveCount = static_cast<uint32_t>(order.size());
+
+			std::vector<uint32_t> newSlots(count, INVALIDSLOT);
+			for (uint32_t slot = 0; slot < liveCount; ++slot) { newSlots[order[slot]] = slot; }
+
+			// Release whatever didn't make it , those slots go to the back so order becomes a full permutation
+			for (uint32_t slot = 0; slot < count; ++slot)
+			{
+				if (newSlots[slot] != INVALIDSLOT) { continue; }
+
+				const uint32_t index = m_slotNodes[slot];
+				++m_generations[index];
+
+				m_nodeSlots[index] = INVALIDSLOT;
+				m_freeNodes.push_back(index);
+				order.push_back(slot);
+			}
+
+			Permute(order);
+			Resize(liveCount);
+
+			// Parents come first , so depths and level data fall out of one pass.
+			// Nodes frozen just now get baked , WORLDCHANGED marks them until the pass is over so their live children recompute
+			m_levelStarts.clear();
+			m_levelFlags.clear();
+			for (uint32_t slot = 0; slot < liveCount; ++slot)
+			{
+				uint32_t& parentSlot = m_parents[slot];
+				if (parentSlot != INVALIDSLOT) { parentSlot = newSlots[parentSlot]; }
+
+				m_nodeSlots[m_slotNodes[slot]] = slot;
+
+				if (slot < m_frozenCount)
+				{
+					m_depths[slot] = 0;
+					if ((m_flags[slot] & DIRTY) != 0)
+					{
+						ComposeWorld(slot);
+						m_flags[slot] = FROZEN | WORLDCHANGED;
+					}
+					continue;
+				}
+
+				if (parentSlot != INVALIDSLOT && m_flags[parentSlot] == (FROZEN | WORLDCHANGED)) { m_flags[slot] |= DIRTY; }
+
+				const uint32_t depth = GetChildDepth(parentSlot);
+				m_depths[slot] = depth;
+				if (depth == m_levelStarts.size())
+				{
+					m_levelStarts.push_back(slot);
+					m_levelFlags.push_back(0);
+				}
+
+				if ((m_flags[slot] & DIRTY) != 0) { m_levelFlags[depth] |= LEVELDIRTY; }
+				if ((m_flags[slot] & WORLDCHANGED) != 0) { m_levelFlags[depth] |= LEVELCHANGED; }
+			}
+
+			for (uint32_t slot = 0; slot < m_frozenCount; ++slot) { m_flags[slot] = FROZEN; }
+
+			m_sorted = true;
+			m_hasRemovals = false;
+			m_tailValid = false;
+		}
+
+		bool TransformHierarchy::Assign(const TransformSlotArrays& arrays)
+		{
+			Clear();
+
+			const uint32_t count = arrays.count;
+			if (count == 0) { return true; }
+			if (arrays.frozenCount > count) { return false; }
+
+			// Frozen prefix first , each parent before its child
+			for (uint32_t slot = 0; slot < count; ++slot)
+			{
+				const uint32_t parentSlot = arrays.parents[slot];
+				const bool frozen = (arrays.flags[slot] & FROZEN) != 0;
+
+				if ((parentSlot != INVALIDSLOT && parentSlot >= slot) || frozen != (slot < arrays.frozenCount)) { return false; }
+			}
+
+			m_localPositions.assign(arrays.localPositions, arrays.localPositions + count);
+			m_localRotations.assign(arrays.localRotations, arrays.localRotations + count);
+			m_localScales.assign(arrays.localScales, arrays.localScales + count);
+			m_parents.assign(arrays.parents, arrays.parents + count);
+			m_flags.assign(arrays.flags, arrays.flags + count);
+			m_depths.resize(count);
+
+			if (arrays.worldMatrices != nullptr) { m_worldMatrices.assign(arrays.worldMatrices, arrays.worldMatrices + count); }
+			else { m_worldMatrices.assign(count, Transform::IDENTITYWORLD); }
+
+			// Identity handle table. Indices from before keep their bumped generations , the ones past count go back on the free list
+			m_slotNodes.resize(count);
+			for (uint32_t slot = 0; slot < count; ++slot) { m_slotNodes[slot] = slot; }
+
+			if (m_nodeSlots.size() < count)
+			{
+				m_nodeSlots.resize(count);
+				m_generations.resize(count, 0);
+			}
+			for (uint32_t index = 0; index < count; ++index) { m_nodeSlots[index] = index; }
+
+			m_freeNodes.clear();
+			for (uint32_t index = static_cast<uint32_t>(m_nodeSlots.size()); index-- > count;) { m_freeNodes.push_back(index); }
+
+			m_frozenCount = arrays.frozenCount;
+
+			// Same pass as the end of Compact. Saved requests and last update marks are dropped , without world matrices
+			// every node gets computed from scratch
+			for (uint32_t slot = 0; slot < count; ++slot)
+			{
+				uint8_t& flags = m_flags[slot];
+				flags &= FROZEN | DIRTY;
+				if (arrays.worldMatrices == nullptr) { flags |= DIRTY; }
+
+				if (slot < m_frozenCount)
+				{
+					m_depths[slot] = 0;
+					if ((flags & DIRTY) != 0) { ComposeWorld(slot); }
+					flags = FROZEN;
+					continue;
+				}
+
+				const uint32_t depth = GetChildDepth(m_parents[slot]);
+				m_depths[slot] = depth;
+
+				// Saved from a hierarchy in depth order this never happens , anything else gets sorted by the next Compact
+				if (!m_sorted) { continue; }
+
+				if (depth + 1 < m_levelStarts.size()) { m_sorted = false; }
+				else if (depth == m_levelStarts.size())
+				{
+					m_levelStarts.push_back(slot);
+					m_levelFlags.push_back(0);
+				}
+
+				if (m_sorted && (flags & DIRTY) != 0) { m_levelFlags[depth] |= LEVELDIRTY; }
+			}
+
+			return true;
+		}
+
+		void TransformHierarchy::OrderFrozen(std::vector<uint32_t>& bfsOrder)
+		{
+			enum SUBTREEREQUEST : uint8_t
+			{
+				NOREQUEST,
+				FREEZEREQUEST,
+				UNFREEZEREQUEST
+			};
+
+			const size_t count = m_parents.size();
+
+			// Per (old) slot : the request its subtree inherits and , for live nodes , the depth below the nearest frozen ancestor
+			std::vector<SUBTREEREQUEST> requests(count, NOREQUEST);
+			std::vector<uint32_t> liveDepths(count, 0);
+
+			std::vector<uint32_t> frozen;
+			std::vector<uint32_t> levelCounts;
+
+			for (uint32_t slot : bfsOrder)
+			{
+				const uint32_t parentSlot = m_parents[slot];
+				uint8_t& flags = m_flags[slot];
+
+				// A node's own request beats the one it inherits
+				SUBTREEREQUEST request = parentSlot != INVALIDSLOT ? requests[parentSlot] : NOREQUEST;
+				if ((flags & FREEZEPENDING) != 0) { request = FREEZEREQUEST; }
+				if ((flags & UNFREEZEPENDING) != 0) { request = UNFREEZEREQUEST; }
+				requests[slot] = request;
+
+				const bool wasFrozen = (flags & FROZEN) != 0;
+				const bool parentFrozen = parentSlot == INVALIDSLOT || (m_flags[parentSlot] & FROZEN) != 0;
+				const bool isFrozen = parentFrozen && request != UNFREEZEREQUEST && (wasFrozen || request == FREEZEREQUEST);
+
+				flags &= ~(FREEZEPENDING | UNFREEZEPENDING);
+
+				if (isFrozen)
+				{
+					// DIRTY asks Compact to bake it
+					if (!wasFrozen) { flags = FROZEN | DIRTY; }
+					frozen.push_back(slot);
+					continue;
+				}
+
+				// Thawed nodes come back dirty so the sweep takes them (and everything below) from here
+				if (wasFrozen) { flags = DIRTY; }
+
+				const uint32_t depth = parentSlot == INVALIDSLOT || (m_flags[parentSlot] & FROZEN) != 0 ? 0 : liveDepths[parentSlot] + 1;
+				liveDepths[slot] = depth;
+
+				if (depth >= levelCounts.size()) { levelCounts.resize(static_cast<size_t>(depth) + 1, 0); }
+				++levelCounts[depth];
+			}
+
+			m_frozenCount = static_cast<uint32_t>(frozen.size());
+
+			// Frozen prefix in breadth first order , then the live nodes counting sorted by live depth (stable , so parents stay first)
+			uint32_t offset = m_frozenCount;
+			for (uint32_t& levelCount : levelCounts)
+			{
+				const uint32_t size = levelCount;
+				levelCount = offset;
+				offset += size;
+			}
+
+			std::vector<uint32_t> order(bfsOrder.size());
+			std::copy(frozen.begin(), frozen.end(), order.begin());
+			for (uint32_t slot : bfsOrder)
+			{
+				if ((m_flags[slot] & FROZEN) == 0) { order[levelCounts[liveDepths[slot]]++] = slot; }
+			}
+
+			bfsOrder.swap(order);
+		}
+
+		void TransformHierarchy::Permute(std::vector<uint32_t>& order)
+		{
+			// In place along the cycles of the permutation (slot i takes old slot order[i]) , so every array moves in one pass without
+			// a second copy of the hierarchy. After a few reparents most slots stay where they are and cost a single compare
+			const uint32_t count = static_cast<uint32_t>(order.size());
+			for (uint32_t start = 0; start < count; ++start)
+			{
+				if (order[start] == start) { continue; }
+
+				const Vector3 position = m_localPositions[start];
+				const Quaternion rotation = m_localRotations[start];
+				const Vector3 scale = m_localScales[start];
+				const Transform::WorldMatrix world = m_worldMatrices[start];
+				const uint32_t parent = m_parents[start];
+				const uint8_t flags = m_flags[start];
+				const uint32_t node = m_slotNodes[start];
+
+				uint32_t slot = start;
+				for (;;)
+				{
+					const uint32_t source = order[slot];
+					order[slot] = slot;
+
+					if (source == start) { break; }
+
+					m_localPositions[slot] = m_localPositions[source];
+					m_localRotations[slot] = m_localRotations[source];
+					m_localScales[slot] = m_localScales[source];
+					m_worldMatrices[slot] = m_worldMatrices[source];
+					m_parents[slot] = m_parents[source];
+					m_flags[slot] = m_flags[source];
+					m_slotNodes[slot] = m_slotNodes[source];
+					slot = source;
+				}
+
+				m_localPositions[slot] = position;
+				m_localRotations[slot] = rotation;
+				m_localScales[slot] = scale;
+				m_worldMatrices[slot] = world;
+				m_parents[slot] = parent;
+				m_flags[slot] = flags;
+				m_slotNodes[slot] = node;
+			}
+		}
+
+		void TransformHierarchy::Resize(uint32_t count)
+		{
+			m_localPositions.resize(count);
+			m_localRotations.resize(count);
+			m_localScales.resize(count);
+			m_worldMatrices.resize(count);
+			m_parents.resize(count);
+			m_depths.resize(count);
+			m_flags.resize(count);
+			m_slotNodes.resize(count);
+		}
+
+		uint32_t TransformHierarchy::GetSlot(TransformHandle node) const
+		{
+			return GetCheckedSlot(node);
+		}
+
+		TransformHandle TransformHierarchy::GetHandle(uint32_t slot) const
+		{
+			if (slot >= m_slotNodes.size()) { return TransformHandle{}; }
+
+			const uint32_t index = m_slotNodes[slot];
+			return TransformHandle{ index, m_generations[index] };
+		}
+
+		uint32_t TransformHierarchy::GetLevelBegin(uint32_t depth) const
+		{
+			return depth < m_levelStarts.size() ? m_levelStarts[depth] : static_cast<uint32_t>(m_parents.size());
+		}
+
+		void TransformHierarchy::CopyWorldMatrices(uint32_t firstSlot, uint32_t count, Matrix* destination) const
+		{
+			const uint32_t slotCount = static_cast<uint32_t>(m_worldMatrices.size());
+			if (firstSlot >= slotCount) { return; }
+
+			count = std::min(count, slotCount - firstSlot);
+
+#ifdef SNP_AFFINE_WORLDMATRIX
+			Math::ExpandAffine(m_worldMatrices.data() + firstSlot, destination, count);
+#else
+			std::memcpy(destination, m_worldMatrices.data() + firstSlot, count * sizeof(Matrix));
+#endif
+		}
+
+		void TransformHierarchy::MarkDirty(uint32_t slot)
+		{
+			// Frozen nodes keep the edit for when they get unfrozen , their world matrix stays as baked
+			if ((m_flags[slot] & FROZEN) != 0) { return; }
+
+			m_flags[slot] |= DIRTY;
+
+			// Level data is rebuilt by Compact when the order is broken
+			if (m_sorted) { m_levelFlags[m_depths[slot]] |= LEVELDIRTY; }
+		}
+
+		uint32_t TransformHierarchy::GetChildDepth(uint32_t parentSlot) const
+		{
+			return parentSlot == INVALIDSLOT || (m_flags[parentSlot] & FROZEN) != 0 ? 0 : m_depths[parentSlot] + 1;
+		}
+
+		uint32_t TransformHierarchy::GetCheckedSlot(TransformHandle node) const
+		{
+			if (node.index >= m_nodeSlots.size() || m_generations[node.index] != node.generation) { return INVALIDSLOT; }
+
+			// Removed nodes keep their slot until Compact but are already gone for the public interface
+			const uint32_t slot = m_nodeSlots[node.index];
+			return slot != INVALIDSLOT && (m_flags[slot] & REMOVED) == 0 ? slot : INVALIDSLOT;
+		}
+	}
+}
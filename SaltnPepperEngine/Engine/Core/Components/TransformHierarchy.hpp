@@ -0,0 +1,319 @@
+#ifndef TRANSFORMHIERARCHY_H
+#define TRANSFORMHIERARCHY_H
+#include "Core/EngineDefines.hpp"
+#include "Core/Components/Transform.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		/// <summary>
+		/// Stable reference to a node in a TransformHierarchy. The generation changes when the node is removed ,
+		/// so stale handles are detected instead of pointing at whatever reused the index
+		/// </summary>
+		struct TransformHandle
+		{
+			uint32_t index = UINT32_MAX;
+			uint32_t generation = 0;
+
+			constexpr bool operator==(const TransformHandle& other) const { return index == other.index && generation == other.generation; }
+			constexpr bool operator!=(const TransformHandle& other) const { return !(*this == other); }
+		};
+
+		/// <summary>
+		/// Slot arrays of a whole hierarchy in TransformHierarchy's own layout (as saved by a scene file) , see TransformHierarchy::Assign.
+		/// worldMatrices may be null , the world matrices are then rebuilt by the next Update
+		/// </summary>
+		struct TransformSlotArrays
+		{
+			const Vector3* localPositions = nullptr;
+			const Quaternion* localRotations = nullptr;
+			const Vector3* localScales = nullptr;
+			const Transform::WorldMatrix* worldMatrices = nullptr;
+			const uint32_t* parents = nullptr;
+			const uint8_t* flags = nullptr;
+
+			uint32_t count = 0;
+			uint32_t frozenCount = 0;
+		};
+
+		/// <summary>
+		/// Flat transform hierarchy : local TRS , world matrices , parent links and flags live in parallel arrays (slots)
+		/// sorted by depth , so every parent sits before its children and one linear sweep updates the whole tree.
+		/// Structural changes that break the order (reparenting to another depth , removals) are batched and fixed up by
+		/// Compact , which Update runs on its own when needed.
+		/// Static geometry can be frozen : Compact moves frozen nodes into a prefix of the slot arrays with their world matrices
+		/// baked once , the update sweeps only ever walk the slots behind it. Not thread safe
+		/// </summary>
+		class SNP_API TransformHierarchy
+		{
+		public:
+
+			enum FLAGS : uint8_t
+			{
+				NONE = 0,
+				// Local TRS changed since the last Update (same bit as Transform::DIRTY)
+				DIRTY = Transform::DIRTY,
+				// The world matrix was rewritten by the last Update
+				WORLDCHANGED = 1 << 1,
+				// Removed , the slot (and its subtree) goes away on the next Compact
+				REMOVED = 1 << 2,
+				// World matrix baked , the slot sits in the frozen prefix and Update never visits it
+				FROZEN = 1 << 3,
+				// Freeze / Unfreeze of the subtree requested , carried out by the next Compact
+				FREEZEPENDING = 1 << 4,
+				UNFREEZEPENDING = 1 << 5
+			};
+
+			// Parent slot of root nodes / unused index table entries
+			inline static constexpr uint32_t INVALIDSLOT = UINT32_MAX;
+
+			// Slots per job slice , wider depth levels get split across the job system
+			inline static constexpr uint32_t PARALLELGRAIN = 4096;
+
+			// Smallest job in the deep tail (the run of narrow levels at the bottom) , which is split by subtree instead of by level
+			inline static constexpr uint32_t TAILCHUNKMINIMUM = 1024;
+
+			TransformHierarchy() = default;
+
+			void Reserve(size_t count);
+
+			/// <summary>
+			/// Removes every node , all handles become invalid
+			/// </summary>
+			void Clear();
+
+
+			// ================ STRUCTURE ======================
+
+			/// <summary>
+			/// Adds a node with an identity local transform under parent (a root for an invalid handle)
+			/// </summary>
+			TransformHandle Create(TransformHandle parent = TransformHandle{});
+
+			/// <summary>
+			/// Adds a node with the local position , rotation and scale of transform
+			/// </summary>
+			TransformHandle Create(const Transform& transform, TransformHandle parent = TransformHandle{});
+
+			/// <summary>
+			/// Removes the node and its whole subtree. The node's handle is invalid right away , the descendants' handles
+			/// stay valid until the next Compact / Update releases them
+			/// </summary>
+			void Remove(TransformHandle node);
+
+			/// <summary>
+			/// Moves node under parent (makes it a root for an invalid handle). keepWorldTransform recomputes the local TRS
+			/// from the world matrices of the last Update so the node stays put. Returns false if parent is node itself or one of its descendants
+			/// </summary>
+			bool SetParent(TransformHandle node, TransformHandle parent, bool keepWorldTransform = false);
+
+			TransformHandle GetParent(TransformHandle node) const;
+
+			bool IsValid(TransformHandle node) const;
+
+			/// <summary>
+			/// Nodes in the slot arrays (removed ones included until the next Compact)
+			/// </summary>
+			size_t GetCount() const { return m_parents.size(); }
+
+
+			// ================ LOCAL TRANSFORM ======================
+
+			const Vector3& GetLocalPosition(TransformHandle node) const;
+			const Quaternion& GetLocalRotation(TransformHandle node) const;
+			const Vector3& GetLocalScale(TransformHandle node) const;
+
+			void SetLocalPosition(TransformHandle node, const Vector3& position);
+			void SetLocalRotation(TransformHandle node, const Quaternion& rotation);
+			void SetLocalScale(TransformHandle node, const Vector3& scale);
+			void SetLocalTransform(TransformHandle node, const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+			void SetDirty(TransformHandle node);
+			bool IsDirty(TransformHandle node) const;
+
+
+			// ================ WORLD TRANSFORM ======================
+
+			/// <summary>
+			/// World matrix as of the last Update (expanded to 4x4 with SNP_AFFINE_WORLDMATRIX)
+			/// </summary>
+			const Matrix GetWorldMatrix(TransformHandle node) const;
+
+			/// <summary>
+			/// True when the last Update rewrote the node's world matrix (its own or an ancestor's local TRS changed)
+			/// </summary>
+			bool HasWorldChanged(TransformHandle node) const;
+
+			/// <summary>
+			/// Copies the node into a standalone Transform (local TRS , world matrix and its decomposed world TRS)
+			/// </summary>
+			Transform ToTransform(TransformHandle node) const;
+
+
+			// ================ STATIC NODES ======================
+
+			/// <summary>
+			/// Marks the node and its whole subtree static. The next Compact (Update runs it) bakes their world matrices into the frozen
+			/// prefix , from then on update sweeps skip them entirely. Local edits on a frozen node are kept but don't reach its world
+			/// matrix until it is unfrozen , and it can't be reparented. Returns false (and changes nothing) unless the node is a root itself
+			/// or its parent is frozen or being frozen and not being unfrozen (a frozen node can't follow a moving parent).
+			/// Live children of frozen nodes keep updating as usual
+			/// </summary>
+			bool Freeze(TransformHandle node);
+
+			/// <summary>
+			/// Rare edits : moves the node and its whole subtree back to the live slots on the next Compact , marked dirty
+			/// </summary>
+			void Unfreeze(TransformHandle node);
+
+			bool IsFrozen(TransformHandle node) const;
+
+			/// <summary>
+			/// Slots [0 , GetFrozenCount()) are the frozen prefix. Only meaningful while !NeedsCompact()
+			/// </summary>
+			uint32_t GetFrozenCount() const { return m_frozenCount; }
+
+
+			// ================ UPDATE ======================
+
+			/// <summary>
+			/// Compacts if the structure changed , then recomputes the world matrix of every dirty node and its descendants
+			/// in parent before child order. Depth levels without dirty nodes or changed parents are skipped whole.
+			/// With parallel set , wide levels are split across the job system and the deep tail of narrow levels is split by subtree ,
+			/// every node still goes through the same math so the result matches the serial sweep bit for bit.
+			/// Don't call it from inside a job
+			/// </summary>
+			void Update(bool parallel = true);
+
+			/// <summary>
+			/// Drops removed subtrees , recycles their handles and restores the depth order. Slot numbers change
+			/// </summary>
+			void Compact();
+
+			bool NeedsCompact() const { return !m_sorted || m_hasRemovals; }
+
+
+			// ================ BULK LOAD ======================
+
+			/// <summary>
+			/// Replaces the whole hierarchy with slot arrays saved from another one : straight copies into the slot arrays and one pass
+			/// over the parents to rebuild the depth levels , no per node allocation or sorting. Node i gets slot i and handle index i.
+			/// Every parent has to sit before its child and the frozen nodes have to form the prefix , returns false (and leaves the
+			/// hierarchy empty) otherwise. Handles from before are invalid afterwards
+			/// </summary>
+			bool Assign(const TransformSlotArrays& arrays);
+
+
+			// ================ SLOT ACCESS ======================
+			// Direct array access for linear passes (culling , uploads). Slots stay put until the next Compact
+
+			uint32_t GetSlot(TransformHandle node) const;
+			TransformHandle GetHandle(uint32_t slot) const;
+
+			// In the Transform::WorldMatrix storage layout
+			const Transform::WorldMatrix* GetWorldMatrices() const { return m_worldMatrices.data(); }
+			const uint32_t* GetParentSlots() const { return m_parents.data(); }
+			const uint8_t* GetFlags() const { return m_flags.data(); }
+			const Vector3* GetLocalPositions() const { return m_localPositions.data(); }
+			const Quaternion* GetLocalRotations() const { return m_localRotations.data(); }
+			const Vector3* GetLocalScales() const { return m_localScales.data(); }
+
+			/// <summary>
+			/// Depth levels of the live slots , level d covers slots [GetLevelBegin(d) , GetLevelBegin(d + 1)). Depths count from the
+			/// nearest frozen ancestor , so a live child of a frozen node sits on level 0. Only meaningful while !NeedsCompact()
+			/// </summary>
+			uint32_t GetDepthCount() const { return static_cast<uint32_t>(m_levelStarts.size()); }
+			uint32_t GetLevelBegin(uint32_t depth) const;
+
+			/// <summary>
+			/// Upload path : copies the world matrices of slots [firstSlot , firstSlot + count) as full 4x4 matrices into destination
+			/// (a staging or mapped buffer) , expanding the 3x4 storage on the fly. Slices can be copied from several jobs at once
+			/// </summary>
+			void CopyWorldMatrices(uint32_t firstSlot, uint32_t count, Matrix* destination) const;
+
+		private:
+
+			enum LEVELFLAGS : uint8_t
+			{
+				// Some node in the level is DIRTY
+				LEVELDIRTY = 1 << 0,
+				// Some node in the level has WORLDCHANGED set
+				LEVELCHANGED = 1 << 1
+			};
+
+			uint32_t AllocateNode(uint32_t parentSlot);
+			void Permute(std::vector<uint32_t>& order);
+			void Resize(uint32_t count);
+			uint32_t GetCheckedSlot(TransformHandle node) const;
+			void MarkDirty(uint32_t slot);
+
+			/// <summary>
+			/// Depth of a live child of parentSlot (levels restart below frozen nodes)
+			/// </summary>
+			uint32_t GetChildDepth(uint32_t parentSlot) const;
+
+			/// <summary>
+			/// World matrix of the slot from its local TRS and its parent's world matrix
+			/// </summary>
+			void ComposeWorld(uint32_t slot);
+
+			/// <summary>
+			/// Works out which nodes end up frozen (requests applied , the frozen set closed under parents) and the frozen first ,
+			/// then live depth order Compact lays them out in. bfsOrder holds the live nodes parents first
+			/// </summary>
+			void OrderFrozen(std::vector<uint32_t>& bfsOrder);
+
+			/// <summary>
+			/// Recomputes the world matrix of the slot if its own or its parent's flags ask for it , the parent must be done already.
+			/// Returns whether it changed
+			/// </summary>
+			bool UpdateSlot(uint32_t slot);
+			bool UpdateRange(uint32_t begin, uint32_t end);
+			bool UpdateRangeParallel(uint32_t begin, uint32_t end);
+
+			/// <summary>
+			/// Groups the deep tail by the subtree it belongs to and packs the groups into jobs
+			/// </summary>
+			void BuildTail();
+			void UpdateTail(bool parentChanged);
+
+			// ======== SLOT ARRAYS (depth sorted) ========
+			std::vector<Vector3> m_localPositions;
+			std::vector<Quaternion> m_localRotations;
+			std::vector<Vector3> m_localScales;
+			std::vector<Transform::WorldMatrix> m_worldMatrices;
+			std::vector<uint32_t> m_parents;
+			std::vector<uint32_t> m_depths;
+			std::vector<uint8_t> m_flags;
+			std::vector<uint32_t> m_slotNodes;
+
+			// First slot and LEVELFLAGS of every depth
+			std::vector<uint32_t> m_levelStarts;
+			std::vector<uint8_t> m_levelFlags;
+
+			// ======== DEEP TAIL (parallel updates) ========
+			// Levels from m_tailLevel down , as slot lists per subtree (parents before children) packed into jobs
+			uint32_t m_tailLevel = 0;
+			std::vector<uint32_t> m_tailOrder;
+			std::vector<uint32_t> m_tailChunks;
+			bool m_tailValid = false;
+
+			// ======== HANDLE TABLE ========
+			std::vector<uint32_t> m_nodeSlots;
+			std::vector<uint32_t> m_generations;
+			std::vector<uint32_t> m_freeNodes;
+
+			// Length of the frozen prefix
+			uint32_t m_frozenCount = 0;
+
+			bool m_sorted = true;
+			bool m_hasRemovals = false;
+		};
+	}
+}
+
+#endif // !TRANSFORMHIERARCHY_H
@@ -0,0 +1,127 @@
+#include "TransformInterpolation.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		namespace
+		{
+			// Identity TRS per stream (position , rotation , scale)
+			inline static constexpr float IDENTITYSTREAMS[] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+		}
+
+		Math::TransformSoA TransformInterpolation::MakeView(float* base, size_t stride)
+		{
+			Math::TransformSoA view;
+			for (size_t axis = 0; axis < 3; ++axis) { view.position[axis] = base + axis * stride; }
+			for (size_t axis = 0; axis < 4; ++axis) { view.rotation[axis] = base + (3 + axis) * stride; }
+			for (size_t axis = 0; axis < 3; ++axis) { view.scale[axis] = base + (7 + axis) * stride; }
+			return view;
+		}
+
+		Math::TransformSoA TransformInterpolation::OffsetView(const Math::TransformSoA& view, size_t offset)
+		{
+			Math::TransformSoA result;
+			for (size_t axis = 0; axis < 3; ++axis) { result.position[axis] = view.position[axis] + offset; }
+			for (size_t axis = 0; axis < 4; ++axis) { result.rotation[axis] = view.rotation[axis] + offset; }
+			for (size_t axis = 0; axis < 3; ++axis) { result.scale[axis] = view.scale[axis] + offset; }
+			return result;
+		}
+
+		void TransformInterpolation::Resize(size_t count)
+		{
+			const size_t stride = (count + STREAMALIGNMENT - 1) & ~(STREAMALIGNMENT - 1);
+			const size_t kept = std::min(count, m_count);
+
+			StreamStorage streams(stride * STREAMCOUNT);
+			for (size_t stream = 0; stream < STREAMCOUNT; ++stream)
+			{
+				float* destination = streams.data() + stream * stride;
+				if (kept > 0) { std::memcpy(destination, m_streams.data() + stream * m_stride, kept * sizeof(float)); }
+				std::fill(destination + kept, destination + stride, IDENTITYSTREAMS[stream % STATESTREAMS]);
+			}
+
+			m_streams.swap(streams);
+			m_count = count;
+			m_stride = stride;
+
+			m_previous = MakeView(m_streams.data(), m_stride);
+			m_current = MakeView(m_streams.data() + STATESTREAMS * m_stride, m_stride);
+		}
+
+
+		// ================ FIXED STEP ======================
+
+		void TransformInterpolation::BeginStep()
+		{
+			// The current streams sit right behind the previous ones , one copy moves the whole state
+			if (m_count > 0) { std::memcpy(m_streams.data(), m_streams.data() + STATESTREAMS * m_stride, STATESTREAMS * m_stride * sizeof(float)); }
+		}
+
+		void TransformInterpolation::SetCurrent(size_t slot, const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+		{
+			if (slot >= m_count) { return; }
+
+			m_current.position[0][slot] = position.x;
+			m_current.position[1][slot] = position.y;
+			m_current.position[2][slot] = position.z;
+			m_current.rotation[0][slot] = rotation.x;
+			m_current.rotation[1][slot] = rotation.y;
+			m_current.rotation[2][slot] = rotation.z;
+			m_current.rotation[3][slot] = rotation.w;
+			m_current.scale[0][slot] = scale.x;
+			m_current.scale[1][slot] = scale.y;
+			m_current.scale[2][slot] = scale.z;
+		}
+
+		void TransformInterpolation::Capture(size_t firstSlot, const Transform* transforms, size_t count)
+		{
+			if (firstSlot >= m_count) { return; }
+
+			count = std::min(count, m_count - firstSlot);
+			for (size_t index = 0; index < count; ++index)
+			{
+				// The cached world TRS , rebuilds the simulation's world matrix exactly unless the parent chain shears (see Transform::GetScale)
+				const Transform& transform = transforms[index];
+				SetCurrent(firstSlot + index, transform.GetPosition(), transform.GetRotation(), transform.GetScale());
+			}
+		}
+
+		void TransformInterpolation::Snap(size_t slot)
+		{
+			if (slot >= m_count) { return; }
+
+			for (size_t stream = 0; stream < STATESTREAMS; ++stream) { m_streams[stream * m_stride + slot] = m_streams[(STATESTREAMS + stream) * m_stride + slot]; }
+		}
+
+
+		// ================ RENDER ======================
+
+		void TransformInterpolation::Interpolate(float alpha, Matrix* output, bool parallel) const
+		{
+			if (!parallel || m_count <= PARALLELGRAIN)
+			{
+				Interpolate(alpha, 0, m_count, output);
+				return;
+			}
+
+			Jobs::JobSystem::ParallelFor(m_count, PARALLELGRAIN, [this, alpha, output](size_t begin, size_t end)
+			{
+				Interpolate(alpha, begin, end - begin, output + begin);
+			});
+		}
+
+		void TransformInterpolation::Interpolate(float alpha, size_t firstSlot, size_t count, Matrix* output) const
+		{
+			if (firstSlot >= m_count) { return; }
+
+			count = std::min(count, m_count - firstSlot);
+			alpha = std::clamp(alpha, 0.0f, 1.0f);
+
+			Math::InterpolateTransformBatch(OffsetView(m_previous, firstSlot), OffsetView(m_current, firstSlot), alpha, output, count);
+		}
+	}
+}
@@ -0,0 +1,107 @@
+#ifndef TRANSFORMINTERPOLATION_H
+#define TRANSFORMINTERPOLATION_H
+#include "Core/EngineDefines.hpp"
+#include "Core/Components/Transform.hpp"
+#include "Core/Memory/MemoryDefinitions.hpp"
+#include "Utilities/Math/TransformBatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		/// <summary>
+		/// Render side copy of the world TRS of the last two fixed simulation steps , one slot per object.
+		/// The simulation captures its transforms once per step , every rendered frame then blends the two states by the
+		/// accumulator alpha into world matrices of its own , so the simulation's world matrices are never touched.
+		/// Both states are kept as SoA float streams (10 per state) in one allocation for the batched kernel. Not thread safe
+		/// </summary>
+		class SNP_API TransformInterpolation
+		{
+		public:
+
+			// Slots per job slice of the parallel Interpolate
+			inline static constexpr size_t PARALLELGRAIN = 4096;
+
+			TransformInterpolation() = default;
+			explicit TransformInterpolation(size_t count) { Resize(count); }
+
+			/// <summary>
+			/// Grows or shrinks to count slots , the kept slots keep both states and new ones start at identity
+			/// </summary>
+			void Resize(size_t count);
+
+			void Clear() { Resize(0); }
+
+			size_t GetCount() const { return m_count; }
+
+
+			// ================ FIXED STEP ======================
+
+			/// <summary>
+			/// Start of a fixed step : the current state of every slot becomes the previous one
+			/// </summary>
+			void BeginStep();
+
+			/// <summary>
+			/// Writes the current state of one slot
+			/// </summary>
+			void SetCurrent(size_t slot, const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+			/// <summary>
+			/// Writes the current state of slots [firstSlot , firstSlot + count) from the cached world TRS of transforms
+			/// (a Transform array or an ECS chunk column). Slices can be captured from several jobs at once
+			/// </summary>
+			void Capture(size_t firstSlot, const Transform* transforms, size_t count);
+
+			/// <summary>
+			/// Copies the current state over the previous one so the slot doesn't blend in from where it was (teleports , spawns)
+			/// </summary>
+			void Snap(size_t slot);
+
+
+			// ================ RENDER ======================
+
+			/// <summary>
+			/// Blends every slot by alpha (0 = previous step , 1 = current step , clamped) into output , one 4x4 world matrix per slot.
+			/// With parallel set the slots are split across the job system , don't call it from inside a job then
+			/// </summary>
+			void Interpolate(float alpha, Matrix* output, bool parallel = true) const;
+
+			/// <summary>
+			/// Blends slots [firstSlot , firstSlot + count) into output[0 , count) , slices can run on several jobs at once
+			/// </summary>
+			void Interpolate(float alpha, size_t firstSlot, size_t count, Matrix* output) const;
+
+			// Stream views , slot i of a state is element i of each of its arrays
+			const Math::TransformSoA& GetPrevious() const { return m_previous; }
+			const Math::TransformSoA& GetCurrent() const { return m_current; }
+
+		private:
+
+			// Floats per stream are rounded up to whole cache lines , with the storage cache line aligned every stream starts on one
+			inline static constexpr size_t STREAMALIGNMENT = 16;
+			inline static constexpr size_t CACHELINESIZE = STREAMALIGNMENT * sizeof(float);
+
+			using StreamStorage = std::vector<float, Memory::AlignedAllocator<float, CACHELINESIZE>>;
+
+			// Position x , y , z , rotation x , y , z , w , scale x , y , z. The previous state's streams come first , then the current one's
+			inline static constexpr size_t STATESTREAMS = 10;
+			inline static constexpr size_t STREAMCOUNT = 2 * STATESTREAMS;
+
+			static Math::TransformSoA MakeView(float* base, size_t stride);
+			static Math::TransformSoA OffsetView(const Math::TransformSoA& view, size_t offset);
+
+			StreamStorage m_streams;
+			size_t m_count = 0;
+			size_t m_stride = 0;
+
+			Math::TransformSoA m_previous;
+			Math::TransformSoA m_current;
+		};
+	}
+}
+
+#endif // !TRANSFORMINTERPOLATION_H
@@ -0,0 +1,126 @@
+#include "TransformJournal.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		TransformJournal::TransformJournal(uint32_t idCount)
+		{
+			Resize(idCount);
+		}
+
+		void TransformJournal::Resize(uint32_t idCount)
+		{
+			EnsureLanes();
+
+			for (const Memory::UniquePtr<Lane>& lane : m_lanes)
+			{
+				for (uint32_t id : lane->ids)
+				{
+					if (id < idCount) { continue; }
+
+					m_recorded[id] = 0;
+					m_deltas[id] = nullptr;
+				}
+
+				lane->ids.erase(std::remove_if(lane->ids.begin(), lane->ids.end(), [idCount](uint32_t id) { return id >= idCount; }), lane->ids.end());
+			}
+
+			m_recorded.resize(idCount, 0);
+			m_deltas.resize(idCount, nullptr);
+		}
+
+
+		void TransformJournal::EnsureLanes()
+		{
+			const uint32_t laneCount = std::max(Jobs::JobSystem::GetThreadCount(), 1u);
+			while (m_lanes.size() < laneCount) { m_lanes.push_back(Memory::MakeUnique<Lane>()); }
+		}
+
+		TransformJournal::Lane& TransformJournal::GetLane()
+		{
+			const uint32_t laneIndex = Jobs::JobSystem::GetThreadIndex();
+			if (laneIndex >= m_lanes.size())
+			{
+				// A programming error , the journal was created before JobSystem::OnInit and not resized / ended a frame since
+				LOG_CRITICAL("TransformJournal has {0} lanes , recording from thread {1}", m_lanes.size(), laneIndex);
+				SNP_BREAK();
+				return *m_lanes[0];
+			}
+
+			return *m_lanes[laneIndex];
+		}
+
+
+		// ================ RECORDING ======================
+
+		bool TransformJournal::Claim(uint32_t id, Lane& lane)
+		{
+			// Plain loads and stores : no other thread touches this id until the next sync point , and the job system's
+			// joins order the claims of one phase before the next
+			if (m_recorded[id] != 0) { return false; }
+
+			m_recorded[id] = 1;
+			lane.ids.push_back(id);
+			return true;
+		}
+
+		void TransformJournal::Record(uint32_t id)
+		{
+			if (id < m_recorded.size()) { Claim(id, GetLane()); }
+		}
+
+		void TransformJournal::Record(uint32_t id, const TransformValues& before, const TransformValues& after)
+		{
+			if (id >= m_recorded.size()) { return; }
+
+			Lane& lane = GetLane();
+			Claim(id, lane);
+
+			TransformDelta*& delta = m_deltas[id];
+			if (delta != nullptr)
+			{
+				delta->after = after;
+				return;
+			}
+
+			// Arena blocks never move , so the pointer stays valid for whichever thread records the id next
+			delta = lane.arenas[m_arenaIndex].Allocate<TransformDelta>();
+			delta->before = before;
+			delta->after = after;
+		}
+
+
+		// ================ FRAME ======================
+
+		void TransformJournal::EndFrame()
+		{
+			m_changes.clear();
+			for (const Memory::UniquePtr<Lane>& lane : m_lanes)
+			{
+				for (uint32_t id : lane->ids)
+				{
+					m_changes.push_back(TransformChange{ id, m_deltas[id] });
+
+					// Only the ids that were touched get reset , the cost follows the changed set and not the id range
+					m_recorded[id] = 0;
+					m_deltas[id] = nullptr;
+				}
+
+				lane->ids.clear();
+			}
+
+			// Which lane claimed an id depends on scheduling , sorting keeps the published order deterministic
+			std::sort(m_changes.begin(), m_changes.end(), [](const TransformChange& first, const TransformChange& second) { return first.id < second.id; });
+
+			// The published deltas stay in the arenas just filled , the next frame records into the other ones
+			m_arenaIndex ^= 1;
+			for (const Memory::UniquePtr<Lane>& lane : m_lanes) { lane->arenas[m_arenaIndex].Reset(); }
+
+			EnsureLanes();
+		}
+	}
+}
@@ -0,0 +1,142 @@
+#ifndef TRANSFORMJOURNAL_H
+#define TRANSFORMJOURNAL_H
+#include "Core/EngineDefines.hpp"
+#include "Core/Components/Transform.hpp"
+#include "Core/Memory/LinearArena.hpp"
+#include "Core/Memory/MemoryDefinitions.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		/// <summary>
+		/// Local TRS of a transform as the journal stores it
+		/// </summary>
+		struct TransformValues
+		{
+			Vector3 localPosition = Vector3{ 0.0f,0.0f,0.0f };
+			Quaternion localRotation = Quaternion{ 0.0f,0.0f,0.0f,1.0f };
+			Vector3 localScale = Vector3{ 1.0f,1.0f,1.0f };
+
+			static TransformValues From(const Transform& transform) { return TransformValues{ transform.localPosition, transform.localRotation, transform.localScale }; }
+		};
+
+		/// <summary>
+		/// Values of one transform across a frame : before its first recorded change and after its latest
+		/// </summary>
+		struct TransformDelta
+		{
+			TransformValues before;
+			TransformValues after;
+		};
+
+		struct TransformChange
+		{
+			uint32_t id = 0;
+
+			// nullptr unless a change of this id was recorded with values
+			const TransformDelta* delta = nullptr;
+		};
+
+		/// <summary>
+		/// Per frame list of the transforms that changed , so replication , physics sync , spatial indices and the editor
+		/// walk just the changed set instead of scanning everything for Transform::IsDirty. Ids are whatever the caller
+		/// indexes transforms by (entity index , hierarchy slot ...) below GetIdCount().
+		/// Every job thread records into its own lane and each id is claimed once per frame , so recording takes no locks and
+		/// no atomics. An id must not be recorded from two threads at once (the same rule as for writing the transform itself).
+		/// EndFrame publishes the frame sorted by id. Lanes are sized to JobSystem::GetThreadCount on creation and at every Resize / EndFrame ,
+		/// so a journal created before JobSystem::OnInit must go through one of those before jobs record into it
+		/// (recording from a thread without a lane breaks into the debugger)
+		/// </summary>
+		class SNP_API TransformJournal
+		{
+		public:
+
+			explicit TransformJournal(uint32_t idCount = 0);
+
+			NONCOPYABLE(TransformJournal)
+
+			/// <summary>
+			/// Grows or shrinks the id range , between frames only. Changes recorded this frame on ids that go away are dropped
+			/// </summary>
+			void Resize(uint32_t idCount);
+
+			uint32_t GetIdCount() const { return static_cast<uint32_t>(m_recorded.size()); }
+
+
+			// ================ RECORDING ======================
+			// Any thread , ids outside the range are ignored
+
+			/// <summary>
+			/// Notes that the transform changed this frame
+			/// </summary>
+			void Record(uint32_t id);
+
+			/// <summary>
+			/// Notes the change with its values. The first call with values in a frame keeps before , every call updates after
+			/// </summary>
+			void Record(uint32_t id, const TransformValues& before, const TransformValues& after);
+
+			void Record(uint32_t id, const Transform& before, const Transform& after) { Record(id, TransformValues::From(before), TransformValues::From(after)); }
+
+			/// <summary>
+			/// Whether the id was recorded in the frame being recorded
+			/// </summary>
+			bool IsRecorded(uint32_t id) const { return id < m_recorded.size() && m_recorded[id] != 0; }
+
+
+			// ================ FRAME ======================
+
+			/// <summary>
+			/// Publishes everything recorded since the last call and starts a new frame. Main thread , no jobs may be recording
+			/// </summary>
+			void EndFrame();
+
+			/// <summary>
+			/// The changes of the last published frame , one per id in ascending id order. Valid until the next EndFrame
+			/// </summary>
+			const std::vector<TransformChange>& GetChanges() const { return m_changes; }
+
+			size_t GetChangeCount() const { return m_changes.size(); }
+
+		private:
+
+			// Own cache lines per lane , the threads recording side by side never share one
+			struct alignas(64) Lane
+			{
+				// Ids this lane claimed this frame
+				std::vector<uint32_t> ids;
+
+				// Deltas of the frame being recorded and of the published one , alternating every EndFrame
+				Memory::LinearArena arenas[2];
+			};
+
+			/// <summary>
+			/// Claims the id (in range) for the frame on lane. False if it was claimed already
+			/// </summary>
+			bool Claim(uint32_t id, Lane& lane);
+
+			Lane& GetLane();
+
+			/// <summary>
+			/// Grows the lanes to the job system's thread count , main thread only
+			/// </summary>
+			void EnsureLanes();
+
+			std::vector<Memory::UniquePtr<Lane>> m_lanes;
+			uint32_t m_arenaIndex = 0;
+
+			// ======== PER ID (frame being recorded) ========
+			std::vector<uint8_t> m_recorded;
+			std::vector<TransformDelta*> m_deltas;
+
+			// ======== PUBLISHED FRAME ========
+			std::vector<TransformChange> m_changes;
+		};
+	}
+}
+
+#endif // !TRANSFORMJOURNAL_H
@@ -0,0 +1,29 @@
+#ifndef TRANSFORMREFLECTION_H
+#define TRANSFORMREFLECTION_H
+#include "Core/Components/Transform.hpp"
+#include "Core/Reflection/Reflection.hpp"
+
+namespace SaltnPepperEngine
+{
+	// Kept out of Transform.hpp so only the serializers , replication and tools pay for the reflection machinery
+
+	namespace Reflection
+	{
+		/// <summary>
+		/// The serialized fields of Transform , back to back so they copy / serialize as one 44 byte memcpy
+		/// </summary>
+		template <>
+		struct TypeInfo<Components::Transform>
+		{
+			inline static constexpr FieldInfo FIELDS[] =
+			{
+				SNP_FIELD(Components::Transform, flags),
+				SNP_FIELD(Components::Transform, localPosition),
+				SNP_FIELD(Components::Transform, localScale),
+				SNP_FIELD(Components::Transform, localRotation)
+			};
+		};
+	}
+}
+
+#endif // !TRANSFORMREFLECTION_H
@@ -0,0 +1,218 @@
+#include "Archetype.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		namespace
+		{
+			inline uint32_t AlignUp(uint32_t value, uint32_t alignment)
+			{
+				return (value + alignment - 1) & ~(alignment - 1);
+			}
+		}
+
+		// ================ CHUNK ALLOCATOR ======================
+
+		ChunkAllocator::~ChunkAllocator()
+		{
+			for (uint8_t* block : m_freeBlocks)
+			{
+				operator delete(block, std::align_val_t(CHUNKALIGNMENT));
+			}
+		}
+
+		uint8_t* ChunkAllocator::Allocate(uint32_t size)
+		{
+			++m_usedCount;
+
+			if (size > CHUNKSIZE)
+			{
+				return static_cast<uint8_t*>(operator new(size, std::align_val_t(CHUNKALIGNMENT)));
+			}
+
+			if (m_freeBlocks.empty())
+			{
+				return static_cast<uint8_t*>(operator new(CHUNKSIZE, std::align_val_t(CHUNKALIGNMENT)));
+			}
+
+			uint8_t* block = m_freeBlocks.back();
+			m_freeBlocks.pop_back();
+			return block;
+		}
+
+		void ChunkAllocator::Release(uint8_t* data, uint32_t size)
+		{
+			--m_usedCount;
+
+			if (size > CHUNKSIZE)
+			{
+				operator delete(data, std::align_val_t(CHUNKALIGNMENT));
+				return;
+			}
+
+			m_freeBlocks.push_back(data);
+		}
+
+
+		// ================ ARCHETYPE ======================
+
+		Archetype::Archetype(const ComponentMask& mask, ChunkAllocator& allocator)
+			: m_mask(mask)
+			, m_allocator(&allocator)
+		{
+			uint32_t rowSize = static_cast<uint32_t>(sizeof(Entity));
+			for (uint32_t id = 0; id < MAXCOMPONENTS; ++id)
+			{
+				if (!mask.test(id)) { continue; }
+
+				m_components.push_back(static_cast<ComponentId>(id));
+				m_sizes.push_back(ComponentRegistry::GetInfo(static_cast<ComponentId>(id)).size);
+				rowSize += m_sizes.back();
+			}
+
+			// The version header comes first , then the largest row count whose columns (each aligned for its type) still fit
+			m_entityOffset = AlignUp(static_cast<uint32_t>(m_components.size() * sizeof(uint32_t)), static_cast<uint32_t>(alignof(Entity)));
+			m_offsets.resize(m_components.size());
+			for (m_capacity = std::max((CHUNKSIZE - m_entityOffset) / rowSize, 1u); ; --m_capacity)
+			{
+				uint32_t offset = m_entityOffset + m_capacity * static_cast<uint32_t>(sizeof(Entity));
+				for (size_t column = 0; column < m_components.size(); ++column)
+				{
+					offset = AlignUp(offset, ComponentRegistry::GetInfo(m_components[column]).alignment);
+					m_offsets[column] = offset;
+					offset += m_sizes[column] * m_capacity;
+				}
+
+				if (offset <= CHUNKSIZE) { break; }
+
+				// A single row that doesn't fit gets a block of its own size , one entity per chunk
+				if (m_capacity == 1)
+				{
+					m_chunkSize = AlignUp(offset, CHUNKALIGNMENT);
+					LOG_WARN("Archetype row of {0} bytes exceeds the {1} byte chunk , using oversized single row chunks", offset, CHUNKSIZE);
+					break;
+				}
+			}
+		}
+
+		Archetype::~Archetype()
+		{
+			for (Chunk& chunk : m_chunks)
+			{
+				for (size_t column = 0; column < m_components.size(); ++column)
+				{
+					const ComponentInfo& info = ComponentRegistry::GetInfo(m_components[column]);
+					if (!info.trivial) { info.destruct(GetColumnData(chunk, static_cast<uint32_t>(column)), chunk.count); }
+				}
+
+				m_allocator->Release(chunk.data, m_chunkSize);
+			}
+		}
+
+		uint32_t Archetype::GetColumn(ComponentId id) const
+		{
+			const auto found = std::lower_bound(m_components.begin(), m_components.end(), id);
+			return found != m_components.end() && *found == id ? static_cast<uint32_t>(found - m_components.begin()) : INVALIDCOLUMN;
+		}
+
+		void* Archetype::GetComponent(RowLocation location, uint32_t column) const
+		{
+			return m_chunks[location.chunk].data + m_offsets[column] + static_cast<size_t>(location.row) * m_sizes[column];
+		}
+
+		RowLocation Archetype::AllocateRow(Entity entity, uint32_t version)
+		{
+			if (m_chunks.empty() || m_chunks.back().count == m_capacity)
+			{
+				m_chunks.push_back(Chunk{ m_allocator->Allocate(m_chunkSize), 0 });
+			}
+
+			Chunk& chunk = m_chunks.back();
+			const RowLocation location{ static_cast<uint32_t>(m_chunks.size() - 1), chunk.count++ };
+
+			GetEntities(chunk)[location.row] = entity;
+			std::fill_n(GetVersions(chunk), m_components.size(), version);
+			++m_entityCount;
+			return location;
+		}
+
+		uint32_t Archetype::AllocateRows(const Entity* entities, uint32_t count, uint32_t version, RowLocation& outLocation)
+		{
+			if (m_chunks.empty() || m_chunks.back().count == m_capacity)
+			{
+				m_chunks.push_back(Chunk{ m_allocator->Allocate(m_chunkSize), 0 });
+			}
+
+			Chunk& chunk = m_chunks.back();
+			const uint32_t rows = std::min(count, m_capacity - chunk.count);
+			outLocation = RowLocation{ static_cast<uint32_t>(m_chunks.size() - 1), chunk.count };
+
+			std::copy_n(entities, rows, GetEntities(chunk) + chunk.count);
+			std::fill_n(GetVersions(chunk), m_components.size(), version);
+
+			chunk.count += rows;
+			m_entityCount += rows;
+			return rows;
+		}
+
+		Entity Archetype::RemoveRow(RowLocation location, uint32_t version)
+		{
+			Chunk& last = m_chunks.back();
+			const uint32_t lastRow = last.count - 1;
+			const bool isLast = location.chunk == m_chunks.size() - 1 && location.row == lastRow;
+
+			Entity moved = NULLENTITY;
+			if (!isLast)
+			{
+				Chunk& chunk = m_chunks[location.chunk];
+				moved = GetEntities(last)[lastRow];
+				GetEntities(chunk)[location.row] = moved;
+
+				for (size_t column = 0; column < m_components.size(); ++column)
+				{
+					const size_t size = m_sizes[column];
+					uint8_t* target = static_cast<uint8_t*>(GetColumnData(chunk, static_cast<uint32_t>(column))) + location.row * size;
+					uint8_t* source = static_cast<uint8_t*>(GetColumnData(last, static_cast<uint32_t>(column))) + lastRow * size;
+					ComponentRegistry::GetInfo(m_components[column]).move(target, source, 1);
+				}
+
+				std::fill_n(GetVersions(chunk), m_components.size(), version);
+			}
+
+			--m_entityCount;
+			if (--last.count == 0)
+			{
+				m_allocator->Release(last.data, m_chunkSize);
+				m_chunks.pop_back();
+			}
+
+			return moved;
+		}
+
+		Entity Archetype::DestroyRow(RowLocation location, uint32_t version)
+		{
+			for (size_t column = 0; column < m_components.size(); ++column)
+			{
+				const ComponentInfo& info = ComponentRegistry::GetInfo(m_components[column]);
+				if (!info.trivial) { info.destruct(GetComponent(location, static_cast<uint32_t>(column)), 1); }
+			}
+
+			return RemoveRow(location, version);
+		}
+
+		Archetype* Archetype::GetEdge(ComponentId id, bool add) const
+		{
+			const std::unordered_map<ComponentId, Archetype*>& edges = add ? m_addEdges : m_removeEdges;
+			const auto found = edges.find(id);
+			return found != edges.end() ? found->second : nullptr;
+		}
+
+		void Archetype::SetEdge(ComponentId id, bool add, Archetype* archetype)
+		{
+			(add ? m_addEdges : m_removeEdges)[id] = archetype;
+		}
+	}
+}
@@ -0,0 +1,193 @@
+#ifndef ARCHETYPE_H
+#define ARCHETYPE_H
+#include "Core/EngineDefines.hpp"
+#include "Core/ECS/ComponentRegistry.hpp"
+#include "Core/ECS/Entity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		/// <summary>
+		/// Bytes per chunk , small enough that a chunk's columns stay in L1 / L2 while a system walks them
+		/// </summary>
+		inline static constexpr uint32_t CHUNKSIZE = 16 * 1024;
+
+		inline static constexpr uint32_t CHUNKALIGNMENT = 64;
+
+		inline static constexpr uint32_t INVALIDCOLUMN = UINT32_MAX;
+
+		/// <summary>
+		/// Fixed size block of rows : a version per component , the Entity column , then one column per component (structure of arrays)
+		/// </summary>
+		struct Chunk
+		{
+			uint8_t* data = nullptr;
+			uint32_t count = 0;
+		};
+
+		/// <summary>
+		/// Wrap safe version comparison , true if version was stamped after since
+		/// </summary>
+		inline bool IsNewerVersion(uint32_t version, uint32_t since)
+		{
+			return static_cast<int32_t>(version - since) > 0;
+		}
+
+		struct RowLocation
+		{
+			uint32_t chunk = 0;
+			uint32_t row = 0;
+		};
+
+		/// <summary>
+		/// Recycles CHUNKSIZE blocks between the archetypes of a world , not thread safe.
+		/// Larger blocks (archetypes whose single row doesn't fit CHUNKSIZE) go straight to the heap and back
+		/// </summary>
+		class SNP_API ChunkAllocator
+		{
+		public:
+
+			ChunkAllocator() = default;
+			~ChunkAllocator();
+
+			NONCOPYABLE(ChunkAllocator)
+
+			uint8_t* Allocate(uint32_t size = CHUNKSIZE);
+
+			// size must be the one the block was allocated with
+			void Release(uint8_t* data, uint32_t size = CHUNKSIZE);
+
+			// Blocks handed out and not released
+			size_t GetUsedCount() const { return m_usedCount; }
+
+		private:
+
+			std::vector<uint8_t*> m_freeBlocks;
+			size_t m_usedCount = 0;
+		};
+
+		/// <summary>
+		/// All the entities with one exact set of components , packed into chunks.
+		/// Rows stay dense : every chunk but the last is full and removing a row moves the archetype's last row into the hole.
+		/// Every chunk carries a version per column , stamped with the world version whenever the column's data in that chunk
+		/// may have been written (rows added or moved in , write access handed out) so systems can skip chunks that didn't change
+		/// </summary>
+		class SNP_API Archetype
+		{
+		public:
+
+			Archetype(const ComponentMask& mask, ChunkAllocator& allocator);
+
+			/// <summary>
+			/// Destroys the components of every row and hands the chunks back
+			/// </summary>
+			~Archetype();
+
+			NONCOPYABLE(Archetype)
+
+			const ComponentMask& GetMask() const { return m_mask; }
+			bool Has(ComponentId id) const { return id < MAXCOMPONENTS && m_mask.test(id); }
+
+			/// <summary>
+			/// Component ids in column order (ascending)
+			/// </summary>
+			const std::vector<ComponentId>& GetComponents() const { return m_components; }
+
+			/// <summary>
+			/// Column of the component , INVALIDCOLUMN if the archetype doesn't have it
+			/// </summary>
+			uint32_t GetColumn(ComponentId id) const;
+
+			// Rows per chunk
+			uint32_t GetCapacity() const { return m_capacity; }
+
+			// Bytes per chunk , CHUNKSIZE unless one row alone is bigger
+			uint32_t GetChunkSize() const { return m_chunkSize; }
+
+			size_t GetEntityCount() const { return m_entityCount; }
+			size_t GetChunkCount() const { return m_chunks.size(); }
+			const Chunk& GetChunk(size_t index) const { return m_chunks[index]; }
+
+			Entity* GetEntities(const Chunk& chunk) const { return reinterpret_cast<Entity*>(chunk.data + m_entityOffset); }
+			void* GetColumnData(const Chunk& chunk, uint32_t column) const { return chunk.data + m_offsets[column]; }
+
+			template <typename T>
+			T* GetColumnData(const Chunk& chunk, uint32_t column) const { return reinterpret_cast<T*>(chunk.data + m_offsets[column]); }
+
+			void* GetComponent(RowLocation location, uint32_t column) const;
+
+
+			// ================ VERSIONS ======================
+
+			/// <summary>
+			/// The chunk's column versions , one per component in column order
+			/// </summary>
+			uint32_t* GetVersions(const Chunk& chunk) const { return reinterpret_cast<uint32_t*>(chunk.data); }
+
+			bool HasChanged(const Chunk& chunk, uint32_t column, uint32_t since) const { return IsNewerVersion(GetVersions(chunk)[column], since); }
+
+			/// <summary>
+			/// Stamps the column of the chunk , safe from several threads as long as each works on its own chunks
+			/// </summary>
+			void MarkChanged(const Chunk& chunk, uint32_t column, uint32_t version) const { GetVersions(chunk)[column] = version; }
+
+
+			// ================ ROWS ======================
+
+			/// <summary>
+			/// Appends a row for entity , its component memory is left raw for the caller to construct.
+			/// Every column of the chunk it lands in gets stamped with version
+			/// </summary>
+			RowLocation AllocateRow(Entity entity, uint32_t version);
+
+			/// <summary>
+			/// Bulk AllocateRow : appends rows for as many of entities as fit in the last chunk (a fresh one if it's full) ,
+			/// returns how many that was. outLocation is the first of them , the rest follow it in the same chunk
+			/// </summary>
+			uint32_t AllocateRows(const Entity* entities, uint32_t count, uint32_t version, RowLocation& outLocation);
+
+			/// <summary>
+			/// Drops a row whose components were already destroyed or moved out. The archetype's last row moves into the hole
+			/// (stamping the hole's chunk with version) , its entity is returned so the caller can fix up its location
+			/// (NULLENTITY when nothing moved)
+			/// </summary>
+			Entity RemoveRow(RowLocation location, uint32_t version);
+
+			/// <summary>
+			/// Destroys the row's components , then RemoveRow
+			/// </summary>
+			Entity DestroyRow(RowLocation location, uint32_t version);
+
+
+			// ================ GRAPH ======================
+			// Archetype reached by adding / removing one component , cached by the world
+
+			Archetype* GetEdge(ComponentId id, bool add) const;
+			void SetEdge(ComponentId id, bool add, Archetype* archetype);
+
+		private:
+
+			ComponentMask m_mask;
+			std::vector<ComponentId> m_components;
+			std::vector<uint32_t> m_sizes;
+			std::vector<uint32_t> m_offsets;
+			uint32_t m_entityOffset = 0;
+			uint32_t m_capacity = 0;
+			uint32_t m_chunkSize = CHUNKSIZE;
+
+			std::vector<Chunk> m_chunks;
+			size_t m_entityCount = 0;
+			ChunkAllocator* m_allocator = nullptr;
+
+			std::unordered_map<ComponentId, Archetype*> m_addEdges;
+			std::unordered_map<ComponentId, Archetype*> m_removeEdges;
+		};
+	}
+}
+
+#endif // !ARCHETYPE_H
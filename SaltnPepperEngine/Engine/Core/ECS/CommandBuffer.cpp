@@ -0,0 +1,323 @@
+#include "CommandBuffer.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		namespace
+		{
+			/// <summary>
+			/// Stable LSD radix sort on key , 8 bits a pass. Bytes every key shares get skipped , so sorting a few thousand
+			/// entities of a million entity world takes about three passes
+			/// </summary>
+			template <typename T>
+			void RadixSort(std::vector<T>& items, std::vector<T>& scratch)
+			{
+				uint64_t anySet = 0;
+				uint64_t allSet = ~uint64_t(0);
+				for (const T& item : items)
+				{
+					anySet |= item.key;
+					allSet &= item.key;
+				}
+
+				scratch.resize(items.size());
+				for (uint32_t shift = 0; shift < 64; shift += 8)
+				{
+					if ((((anySet ^ allSet) >> shift) & 0xFF) == 0) { continue; }
+
+					size_t offsets[256] = {};
+					for (const T& item : items) { ++offsets[(item.key >> shift) & 0xFF]; }
+
+					size_t total = 0;
+					for (size_t& offset : offsets)
+					{
+						const size_t count = offset;
+						offset = total;
+						total += count;
+					}
+
+					for (const T& item : items) { scratch[offsets[(item.key >> shift) & 0xFF]++] = item; }
+					items.swap(scratch);
+				}
+			}
+		}
+
+		CommandBuffer::CommandBuffer()
+		{
+			EnsureLanes();
+		}
+
+		CommandBuffer::~CommandBuffer()
+		{
+			ResetLanes(true);
+		}
+
+		uint32_t CommandBuffer::GetLaneIndex() const
+		{
+			const uint32_t laneIndex = Jobs::JobSystem::GetThreadIndex();
+			if (laneIndex >= m_lanes.size())
+			{
+				// A programming error , the buffer was created before JobSystem::OnInit and not played back / cleared since
+				LOG_CRITICAL("CommandBuffer has {0} lanes , recording from thread {1}", m_lanes.size(), laneIndex);
+				SNP_BREAK();
+				return 0;
+			}
+
+			return laneIndex;
+		}
+
+		void CommandBuffer::EnsureLanes()
+		{
+			const uint32_t laneCount = std::max(Jobs::JobSystem::GetThreadCount(), 1u);
+			while (m_lanes.size() < laneCount) { m_lanes.push_back(Memory::MakeUnique<Lane>()); }
+		}
+
+
+		// ================ RECORDING ======================
+
+		Entity CommandBuffer::Spawn()
+		{
+			const uint32_t laneIndex = GetLaneIndex();
+			Lane& lane = *m_lanes[laneIndex];
+
+			const Entity entity{ (laneIndex << LANESHIFT) | lane.spawnCount++, PENDINGFLAG | m_epoch };
+			lane.commands.push_back(Command{ entity, nullptr, INVALIDCOMPONENT, CommandType::SPAWN });
+			return entity;
+		}
+
+		void CommandBuffer::Destroy(Entity entity)
+		{
+			Record(CommandType::DESTROY, entity, INVALIDCOMPONENT, nullptr);
+		}
+
+		void CommandBuffer::Record(CommandType type, Entity entity, ComponentId component, void* value)
+		{
+			GetLane().commands.push_back(Command{ entity, value, component, type });
+		}
+
+
+		// ================ PLAYBACK ======================
+
+		void CommandBuffer::Playback(World& world)
+		{
+			// Every lane into one list sorted by entity , the sort is stable so each entity's commands stay in recording order
+			m_sorted.clear();
+			for (const Memory::UniquePtr<Lane>& lane : m_lanes)
+			{
+				for (const Command& command : lane->commands)
+				{
+					const uint64_t key = (static_cast<uint64_t>(command.entity.index) << 32) | command.entity.generation;
+					m_sorted.push_back(SortedCommand{ key, &command });
+				}
+
+				lane->resolved.assign(lane->spawnCount, NULLENTITY);
+			}
+
+			RadixSort(m_sorted, m_sortScratch);
+
+			m_changes.clear();
+			m_writes.clear();
+			m_spawns.clear();
+
+			for (size_t begin = 0; begin < m_sorted.size();)
+			{
+				size_t end = begin + 1;
+				while (end < m_sorted.size() && m_sorted[end].key == m_sorted[begin].key) { ++end; }
+
+				EntityChange change;
+				if (Fold(m_sorted.data() + begin, end - begin, change))
+				{
+					const Entity entity = m_sorted[begin].command->entity;
+					if (IsPending(entity)) { m_spawns.emplace_back(static_cast<uint32_t>(m_changes.size()), entity); }
+
+					m_changes.push_back(change);
+				}
+
+				begin = end;
+			}
+
+			world.ApplyChanges(m_changes.data(), m_changes.size(), m_writes.data());
+
+			for (const std::pair<uint32_t, Entity>& spawn : m_spawns)
+			{
+				m_lanes[spawn.second.index >> LANESHIFT]->resolved[spawn.second.index & SPAWNMASK] = m_changes[spawn.first].entity;
+			}
+
+			// The world consumed every value that made it into a change , Fold discarded the rest
+			ResetLanes(false);
+
+			m_resolvedEpoch = m_epoch;
+			m_epoch = (m_epoch + 1) & EPOCHMASK;
+			EnsureLanes();
+		}
+
+		bool CommandBuffer::Fold(const SortedCommand* commands, size_t count, EntityChange& outChange)
+		{
+			const Entity entity = commands[0].command->entity;
+			const bool pending = IsPending(entity);
+
+			// Real entities count as alive here , ApplyChanges drops what turns out to be dead.
+			// Except NULLENTITY , which would read as a spawn there
+			bool alive = entity != NULLENTITY;
+			if (pending)
+			{
+				const uint32_t laneIndex = entity.index >> LANESHIFT;
+				alive = laneIndex < m_lanes.size() && (entity.index & SPAWNMASK) < m_lanes[laneIndex]->spawnCount;
+
+				if ((entity.generation & EPOCHMASK) != m_epoch)
+				{
+					LOG_WARN("CommandBuffer : dropped {0} commands on a stand in id from an earlier playback", count);
+					alive = false;
+				}
+			}
+
+			ComponentMask added;
+			ComponentMask removed;
+
+			const uint32_t firstWrite = static_cast<uint32_t>(m_writes.size());
+			bool destroy = false;
+			bool changed = false;
+
+			for (size_t index = 0; index < count; ++index)
+			{
+				const Command& command = *commands[index].command;
+				if (!alive || destroy)
+				{
+					DiscardValue(command.component, command.value);
+					continue;
+				}
+
+				switch (command.type)
+				{
+				case CommandType::SPAWN:
+					break;
+
+				case CommandType::DESTROY:
+					destroy = true;
+					for (uint32_t write = firstWrite; write < m_writes.size(); ++write) { DiscardValue(m_writes[write].id, m_writes[write].value); }
+					m_writes.resize(firstWrite);
+					break;
+
+				case CommandType::ADD:
+					added.set(command.component);
+					removed.reset(command.component);
+					SetWrite(firstWrite, command.component, command.value);
+					changed = true;
+					break;
+
+				case CommandType::REMOVE:
+					removed.set(command.component);
+					added.reset(command.component);
+					EraseWrite(firstWrite, command.component);
+					changed = true;
+					break;
+
+				case CommandType::SET:
+					// Known to be missing by then. On components the batch doesn't touch ApplyChanges drops it if the entity lacks one
+					if (removed.test(command.component) || (pending && !added.test(command.component)))
+					{
+						DiscardValue(command.component, command.value);
+						break;
+					}
+
+					SetWrite(firstWrite, command.component, command.value);
+					changed = true;
+					break;
+				}
+			}
+
+			// Spawned and destroyed in the same batch , or nothing happened to it
+			if (!alive || (pending && destroy) || (!pending && !destroy && !changed)) { return false; }
+
+			outChange.entity = pending ? NULLENTITY : entity;
+			outChange.add = added;
+			outChange.remove = removed;
+			outChange.firstWrite = firstWrite;
+			outChange.writeCount = static_cast<uint32_t>(m_writes.size()) - firstWrite;
+			outChange.destroy = destroy;
+			return true;
+		}
+
+		void CommandBuffer::SetWrite(uint32_t firstWrite, ComponentId id, void* value)
+		{
+			for (uint32_t write = firstWrite; write < m_writes.size(); ++write)
+			{
+				if (m_writes[write].id != id) { continue; }
+
+				// The later value wins
+				DiscardValue(id, m_writes[write].value);
+				m_writes[write].value = value;
+				return;
+			}
+
+			m_writes.push_back(ComponentWrite{ id, value });
+		}
+
+		void CommandBuffer::EraseWrite(uint32_t firstWrite, ComponentId id)
+		{
+			for (uint32_t write = firstWrite; write < m_writes.size(); ++write)
+			{
+				if (m_writes[write].id != id) { continue; }
+
+				DiscardValue(id, m_writes[write].value);
+				m_writes[write] = m_writes.back();
+				m_writes.pop_back();
+				return;
+			}
+		}
+
+		void CommandBuffer::DiscardValue(ComponentId id, void* value)
+		{
+			if (value == nullptr) { return; }
+
+			const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+			if (!info.trivial) { info.destruct(value, 1); }
+		}
+
+		void CommandBuffer::Clear()
+		{
+			ResetLanes(true);
+
+			// The ids handed out since the last Playback never resolve
+			m_epoch = (m_epoch + 1) & EPOCHMASK;
+			EnsureLanes();
+		}
+
+		void CommandBuffer::ResetLanes(bool discardValues)
+		{
+			for (const Memory::UniquePtr<Lane>& lane : m_lanes)
+			{
+				if (discardValues)
+				{
+					for (const Command& command : lane->commands) { DiscardValue(command.component, command.value); }
+				}
+
+				lane->commands.clear();
+				lane->arena.Reset();
+				lane->spawnCount = 0;
+			}
+		}
+
+		Entity CommandBuffer::Resolve(Entity entity) const
+		{
+			if (!IsPending(entity)) { return entity; }
+			if ((entity.generation & EPOCHMASK) != m_resolvedEpoch) { return NULLENTITY; }
+
+			const uint32_t laneIndex = entity.index >> LANESHIFT;
+			const uint32_t spawnIndex = entity.index & SPAWNMASK;
+
+			return laneIndex < m_lanes.size() && spawnIndex < m_lanes[laneIndex]->resolved.size() ? m_lanes[laneIndex]->resolved[spawnIndex] : NULLENTITY;
+		}
+
+		size_t CommandBuffer::GetCommandCount() const
+		{
+			size_t count = 0;
+			for (const Memory::UniquePtr<Lane>& lane : m_lanes) { count += lane->commands.size(); }
+			return count;
+		}
+	}
+}
@@ -0,0 +1,227 @@
+#ifndef COMMANDBUFFER_H
+#define COMMANDBUFFER_H
+#include "Core/EngineDefines.hpp"
+#include "Core/ECS/ComponentRegistry.hpp"
+#include "Core/ECS/Entity.hpp"
+#include "Core/ECS/World.hpp"
+#include "Core/Memory/LinearArena.hpp"
+#include "Core/Memory/MemoryDefinitions.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		/// <summary>
+		/// Records structural changes (spawn , destroy , add , remove , set) from inside parallel systems and plays them back
+		/// into a World at a sync point. Every job thread records into its own lane (command list + arena for the component values)
+		/// so recording takes no locks. Playback radix sorts the commands of all lanes by entity , folds each entity's commands
+		/// into the components it gains and loses and hands the lot to World::ApplyChanges , which moves every entity once , in bulk.
+		/// Lanes are sized to JobSystem::GetThreadCount when the buffer is created and at every Playback / Clear , so a buffer created
+		/// before JobSystem::OnInit must be played back or cleared once before jobs record into it (recording from a thread without
+		/// a lane breaks into the debugger). Outside the pool only one thread may record (they all share lane 0)
+		/// </summary>
+		class SNP_API CommandBuffer
+		{
+		public:
+
+			// Stand in ids Spawn hands out have this bit set in their generation , the rest of it is the buffer's playback epoch
+			// so an id kept past its Playback can't alias a spawn of a later batch. Real generations only reach it after
+			// 2^31 destroys of one index
+			inline static constexpr uint32_t PENDINGFLAG = 1u << 31;
+			inline static constexpr uint32_t EPOCHMASK = PENDINGFLAG - 1;
+
+			CommandBuffer();
+
+			/// <summary>
+			/// Destroys the component values of commands that were never played back
+			/// </summary>
+			~CommandBuffer();
+
+			NONCOPYABLE(CommandBuffer)
+
+
+			// ================ RECORDING ======================
+			// Commands on an entity apply in the order they were recorded (lanes in thread order when several threads touch one entity)
+
+			/// <summary>
+			/// Stand in id for an entity created on playback , usable in further commands on this buffer until the next Playback / Clear
+			/// and with Resolve until the one after. Commands on an id from an earlier batch are dropped
+			/// </summary>
+			Entity Spawn();
+
+			template <typename... Components>
+			Entity Spawn(Components&&... components);
+
+			void Destroy(Entity entity);
+
+			/// <summary>
+			/// Adds the component , or overwrites it if the entity has one by then
+			/// </summary>
+			template <typename T>
+			void Add(Entity entity, T component = T{});
+
+			template <typename T>
+			void Remove(Entity entity) { Record(CommandType::REMOVE, entity, ComponentRegistry::GetId<T>(), nullptr); }
+
+			/// <summary>
+			/// Overwrites the component , dropped if the entity doesn't have it by then
+			/// </summary>
+			template <typename T>
+			void Set(Entity entity, T component);
+
+
+			// ================ PLAYBACK ======================
+
+			/// <summary>
+			/// Applies every recorded command to world and empties the buffer. Commands on dead entities are dropped.
+			/// Main thread , no jobs may be recording
+			/// </summary>
+			void Playback(World& world);
+
+			/// <summary>
+			/// Drops every recorded command
+			/// </summary>
+			void Clear();
+
+			/// <summary>
+			/// The entity a Spawn id turned into at the last Playback , NULLENTITY if it got destroyed in the same batch
+			/// or was recorded before an earlier Playback / Clear. Anything that isn't a stand in id comes back unchanged
+			/// </summary>
+			Entity Resolve(Entity entity) const;
+
+			static bool IsPending(Entity entity) { return (entity.generation & PENDINGFLAG) != 0; }
+
+			size_t GetCommandCount() const;
+
+		private:
+
+			enum class CommandType : uint8_t
+			{
+				SPAWN,
+				DESTROY,
+				ADD,
+				REMOVE,
+				SET
+			};
+
+			struct Command
+			{
+				Entity entity;
+
+				// Arena owned component value (ADD , SET)
+				void* value = nullptr;
+
+				ComponentId component = INVALIDCOMPONENT;
+				CommandType type = CommandType::SPAWN;
+			};
+
+			// Own cache lines per lane , the threads recording side by side never share one
+			struct alignas(64) Lane
+			{
+				Memory::LinearArena arena;
+				std::vector<Command> commands;
+				uint32_t spawnCount = 0;
+
+				// Spawn ids of the last playback
+				std::vector<Entity> resolved;
+			};
+
+			struct SortedCommand
+			{
+				uint64_t key = 0;
+				const Command* command = nullptr;
+			};
+
+			// Stand in ids carry their lane in the top bits of the index
+			inline static constexpr uint32_t LANESHIFT = 24;
+			inline static constexpr uint32_t SPAWNMASK = (1u << LANESHIFT) - 1;
+
+			uint32_t GetLaneIndex() const;
+			Lane& GetLane() { return *m_lanes[GetLaneIndex()]; }
+
+			/// <summary>
+			/// Grows the lanes to the job system's thread count , main thread only
+			/// </summary>
+			void EnsureLanes();
+
+			void Record(CommandType type, Entity entity, ComponentId component, void* value);
+
+			template <typename T>
+			void RecordValue(CommandType type, Entity entity, T&& component);
+
+			/// <summary>
+			/// Folds the commands on one entity into a change , returns false when there's nothing to apply.
+			/// Works without the world : whether a real entity is alive and what it has gets sorted out by World::ApplyChanges
+			/// </summary>
+			bool Fold(const SortedCommand* commands, size_t count, EntityChange& outChange);
+
+			void SetWrite(uint32_t firstWrite, ComponentId id, void* value);
+			void EraseWrite(uint32_t firstWrite, ComponentId id);
+
+			/// <summary>
+			/// Destroys a value that won't get applied
+			/// </summary>
+			static void DiscardValue(ComponentId id, void* value);
+
+			/// <summary>
+			/// Discards every value still in the lanes and rewinds them
+			/// </summary>
+			void ResetLanes(bool discardValues);
+
+			std::vector<Memory::UniquePtr<Lane>> m_lanes;
+
+			// Epoch of the ids Spawn hands out now , and of the ones Resolve knows about
+			uint32_t m_epoch = 0;
+			uint32_t m_resolvedEpoch = EPOCHMASK;
+
+			// ======== PLAYBACK SCRATCH ========
+			std::vector<SortedCommand> m_sorted;
+			std::vector<SortedCommand> m_sortScratch;
+			std::vector<EntityChange> m_changes;
+			std::vector<ComponentWrite> m_writes;
+			std::vector<std::pair<uint32_t, Entity>> m_spawns;
+		};
+
+
+		// ================ TEMPLATE IMPLEMENTATIONS ======================
+
+		template <typename... Components>
+		Entity CommandBuffer::Spawn(Components&&... components)
+		{
+			const Entity entity = Spawn();
+			(RecordValue(CommandType::ADD, entity, std::forward<Components>(components)), ...);
+			return entity;
+		}
+
+		template <typename T>
+		void CommandBuffer::Add(Entity entity, T component)
+		{
+			RecordValue(CommandType::ADD, entity, std::move(component));
+		}
+
+		template <typename T>
+		void CommandBuffer::Set(Entity entity, T component)
+		{
+			RecordValue(CommandType::SET, entity, std::move(component));
+		}
+
+		template <typename T>
+		void CommandBuffer::RecordValue(CommandType type, Entity entity, T&& component)
+		{
+			using Type = std::remove_cv_t<std::remove_reference_t<T>>;
+
+			void* value = GetLane().arena.Allocate(sizeof(Type), alignof(Type));
+			new (value) Type(std::forward<T>(component));
+
+			Record(type, entity, ComponentRegistry::GetId<Type>(), value);
+		}
+	}
+}
+
+#endif // !COMMANDBUFFER_H
@@ -0,0 +1,56 @@
+#include "ComponentRegistry.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		namespace
+		{
+			struct RegistryState
+			{
+				// Fixed array so readers never see it move while another thread registers
+				ComponentInfo infos[MAXCOMPONENTS];
+				std::atomic<uint32_t> count{ 0 };
+				std::mutex mutex;
+			};
+
+			RegistryState& GetState()
+			{
+				static RegistryState state;
+				return state;
+			}
+		}
+
+		ComponentId ComponentRegistry::Register(const ComponentInfo& info)
+		{
+			RegistryState& state = GetState();
+			std::lock_guard<std::mutex> lock(state.mutex);
+
+			const uint32_t id = state.count.load(std::memory_order_relaxed);
+			if (id >= MAXCOMPONENTS)
+			{
+				// A programming error , raise MAXCOMPONENTS
+				LOG_CRITICAL("Out of component ids ({0}) registering {1}", MAXCOMPONENTS, info.name);
+				SNP_BREAK();
+				return INVALIDCOMPONENT;
+			}
+
+			state.infos[id] = info;
+			state.count.store(id + 1, std::memory_order_release);
+			return static_cast<ComponentId>(id);
+		}
+
+		const ComponentInfo& ComponentRegistry::GetInfo(ComponentId id)
+		{
+			return GetState().infos[id < MAXCOMPONENTS ? id : 0];
+		}
+
+		uint32_t ComponentRegistry::GetCount()
+		{
+			return GetState().count.load(std::memory_order_acquire);
+		}
+	}
+}
@@ -0,0 +1,167 @@
+#ifndef COMPONENTREGISTRY_H
+#define COMPONENTREGISTRY_H
+#include "Core/EngineDefines.hpp"
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		using ComponentId = uint16_t;
+
+		/// <summary>
+		/// Component types a program can register , also the width of the archetype masks
+		/// </summary>
+		inline static constexpr uint32_t MAXCOMPONENTS = 128;
+
+		inline static constexpr ComponentId INVALIDCOMPONENT = UINT16_MAX;
+
+		using ComponentMask = std::bitset<MAXCOMPONENTS>;
+
+		/// <summary>
+		/// Everything the type erased chunk storage needs to know about a component type.
+		/// All the functions work on count back to back elements
+		/// </summary>
+		struct ComponentInfo
+		{
+			const char* name = nullptr;
+			uint32_t size = 0;
+			uint32_t alignment = 0;
+
+			// Trivially copyable and destructible : the functions below reduce to memcpy / nothing
+			bool trivial = false;
+
+			// Value initializes raw memory
+			void (*construct)(void* destination, size_t count) = nullptr;
+			void (*destruct)(void* data, size_t count) = nullptr;
+
+			// Move constructs into raw memory and destroys the source (relocation)
+			void (*move)(void* destination, void* source, size_t count) = nullptr;
+
+			// Copy constructs into raw memory
+			void (*copy)(void* destination, const void* source, size_t count) = nullptr;
+		};
+
+		/// <summary>
+		/// Hands out a dense id per component type on first use. Ids are process wide and stable for the run ,
+		/// registering is thread safe
+		/// </summary>
+		class SNP_API ComponentRegistry
+		{
+		public:
+
+			template <typename T>
+			static ComponentId GetId()
+			{
+				using Type = std::remove_cv_t<std::remove_reference_t<T>>;
+
+				// const Transform , Transform& ... all share Transform's id
+				if constexpr (!std::is_same_v<T, Type>)
+				{
+					return GetId<Type>();
+				}
+				else
+				{
+					static const ComponentId id = Register(MakeInfo<Type>());
+					return id;
+				}
+			}
+
+			static const ComponentInfo& GetInfo(ComponentId id);
+
+			static uint32_t GetCount();
+
+			template <typename T>
+			static ComponentInfo MakeInfo()
+			{
+				static_assert(std::is_move_constructible_v<T>, "Components have to be move constructible");
+				static_assert(alignof(T) <= 64, "Components can't be aligned to more than a cache line");
+				static_assert(sizeof(T) <= 4096, "Components have to fit in a chunk with room to spare , keep big data behind a handle");
+
+				ComponentInfo info;
+				info.name = typeid(T).name();
+				info.size = static_cast<uint32_t>(sizeof(T));
+				info.alignment = static_cast<uint32_t>(alignof(T));
+				info.trivial = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+				info.construct = [](void* destination, size_t count)
+				{
+					T* elements = static_cast<T*>(destination);
+					for (size_t index = 0; index < count; ++index) { new (elements + index) T(); }
+				};
+
+				info.destruct = [](void* data, size_t count)
+				{
+					if constexpr (!std::is_trivially_destructible_v<T>)
+					{
+						T* elements = static_cast<T*>(data);
+						for (size_t index = 0; index < count; ++index) { elements[index].~T(); }
+					}
+				};
+
+				info.move = [](void* destination, void* source, size_t count)
+				{
+					if constexpr (std::is_trivially_copyable_v<T>)
+					{
+						std::memcpy(destination, source, count * sizeof(T));
+					}
+					else
+					{
+						T* target = static_cast<T*>(destination);
+						T* elements = static_cast<T*>(source);
+						for (size_t index = 0; index < count; ++index)
+						{
+							new (target + index) T(std::move(elements[index]));
+							elements[index].~T();
+						}
+					}
+				};
+
+				info.copy = [](void* destination, const void* source, size_t count)
+				{
+					if constexpr (std::is_trivially_copyable_v<T>)
+					{
+						std::memcpy(destination, source, count * sizeof(T));
+					}
+					else if constexpr (std::is_copy_constructible_v<T>)
+					{
+						T* target = static_cast<T*>(destination);
+						const T* elements = static_cast<const T*>(source);
+						for (size_t index = 0; index < count; ++index) { new (target + index) T(elements[index]); }
+					}
+					else
+					{
+						// Move only components can't be duplicated , the copies come out value initialized
+						T* target = static_cast<T*>(destination);
+						for (size_t index = 0; index < count; ++index) { new (target + index) T(); }
+					}
+				};
+
+				return info;
+			}
+
+		private:
+
+			static ComponentId Register(const ComponentInfo& info);
+		};
+
+		/// <summary>
+		/// Mask with the bits of the given component types set
+		/// </summary>
+		template <typename... Components>
+		inline ComponentMask MakeMask()
+		{
+			ComponentMask mask;
+			(mask.set(ComponentRegistry::GetId<Components>()), ...);
+			return mask;
+		}
+	}
+}
+
+#endif // !COMPONENTREGISTRY_H
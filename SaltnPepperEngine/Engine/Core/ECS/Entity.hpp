@@ -0,0 +1,26 @@
+#ifndef ENTITY_H
+#define ENTITY_H
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		/// <summary>
+		/// Generational entity id. The generation changes when the entity is destroyed ,
+		/// so a stale id never resolves to whatever reused the index
+		/// </summary>
+		struct Entity
+		{
+			uint32_t index = UINT32_MAX;
+			uint32_t generation = 0;
+
+			constexpr bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+			constexpr bool operator!=(const Entity& other) const { return !(*this == other); }
+		};
+
+		inline static constexpr Entity NULLENTITY = Entity{};
+	}
+}
+
+#endif // !ENTITY_H
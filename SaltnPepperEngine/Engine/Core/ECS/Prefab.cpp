@@ -0,0 +1,45 @@
+#include "Prefab.hpp"
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		Prefab::~Prefab()
+		{
+			for (const Entry& entry : m_entries)
+			{
+				const ComponentInfo& info = ComponentRegistry::GetInfo(entry.id);
+				if (!info.trivial) { info.destruct(entry.value, 1); }
+			}
+		}
+
+		const void* Prefab::GetValue(ComponentId id) const
+		{
+			for (const Entry& entry : m_entries)
+			{
+				if (entry.id == id) { return entry.value; }
+			}
+
+			return nullptr;
+		}
+
+		void* Prefab::Allocate(ComponentId id, bool shared)
+		{
+			m_instanceMask.set(id, !shared);
+			m_sharedMask.set(id, shared);
+
+			const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+			for (const Entry& entry : m_entries)
+			{
+				if (entry.id != id) { continue; }
+
+				if (!info.trivial) { info.destruct(entry.value, 1); }
+				return entry.value;
+			}
+
+			void* value = m_arena.Allocate(info.size, info.alignment);
+			m_entries.push_back(Entry{ id, value });
+			return value;
+		}
+	}
+}
@@ -0,0 +1,147 @@
+#ifndef PREFAB_H
+#define PREFAB_H
+#include "Core/EngineDefines.hpp"
+#include "Core/ECS/ComponentRegistry.hpp"
+#include "Core/ECS/Entity.hpp"
+#include "Core/ECS/World.hpp"
+#include "Core/Memory/LinearArena.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		/// <summary>
+		/// Template entity for World::Instantiate. Every component value is stored once , in the prefab. Instance components
+		/// (the per entity state : transform , velocity , health) get copied into each instance's row. Shared components
+		/// (meshes , materials , tuning data) stay in the prefab , instances reach them through their PrefabLink and only get a
+		/// copy of their own once they override one (copy on write , see OverridePrefabComponent).
+		/// Instances keep a pointer to the prefab , so it has to outlive them. Editing a shared value later shows up in every
+		/// instance that hasn't overridden it
+		/// </summary>
+		class SNP_API Prefab
+		{
+		public:
+
+			Prefab() = default;
+
+			/// <summary>
+			/// Destroys the stored values
+			/// </summary>
+			~Prefab();
+
+			NONCOPYABLE(Prefab)
+
+			/// <summary>
+			/// Sets a component every instance gets its own copy of
+			/// </summary>
+			template <typename T>
+			void Add(T value) { Store<T>(std::move(value), false); }
+
+			/// <summary>
+			/// Sets a component instances share until they override it
+			/// </summary>
+			template <typename T>
+			void Share(T value) { Store<T>(std::move(value), true); }
+
+			/// <summary>
+			/// The stored value of either kind , nullptr if the prefab doesn't have the component
+			/// </summary>
+			template <typename T>
+			const T* Get() const { return static_cast<const T*>(GetValue(ComponentRegistry::GetId<T>())); }
+
+			const void* GetValue(ComponentId id) const;
+
+			bool IsShared(ComponentId id) const { return id < MAXCOMPONENTS && m_sharedMask.test(id); }
+
+			/// <summary>
+			/// The components instances are created with (PrefabLink and Transform not included)
+			/// </summary>
+			const ComponentMask& GetInstanceMask() const { return m_instanceMask; }
+			const ComponentMask& GetSharedMask() const { return m_sharedMask; }
+
+		private:
+
+			struct Entry
+			{
+				ComponentId id = INVALIDCOMPONENT;
+				void* value = nullptr;
+			};
+
+			template <typename T>
+			void Store(T&& value, bool shared);
+
+			/// <summary>
+			/// Raw memory for the component's value , the old value (if any) destroyed and its memory reused
+			/// </summary>
+			void* Allocate(ComponentId id, bool shared);
+
+			std::vector<Entry> m_entries;
+			ComponentMask m_instanceMask;
+			ComponentMask m_sharedMask;
+
+			// Values never move , instances and callers can hold on to their addresses
+			Memory::LinearArena m_arena{ 1024 };
+		};
+
+		/// <summary>
+		/// Component of every prefab instance , the prefab it reads its shared components from
+		/// </summary>
+		struct PrefabLink
+		{
+			const Prefab* prefab = nullptr;
+		};
+
+
+		// ================ INSTANCE ACCESS ======================
+
+		/// <summary>
+		/// The entity's own component if it has one (an instance component or an override) , the prefab's shared value otherwise.
+		/// nullptr when neither exists
+		/// </summary>
+		template <typename T>
+		const T* GetPrefabComponent(const World& world, Entity entity)
+		{
+			if (const T* own = world.Get<T>(entity)) { return own; }
+
+			const PrefabLink* link = world.Get<PrefabLink>(entity);
+			return link != nullptr && link->prefab != nullptr ? link->prefab->Get<T>() : nullptr;
+		}
+
+		/// <summary>
+		/// Write access to a shared component : the first call copies the prefab's value into a component of the entity's own
+		/// (moving it to the archetype with it) , after that it's a plain Get. Removing the component reverts to the shared value.
+		/// nullptr if the entity has no such component and its prefab doesn't share one
+		/// </summary>
+		template <typename T>
+		T* OverridePrefabComponent(World& world, Entity entity)
+		{
+			if (T* own = world.Get<T>(entity)) { return own; }
+
+			const PrefabLink* link = world.Get<PrefabLink>(entity);
+			const T* shared = link != nullptr && link->prefab != nullptr ? link->prefab->Get<T>() : nullptr;
+			if (shared == nullptr) { return nullptr; }
+
+			return world.Add<T>(entity, *shared);
+		}
+
+
+		// ================ TEMPLATE IMPLEMENTATIONS ======================
+
+		template <typename T>
+		void Prefab::Store(T&& value, bool shared)
+		{
+			using Type = std::remove_cv_t<std::remove_reference_t<T>>;
+			static_assert(std::is_copy_constructible_v<Type>, "Prefab components get copied into their instances");
+
+			new (Allocate(ComponentRegistry::GetId<Type>(), shared)) Type(std::forward<T>(value));
+		}
+	}
+}
+
+#endif // !PREFAB_H
@@ -0,0 +1,219 @@
+#ifndef QUERY_H
+#define QUERY_H
+#include "Core/EngineDefines.hpp"
+#include "Core/ECS/Archetype.hpp"
+#include "Core/ECS/ComponentRegistry.hpp"
+#include "Core/ECS/World.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		/// <summary>
+		/// Chunks per ParallelForEach slice
+		/// </summary>
+		inline static constexpr size_t QUERYGRAIN = 4;
+
+		/// <summary>
+		/// Cached iteration over every entity that has all of Components , one Query per system.
+		/// Declare read only components const (Query<const Transform , Velocity>) : the chunk columns of non const ones get stamped
+		/// as changed on every run. Changed<Filters...>() limits a run to the chunks where at least one filter component was
+		/// written since this query's previous run , so a system only pays for the part of the world that moved.
+		/// A query must not run on two threads at once , and the world must not change structurally while it runs
+		/// </summary>
+		template <typename... Components>
+		class Query
+		{
+			static_assert(sizeof...(Components) > 0, "Queries need at least one component");
+
+		public:
+
+			explicit Query(World& world)
+				: m_world(&world)
+				, m_ids{ ComponentRegistry::GetId<Components>()... }
+				, m_mask(MakeMask<Components...>())
+			{
+			}
+
+			/// <summary>
+			/// Only visit chunks where one of Filters changed since the previous run (Filters don't have to be in Components ,
+			/// entities without them are left out of the query)
+			/// </summary>
+			template <typename... Filters>
+			Query& Changed()
+			{
+				m_filterIds = { ComponentRegistry::GetId<Filters>()... };
+				m_mask = MakeMask<Components..., Filters...>();
+
+				m_matches.clear();
+				m_scannedCount = 0;
+				return *this;
+			}
+
+			/// <summary>
+			/// Calls function(Components&... components) , or function(Entity entity , Components&... components) ,
+			/// for every matching entity on the calling thread
+			/// </summary>
+			template <typename Function>
+			void ForEach(Function&& function) { Run(function, false, QUERYGRAIN); }
+
+			/// <summary>
+			/// ForEach with the chunks spread over the job workers , function gets called concurrently (for different entities)
+			/// </summary>
+			template <typename Function>
+			void ParallelForEach(Function&& function, size_t grainSize = QUERYGRAIN) { Run(function, true, grainSize); }
+
+			/// <summary>
+			/// Forgets the previous run , the next one visits every chunk
+			/// </summary>
+			void Reset() { m_lastVersion = 0; }
+
+			// Version the previous run stamped its writes with
+			uint32_t GetLastVersion() const { return m_lastVersion; }
+
+			// Chunks the previous run walked / left out because none of the filter components changed
+			size_t GetVisitedChunkCount() const { return m_work.size(); }
+			size_t GetSkippedChunkCount() const { return m_skippedCount; }
+
+		private:
+
+			using ComponentColumns = std::array<uint32_t, sizeof...(Components)>;
+
+			struct Match
+			{
+				const Archetype* archetype = nullptr;
+				ComponentColumns columns;
+				std::vector<uint32_t> filterColumns;
+			};
+
+			struct ChunkWork
+			{
+				uint32_t match = 0;
+				uint32_t chunk = 0;
+			};
+
+			/// <summary>
+			/// Picks up the archetypes created since the last run (all of them again after World::Clear)
+			/// </summary>
+			void Refresh()
+			{
+				if (m_archetypeGeneration != m_world->GetArchetypeGeneration())
+				{
+					m_archetypeGeneration = m_world->GetArchetypeGeneration();
+					m_matches.clear();
+					m_scannedCount = 0;
+				}
+
+				const std::vector<Memory::UniquePtr<Archetype>>& archetypes = m_world->GetArchetypes();
+				for (; m_scannedCount < archetypes.size(); ++m_scannedCount)
+				{
+					const Archetype& archetype = *archetypes[m_scannedCount];
+					if ((archetype.GetMask() & m_mask) != m_mask) { continue; }
+
+					Match match;
+					match.archetype = &archetype;
+					for (size_t index = 0; index < m_ids.size(); ++index) { match.columns[index] = archetype.GetColumn(m_ids[index]); }
+					for (ComponentId id : m_filterIds) { match.filterColumns.push_back(archetype.GetColumn(id)); }
+
+					m_matches.push_back(std::move(match));
+				}
+			}
+
+			template <typename Function>
+			void Run(Function& function, bool parallel, size_t grainSize)
+			{
+				Refresh();
+
+				const uint32_t version = m_world->AdvanceVersion();
+
+				// Filter on the chunk headers first , the jobs then only get chunks with work in them
+				m_work.clear();
+				m_skippedCount = 0;
+				for (uint32_t matchIndex = 0; matchIndex < m_matches.size(); ++matchIndex)
+				{
+					const Match& match = m_matches[matchIndex];
+					for (uint32_t chunkIndex = 0; chunkIndex < match.archetype->GetChunkCount(); ++chunkIndex)
+					{
+						if (!IsChunkChanged(match, match.archetype->GetChunk(chunkIndex)))
+						{
+							++m_skippedCount;
+							continue;
+						}
+
+						m_work.push_back(ChunkWork{ matchIndex, chunkIndex });
+					}
+				}
+
+				auto runRange = [this, &function, version](size_t begin, size_t end)
+				{
+					for (size_t index = begin; index < end; ++index)
+					{
+						const Match& match = m_matches[m_work[index].match];
+						RunChunk(function, match, match.archetype->GetChunk(m_work[index].chunk), version, std::index_sequence_for<Components...>{});
+					}
+				};
+
+				if (parallel) { Jobs::JobSystem::ParallelFor(m_work.size(), grainSize, runRange); }
+				else { runRange(0, m_work.size()); }
+
+				m_lastVersion = version;
+			}
+
+			bool IsChunkChanged(const Match& match, const Chunk& chunk) const
+			{
+				if (match.filterColumns.empty()) { return true; }
+
+				for (uint32_t column : match.filterColumns)
+				{
+					if (match.archetype->HasChanged(chunk, column, m_lastVersion)) { return true; }
+				}
+
+				return false;
+			}
+
+			template <typename Function, size_t... Indices>
+			void RunChunk(Function& function, const Match& match, const Chunk& chunk, uint32_t version, std::index_sequence<Indices...>) const
+			{
+				const Archetype& archetype = *match.archetype;
+				((std::is_const_v<Components> ? void() : archetype.MarkChanged(chunk, match.columns[Indices], version)), ...);
+
+				const std::tuple<Components*...> data(archetype.template GetColumnData<std::remove_const_t<Components>>(chunk, match.columns[Indices])...);
+
+				if constexpr (std::is_invocable_v<Function&, Entity, Components&...>)
+				{
+					const Entity* entities = archetype.GetEntities(chunk);
+					for (uint32_t row = 0; row < chunk.count; ++row) { function(entities[row], std::get<Indices>(data)[row]...); }
+				}
+				else
+				{
+					for (uint32_t row = 0; row < chunk.count; ++row) { function(std::get<Indices>(data)[row]...); }
+				}
+			}
+
+			World* m_world = nullptr;
+			std::array<ComponentId, sizeof...(Components)> m_ids;
+			std::vector<ComponentId> m_filterIds;
+			ComponentMask m_mask;
+
+			// ======== CACHED MATCHES ========
+			std::vector<Match> m_matches;
+			size_t m_scannedCount = 0;
+			uint32_t m_archetypeGeneration = 0;
+
+			// ======== RUN STATE ========
+			std::vector<ChunkWork> m_work;
+			size_t m_skippedCount = 0;
+			uint32_t m_lastVersion = 0;
+		};
+	}
+}
+
+#endif // !QUERY_H
@@ -0,0 +1,578 @@
+#include "World.hpp"
+#include "Core/Components/Transform.hpp"
+#include "Core/ECS/Prefab.hpp"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <xmmintrin.h>
+
+namespace SaltnPepperEngine
+{
+	namespace ECS
+	{
+		namespace
+		{
+			// Entities ahead of the current one whose memory the batched loops prefetch
+			inline static constexpr uint32_t PREFETCHDISTANCE = 8;
+
+			inline void Prefetch(const void* address)
+			{
+				_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+			}
+
+			// Every cache line of [address , address + size)
+			inline void PrefetchRange(const void* address, size_t size)
+			{
+				const uintptr_t end = reinterpret_cast<uintptr_t>(address) + size;
+				for (uintptr_t line = reinterpret_cast<uintptr_t>(address) & ~uintptr_t(63); line < end; line += 64)
+				{
+					_mm_prefetch(reinterpret_cast<const char*>(line), _MM_HINT_T0);
+				}
+			}
+
+			struct ArchetypePairHash
+			{
+				size_t operator()(const std::pair<Archetype*, Archetype*>& pair) const
+				{
+					return std::hash<Archetype*>()(pair.first) * 31 + std::hash<Archetype*>()(pair.second);
+				}
+			};
+
+			void DestroyValue(ComponentWrite& write)
+			{
+				const ComponentInfo& info = ComponentRegistry::GetInfo(write.id);
+				if (!info.trivial) { info.destruct(write.value, 1); }
+
+				write.value = nullptr;
+			}
+
+			/// <summary>
+			/// Copies value into count consecutive raw elements. Trivial components double the filled part with every memcpy
+			/// </summary>
+			void FillColumn(const ComponentInfo& info, uint8_t* destination, const void* value, uint32_t count)
+			{
+				if (count == 0) { return; }
+
+				if (!info.trivial)
+				{
+					for (uint32_t index = 0; index < count; ++index) { info.copy(destination + static_cast<size_t>(index) * info.size, value, 1); }
+					return;
+				}
+
+				const size_t total = static_cast<size_t>(count) * info.size;
+				std::memcpy(destination, value, info.size);
+				for (size_t filled = info.size; filled < total; filled *= 2) { std::memcpy(destination + filled, destination, std::min(filled, total - filled)); }
+			}
+
+			void* FindWrite(const EntityChange& change, const ComponentWrite* writes, ComponentId id)
+			{
+				for (uint32_t index = change.firstWrite; index < change.firstWrite + change.writeCount; ++index)
+				{
+					if (writes[index].id == id) { return writes[index].value; }
+				}
+
+				return nullptr;
+			}
+		}
+
+		World::World()
+		{
+			m_emptyArchetype = &GetArchetype(ComponentMask{});
+		}
+
+		// Archetypes go first (member order) , handing their chunks back to the allocator before it frees them
+		World::~World() = default;
+
+		void World::Reserve(size_t count)
+		{
+			m_records.reserve(count);
+			m_generations.reserve(count);
+		}
+
+		void World::Clear()
+		{
+			for (uint32_t index = 0; index < m_records.size(); ++index)
+			{
+				if (m_records[index].archetype == nullptr) { continue; }
+
+				m_records[index].archetype = nullptr;
+				++m_generations[index];
+				m_freeIndices.push_back(index);
+			}
+
+			m_archetypeLookup.clear();
+			m_archetypes.clear();
+			++m_archetypeGeneration;
+			m_entityCount = 0;
+
+			m_emptyArchetype = &GetArchetype(ComponentMask{});
+		}
+
+
+		// ================ ENTITIES ======================
+
+		Entity World::Create()
+		{
+			RowLocation location;
+			return CreateEntity(*m_emptyArchetype, location);
+		}
+
+		Entity World::CreateEntity(Archetype& archetype, RowLocation& outLocation)
+		{
+			uint32_t index;
+			if (!m_freeIndices.empty())
+			{
+				index = m_freeIndices.back();
+				m_freeIndices.pop_back();
+			}
+			else
+			{
+				index = static_cast<uint32_t>(m_records.size());
+				m_records.emplace_back();
+				m_generations.push_back(0);
+			}
+
+			const Entity entity{ index, m_generations[index] };
+			outLocation = archetype.AllocateRow(entity, m_version);
+
+			m_records[index] = EntityRecord{ &archetype, outLocation };
+			++m_entityCount;
+			return entity;
+		}
+
+		void World::Instantiate(const Prefab& prefab, size_t count, const Components::Transform* transforms, Entity* outEntities)
+		{
+			if (count == 0) { return; }
+
+			const ComponentId linkId = ComponentRegistry::GetId<PrefabLink>();
+			const ComponentId transformId = ComponentRegistry::GetId<Components::Transform>();
+
+			ComponentMask mask = prefab.GetInstanceMask();
+			mask.set(linkId);
+			if (transforms != nullptr) { mask.set(transformId); }
+
+			Archetype& archetype = GetArchetype(mask);
+			const std::vector<ComponentId>& components = archetype.GetComponents();
+
+			Entity* entities = outEntities;
+			if (entities == nullptr)
+			{
+				m_instanceEntities.resize(count);
+				entities = m_instanceEntities.data();
+			}
+
+			// Every id up front , recycled ones first like CreateEntity , then one resize for the rest
+			size_t reused = std::min(count, m_freeIndices.size());
+			for (size_t index = 0; index < reused; ++index)
+			{
+				const uint32_t entityIndex = m_freeIndices[m_freeIndices.size() - 1 - index];
+				entities[index] = Entity{ entityIndex, m_generations[entityIndex] };
+			}
+			m_freeIndices.resize(m_freeIndices.size() - reused);
+
+			const uint32_t firstNew = static_cast<uint32_t>(m_records.size());
+			m_records.resize(m_records.size() + (count - reused));
+			m_generations.resize(m_records.size(), 0);
+			for (size_t index = reused; index < count; ++index) { entities[index] = Entity{ firstNew + static_cast<uint32_t>(index - reused), 0 }; }
+
+			const PrefabLink link{ &prefab };
+
+			for (size_t done = 0; done < count;)
+			{
+				RowLocation location;
+				const uint32_t wanted = static_cast<uint32_t>(std::min<size_t>(count - done, archetype.GetCapacity()));
+				const uint32_t rows = archetype.AllocateRows(entities + done, wanted, m_version, location);
+				const Chunk& chunk = archetype.GetChunk(location.chunk);
+
+				for (uint32_t column = 0; column < components.size(); ++column)
+				{
+					const ComponentId id = components[column];
+					const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+					uint8_t* destination = static_cast<uint8_t*>(archetype.GetColumnData(chunk, column)) + static_cast<size_t>(location.row) * info.size;
+
+					if (id == transformId && transforms != nullptr) { info.copy(destination, transforms + done, rows); }
+					else { FillColumn(info, destination, id == linkId ? &link : prefab.GetValue(id), rows); }
+				}
+
+				for (uint32_t row = 0; row < rows; ++row)
+				{
+					m_records[entities[done + row].index] = EntityRecord{ &archetype, RowLocation{ location.chunk, location.row + row } };
+				}
+
+				done += rows;
+			}
+
+			m_entityCount += count;
+		}
+
+		void World::Destroy(Entity entity)
+		{
+			if (!IsValid(entity)) { return; }
+
+			EntityRecord& record = m_records[entity.index];
+
+			const Entity moved = record.archetype->DestroyRow(record.location, m_version);
+			if (moved != NULLENTITY) { m_records[moved.index].location = record.location; }
+
+			record.archetype = nullptr;
+			++m_generations[entity.index];
+			m_freeIndices.push_back(entity.index);
+			--m_entityCount;
+		}
+
+		bool World::IsAlive(Entity entity) const
+		{
+			return IsValid(entity);
+		}
+
+		bool World::IsValid(Entity entity) const
+		{
+			return entity.index < m_records.size() && m_generations[entity.index] == entity.generation && m_records[entity.index].archetype != nullptr;
+		}
+
+
+		// ================ COMPONENTS ======================
+
+		void* World::GetComponent(Entity entity, ComponentId id) const
+		{
+			if (!IsValid(entity)) { return nullptr; }
+
+			const EntityRecord& record = m_records[entity.index];
+			const uint32_t column = record.archetype->GetColumn(id);
+
+			return column != INVALIDCOLUMN ? record.archetype->GetComponent(record.location, column) : nullptr;
+		}
+
+		void* World::WriteComponent(Entity entity, ComponentId id)
+		{
+			if (!IsValid(entity)) { return nullptr; }
+
+			const EntityRecord& record = m_records[entity.index];
+			const uint32_t column = record.archetype->GetColumn(id);
+			if (column == INVALIDCOLUMN) { return nullptr; }
+
+			record.archetype->MarkChanged(record.archetype->GetChunk(record.location.chunk), column, m_version);
+			return record.archetype->GetComponent(record.location, column);
+		}
+
+		void* World::AddComponent(Entity entity, ComponentId id, bool& outCreated)
+		{
+			outCreated = false;
+			if (!IsValid(entity) || id >= MAXCOMPONENTS) { return nullptr; }
+
+			Archetype& source = *m_records[entity.index].archetype;
+			if (source.Has(id)) { return WriteComponent(entity, id); }
+
+			Archetype& target = *GetNeighbour(source, id, true);
+			MoveEntity(entity, target);
+
+			outCreated = true;
+			return target.GetComponent(m_records[entity.index].location, target.GetColumn(id));
+		}
+
+		bool World::RemoveComponent(Entity entity, ComponentId id)
+		{
+			if (!IsValid(entity)) { return false; }
+
+			Archetype& source = *m_records[entity.index].archetype;
+			if (!source.Has(id)) { return false; }
+
+			MoveEntity(entity, *GetNeighbour(source, id, false));
+			return true;
+		}
+
+		void World::MoveEntity(Entity entity, Archetype& target)
+		{
+			EntityRecord& record = m_records[entity.index];
+			Archetype& source = *record.archetype;
+			const RowLocation from = record.location;
+			const RowLocation to = target.AllocateRow(entity, m_version);
+
+			// Both column lists are sorted by id , so one merge walk pairs them up
+			const std::vector<ComponentId>& sourceComponents = source.GetComponents();
+			const std::vector<ComponentId>& targetComponents = target.GetComponents();
+
+			uint32_t targetColumn = 0;
+			for (uint32_t sourceColumn = 0; sourceColumn < sourceComponents.size(); ++sourceColumn)
+			{
+				const ComponentId id = sourceComponents[sourceColumn];
+				while (targetColumn < targetComponents.size() && targetComponents[targetColumn] < id) { ++targetColumn; }
+
+				const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+				void* component = source.GetComponent(from, sourceColumn);
+
+				if (targetColumn < targetComponents.size() && targetComponents[targetColumn] == id)
+				{
+					info.move(target.GetComponent(to, targetColumn), component, 1);
+				}
+				else if (!info.trivial)
+				{
+					info.destruct(component, 1);
+				}
+			}
+
+			const Entity moved = source.RemoveRow(from, m_version);
+			if (moved != NULLENTITY) { m_records[moved.index].location = from; }
+
+			record.archetype = &target;
+			record.location = to;
+		}
+
+
+		// ================ BATCHED CHANGES ======================
+
+		void World::ApplyChanges(EntityChange* changes, size_t count, ComponentWrite* writes)
+		{
+			m_batchGroups.clear();
+			m_batchGroupOf.assign(count, UINT32_MAX);
+
+			std::unordered_map<std::pair<Archetype*, Archetype*>, uint32_t, ArchetypePairHash> groupLookup;
+			Archetype* lastTarget = nullptr;
+
+			// Source and target archetype of every change. Groups are numbered in order of first appearance ,
+			// so the rows come out the same whatever addresses the archetypes got
+			std::pair<Archetype*, Archetype*> lastPair{ nullptr, nullptr };
+			uint32_t lastGroup = UINT32_MAX;
+
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				if (index + PREFETCHDISTANCE < count && changes[index + PREFETCHDISTANCE].entity.index < m_records.size())
+				{
+					Prefetch(&m_records[changes[index + PREFETCHDISTANCE].entity.index]);
+					Prefetch(&m_generations[changes[index + PREFETCHDISTANCE].entity.index]);
+				}
+
+				EntityChange& change = changes[index];
+				const bool spawn = change.entity == NULLENTITY;
+				Archetype* source = !spawn && IsValid(change.entity) ? m_records[change.entity.index].archetype : nullptr;
+				const bool skip = spawn ? change.destroy : source == nullptr;
+				const ComponentMask mask = source != nullptr ? (source->GetMask() & ~change.remove) | change.add : change.add;
+
+				for (uint32_t write = change.firstWrite; write < change.firstWrite + change.writeCount; ++write)
+				{
+					if (writes[write].value == nullptr) { continue; }
+					if (skip || change.destroy || !mask.test(writes[write].id)) { DestroyValue(writes[write]); }
+				}
+
+				if (skip) { continue; }
+
+				Archetype* target = nullptr;
+				if (!change.destroy)
+				{
+					if (source != nullptr && source->GetMask() == mask) { target = source; }
+					else if (lastTarget != nullptr && lastTarget->GetMask() == mask) { target = lastTarget; }
+					else { target = &GetArchetype(mask); }
+
+					lastTarget = target;
+				}
+
+				// Neighbouring changes mostly share a group , only look it up when the pair differs
+				const std::pair<Archetype*, Archetype*> pair{ source, target };
+				if (lastGroup == UINT32_MAX || pair != lastPair)
+				{
+					auto found = groupLookup.find(pair);
+					if (found == groupLookup.end())
+					{
+						found = groupLookup.emplace(pair, static_cast<uint32_t>(m_batchGroups.size())).first;
+						m_batchGroups.push_back(BatchGroup{ source, target, 0, 0 });
+					}
+
+					lastPair = pair;
+					lastGroup = found->second;
+				}
+
+				m_batchGroupOf[index] = lastGroup;
+				++m_batchGroups[lastGroup].count;
+			}
+
+			// Counting sort of the changes into their groups
+			uint32_t total = 0;
+			for (BatchGroup& group : m_batchGroups)
+			{
+				group.first = total;
+				total += group.count;
+				group.count = 0;
+			}
+
+			m_batchEntries.resize(total);
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				if (m_batchGroupOf[index] == UINT32_MAX) { continue; }
+
+				BatchGroup& group = m_batchGroups[m_batchGroupOf[index]];
+				m_batchEntries[group.first + group.count++] = BatchEntry{ index, RowLocation{}, RowLocation{} };
+			}
+
+			for (const BatchGroup& group : m_batchGroups)
+			{
+				if (group.target == nullptr)
+				{
+					for (uint32_t index = 0; index < group.count; ++index) { Destroy(changes[m_batchEntries[group.first + index].change].entity); }
+				}
+				else if (group.source == group.target) { WriteBatch(group, changes, writes); }
+				else { MoveBatch(group, changes, writes); }
+			}
+		}
+
+		void World::MoveBatch(const BatchGroup& group, EntityChange* changes, ComponentWrite* writes)
+		{
+			Archetype* source = group.source;
+			Archetype& target = *group.target;
+			BatchEntry* entries = m_batchEntries.data() + group.first;
+
+			// Rows for the whole group first. Source isn't target , so the source rows stay put until they're dropped below
+			for (uint32_t index = 0; index < group.count; ++index)
+			{
+				BatchEntry& entry = entries[index];
+				EntityChange& change = changes[entry.change];
+
+				if (source != nullptr && index + PREFETCHDISTANCE < group.count)
+				{
+					Prefetch(&m_records[changes[entries[index + PREFETCHDISTANCE].change].entity.index]);
+				}
+
+				if (source == nullptr)
+				{
+					change.entity = CreateEntity(target, entry.to);
+					continue;
+				}
+
+				entry.from = m_records[change.entity.index].location;
+				entry.to = target.AllocateRow(change.entity, m_version);
+			}
+
+			// One merge walk over both sorted column lists , each column then moves for every entity of the group
+			static const std::vector<ComponentId> noComponents;
+			const std::vector<ComponentId>& sourceComponents = source != nullptr ? source->GetComponents() : noComponents;
+			const std::vector<ComponentId>& targetComponents = target.GetComponents();
+
+			uint32_t sourceColumn = 0;
+			uint32_t targetColumn = 0;
+			while (sourceColumn < sourceComponents.size() || targetColumn < targetComponents.size())
+			{
+				const bool sourceLeft = sourceColumn < sourceComponents.size();
+				const bool targetLeft = targetColumn < targetComponents.size();
+				const ComponentId id = !targetLeft || (sourceLeft && sourceComponents[sourceColumn] < targetComponents[targetColumn])
+					? sourceComponents[sourceColumn] : targetComponents[targetColumn];
+
+				const bool inSource = sourceLeft && sourceComponents[sourceColumn] == id;
+				const bool inTarget = targetLeft && targetComponents[targetColumn] == id;
+				const ComponentInfo& info = ComponentRegistry::GetInfo(id);
+
+				for (uint32_t index = 0; index < group.count; ++index)
+				{
+					const BatchEntry& entry = entries[index];
+					void* component = inSource ? source->GetComponent(entry.from, sourceColumn) : nullptr;
+
+					if (inSource && index + PREFETCHDISTANCE < group.count)
+					{
+						PrefetchRange(source->GetComponent(entries[index + PREFETCHDISTANCE].from, sourceColumn), info.size);
+					}
+
+					if (!inTarget)
+					{
+						if (!info.trivial) { info.destruct(component, 1); }
+						continue;
+					}
+
+					void* destination = target.GetComponent(entry.to, targetColumn);
+					void* value = FindWrite(changes[entry.change], writes, id);
+
+					if (value != nullptr)
+					{
+						if (component != nullptr && !info.trivial) { info.destruct(component, 1); }
+						info.move(destination, value, 1);
+					}
+					else if (component != nullptr) { info.move(destination, component, 1); }
+					else { info.construct(destination, 1); }
+				}
+
+				sourceColumn += inSource ? 1 : 0;
+				targetColumn += inTarget ? 1 : 0;
+			}
+
+			if (source == nullptr) { return; }
+
+			for (uint32_t index = 0; index < group.count; ++index)
+			{
+				EntityRecord& record = m_records[changes[entries[index].change].entity.index];
+				record.archetype = &target;
+				record.location = entries[index].to;
+			}
+
+			// Drop the source rows back to front : the row that fills each hole is never one that still has to go
+			std::sort(entries, entries + group.count, [](const BatchEntry& first, const BatchEntry& second)
+			{
+				return first.from.chunk != second.from.chunk ? first.from.chunk > second.from.chunk : first.from.row > second.from.row;
+			});
+
+			for (uint32_t index = 0; index < group.count; ++index)
+			{
+				if (index + PREFETCHDISTANCE < group.count)
+				{
+					const RowLocation ahead = entries[index + PREFETCHDISTANCE].from;
+					for (uint32_t column = 0; column < sourceComponents.size(); ++column)
+					{
+						PrefetchRange(source->GetComponent(ahead, column), ComponentRegistry::GetInfo(sourceComponents[column]).size);
+					}
+				}
+
+				const Entity moved = source->RemoveRow(entries[index].from, m_version);
+				if (moved != NULLENTITY) { m_records[moved.index].location = entries[index].from; }
+			}
+		}
+
+		void World::WriteBatch(const BatchGroup& group, EntityChange* changes, ComponentWrite* writes)
+		{
+			Archetype& archetype = *group.target;
+
+			for (uint32_t index = 0; index < group.count; ++index)
+			{
+				const EntityChange& change = changes[m_batchEntries[group.first + index].change];
+				const RowLocation location = m_records[change.entity.index].location;
+
+				for (uint32_t write = change.firstWrite; write < change.firstWrite + change.writeCount; ++write)
+				{
+					if (writes[write].value == nullptr) { continue; }
+
+					const uint32_t column = archetype.GetColumn(writes[write].id);
+					const ComponentInfo& info = ComponentRegistry::GetInfo(writes[write].id);
+					void* component = archetype.GetComponent(location, column);
+
+					if (!info.trivial) { info.destruct(component, 1); }
+					info.move(component, writes[write].value, 1);
+					archetype.MarkChanged(archetype.GetChunk(location.chunk), column, m_version);
+				}
+			}
+		}
+
+
+		// ================ ARCHETYPES ======================
+
+		Archetype& World::GetArchetype(const ComponentMask& mask)
+		{
+			const auto found = m_archetypeLookup.find(mask);
+			if (found != m_archetypeLookup.end()) { return *found->second; }
+
+			m_archetypes.push_back(Memory::MakeUnique<Archetype>(mask, m_chunkAllocator));
+
+			Archetype* archetype = m_archetypes.back().get();
+			m_archetypeLookup.emplace(mask, archetype);
+			return *archetype;
+		}
+
+		Archetype* World::GetNeighbour(Archetype& archetype, ComponentId id, bool add)
+		{
+			Archetype* neighbour = archetype.GetEdge(id, add);
+			if (neighbour != nullptr) { return neighbour; }
+
+			ComponentMask mask = archetype.GetMask();
+			mask.set(id, add);
+
+			neighbour = &GetArchetype(mask);
+			archetype.SetEdge(id, add, neighbour);
+			neighbour->SetEdge(id, !add, &archetype);
+			return neighbour;
+		}
+	}
+}
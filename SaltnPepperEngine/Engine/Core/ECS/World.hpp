@@ -0,0 +1,390 @@
+#ifndef WORLD_H
+#define WORLD_H
+#include "Core/EngineDefines.hpp"
+#include "Core/ECS/Archetype.hpp"
+#include "Core/ECS/ComponentRegistry.hpp"
+#include "Core/ECS/Entity.hpp"
+#include "Core/Memory/MemoryDefinitions.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Components
+	{
+		struct Transform;
+	}
+
+	namespace ECS
+	{
+		class Prefab;
+
+		/// <summary>
+		/// A component value ApplyChanges relocates into an entity's component (the value gets destroyed)
+		/// </summary>
+		struct ComponentWrite
+		{
+			ComponentId id = INVALIDCOMPONENT;
+			void* value = nullptr;
+		};
+
+		/// <summary>
+		/// State one entity ends up in after a batch of changes , with at most one write per component
+		/// </summary>
+		struct EntityChange
+		{
+			// NULLENTITY spawns a new entity , ApplyChanges fills in its id
+			Entity entity = NULLENTITY;
+
+			// Components added / removed on top of the ones the entity has when the batch gets applied
+			ComponentMask add;
+			ComponentMask remove;
+
+			// Range of the writes array with the values for this entity
+			uint32_t firstWrite = 0;
+			uint32_t writeCount = 0;
+
+			bool destroy = false;
+		};
+
+		/// <summary>
+		/// Archetype based entity store. Entities with the same component set share an Archetype and sit in its chunks
+		/// as one row of structure of arrays columns , adding or removing a component moves the row to the matching archetype.
+		/// Component pointers stay valid until the next structural change (create , destroy , add , remove). Not thread safe.
+		/// Writes stamp the chunk's column with the world version (see Archetype) , Query uses them to skip unchanged chunks
+		/// </summary>
+		class SNP_API World
+		{
+		public:
+
+			World();
+			~World();
+
+			NONCOPYABLE(World)
+
+			/// <summary>
+			/// Sizes the entity table for count entities
+			/// </summary>
+			void Reserve(size_t count);
+
+			/// <summary>
+			/// Destroys every entity , all ids become invalid
+			/// </summary>
+			void Clear();
+
+
+			// ================ ENTITIES ======================
+
+			/// <summary>
+			/// Entity without components
+			/// </summary>
+			Entity Create();
+
+			/// <summary>
+			/// Entity with the given components , moved straight into their columns
+			/// </summary>
+			template <typename... Components>
+			Entity Create(Components&&... components);
+
+			/// <summary>
+			/// Bulk spawn of count instances of prefab , written straight into chunk storage a chunk at a time : one id run ,
+			/// then every column filled for all the rows that fit the chunk (memcpy for trivial components). Instances get the
+			/// prefab's instance components , a PrefabLink and , when transforms isn't null , a Transform copied from transforms[i].
+			/// outEntities (count entries) receives the ids if given
+			/// </summary>
+			void Instantiate(const Prefab& prefab, size_t count, const Components::Transform* transforms = nullptr, Entity* outEntities = nullptr);
+
+			/// <summary>
+			/// Destroys the entity and its components , stale ids are ignored
+			/// </summary>
+			void Destroy(Entity entity);
+
+			bool IsAlive(Entity entity) const;
+
+			size_t GetEntityCount() const { return m_entityCount; }
+
+
+			// ================ COMPONENTS ======================
+
+			template <typename T>
+			bool Has(Entity entity) const { return GetComponent(entity, ComponentRegistry::GetId<T>()) != nullptr; }
+
+			/// <summary>
+			/// The entity's component , nullptr if it doesn't have one or is dead
+			/// </summary>
+			template <typename T>
+			T* Get(Entity entity) { return static_cast<T*>(WriteComponent(entity, ComponentRegistry::GetId<T>())); }
+
+			template <typename T>
+			const T* Get(Entity entity) const { return static_cast<const T*>(GetComponent(entity, ComponentRegistry::GetId<T>())); }
+
+			/// <summary>
+			/// Adds the component (moving the entity to the archetype with it) or overwrites the one it has.
+			/// Returns the component , nullptr for dead entities
+			/// </summary>
+			template <typename T>
+			T* Add(Entity entity, T component = T{});
+
+			/// <summary>
+			/// Removes the component (moving the entity to the archetype without it). Returns false if it didn't have one
+			/// </summary>
+			template <typename T>
+			bool Remove(Entity entity) { return RemoveComponent(entity, ComponentRegistry::GetId<T>()); }
+
+
+			// ================ ITERATION ======================
+
+			/// <summary>
+			/// Calls function(Components&... components) for every entity that has all of them , chunk by chunk.
+			/// Non const components count as written. See Query for cached , change filtered and parallel iteration
+			/// </summary>
+			template <typename... Components, typename Function>
+			void Each(Function&& function);
+
+			/// <summary>
+			/// Calls function(Entity entity , Components&... components) for every entity that has all of them
+			/// </summary>
+			template <typename... Components, typename Function>
+			void EachEntity(Function&& function);
+
+			/// <summary>
+			/// Calls function(const Archetype& archetype , const Chunk& chunk) for every chunk whose archetype has every bit of mask
+			/// </summary>
+			template <typename Function>
+			void EachChunk(const ComponentMask& mask, Function&& function) const;
+
+
+			// ================ TYPE ERASED ======================
+			// What the templates above (and tools that only know component ids) go through
+
+			void* GetComponent(Entity entity, ComponentId id) const;
+
+			/// <summary>
+			/// GetComponent that stamps the component's column in the entity's chunk as changed
+			/// </summary>
+			void* WriteComponent(Entity entity, ComponentId id);
+
+			/// <summary>
+			/// Moves the entity to the archetype with the component. Returns the component's memory , raw when outCreated
+			/// comes back true (the caller constructs it) , the existing component otherwise. nullptr for dead entities
+			/// </summary>
+			void* AddComponent(Entity entity, ComponentId id, bool& outCreated);
+
+			bool RemoveComponent(Entity entity, ComponentId id);
+
+			/// <summary>
+			/// The archetype with exactly the components in mask , created on first use
+			/// </summary>
+			Archetype& GetArchetype(const ComponentMask& mask);
+
+			const std::vector<Memory::UniquePtr<Archetype>>& GetArchetypes() const { return m_archetypes; }
+
+			/// <summary>
+			/// The archetype the entity lives in , nullptr for dead entities
+			/// </summary>
+			const Archetype* GetEntityArchetype(Entity entity) const { return IsValid(entity) ? m_records[entity.index].archetype : nullptr; }
+
+			/// <summary>
+			/// Bumped by Clear , archetypes are only ever appended in between
+			/// </summary>
+			uint32_t GetArchetypeGeneration() const { return m_archetypeGeneration; }
+
+
+			// ================ BATCHED CHANGES ======================
+
+			/// <summary>
+			/// Moves every entity straight to its final archetype in one pass (what CommandBuffer plays back through).
+			/// Entities are grouped by source and target archetype and each group is moved column by column ,
+			/// its component functions looked up once per column instead of once per entity , with the rows prefetched ahead.
+			/// Changes sorted by entity index walk the entity table front to back. Every write value is consumed :
+			/// relocated into its component , or destroyed when the entity is dead or doesn't end up with the component.
+			/// Changes for the same entity twice in one batch aren't supported
+			/// </summary>
+			void ApplyChanges(EntityChange* changes, size_t count, ComponentWrite* writes);
+
+
+			// ================ VERSIONS ======================
+
+			/// <summary>
+			/// Version structural changes and writes outside of queries are stamped with
+			/// </summary>
+			uint32_t GetVersion() const { return m_version; }
+
+			/// <summary>
+			/// Hands out a version no chunk has been stamped with yet , for a query run to stamp its writes with.
+			/// Everything written afterwards gets a newer one
+			/// </summary>
+			uint32_t AdvanceVersion()
+			{
+				m_version += 2;
+				return m_version - 1;
+			}
+
+		private:
+
+			struct EntityRecord
+			{
+				Archetype* archetype = nullptr;
+				RowLocation location;
+			};
+
+			/// <summary>
+			/// Allocates an id and a raw row in archetype
+			/// </summary>
+			Entity CreateEntity(Archetype& archetype, RowLocation& outLocation);
+
+			bool IsValid(Entity entity) const;
+
+			/// <summary>
+			/// Moves the entity's row into target. Components both archetypes have are relocated , the others destroyed ,
+			/// ones only target has are left raw
+			/// </summary>
+			void MoveEntity(Entity entity, Archetype& target);
+
+			Archetype* GetNeighbour(Archetype& archetype, ComponentId id, bool add);
+
+			template <bool WithEntity, typename... Components, typename Function, size_t... Indices>
+			void EachImpl(Function& function, std::index_sequence<Indices...>);
+
+			struct BatchEntry
+			{
+				uint32_t change = 0;
+				RowLocation from;
+				RowLocation to;
+			};
+
+			struct BatchGroup
+			{
+				Archetype* source = nullptr;
+				Archetype* target = nullptr;
+				uint32_t first = 0;
+				uint32_t count = 0;
+			};
+
+			/// <summary>
+			/// Moves a group of entities from source (nullptr for spawns) to target column by column
+			/// </summary>
+			void MoveBatch(const BatchGroup& group, EntityChange* changes, ComponentWrite* writes);
+
+			/// <summary>
+			/// Overwrites components in place for a group that stays in its archetype
+			/// </summary>
+			void WriteBatch(const BatchGroup& group, EntityChange* changes, ComponentWrite* writes);
+
+			// ======== ENTITY TABLE ========
+			std::vector<EntityRecord> m_records;
+			std::vector<uint32_t> m_generations;
+			std::vector<uint32_t> m_freeIndices;
+			size_t m_entityCount = 0;
+
+			// ======== ARCHETYPES ========
+			ChunkAllocator m_chunkAllocator;
+			std::vector<Memory::UniquePtr<Archetype>> m_archetypes;
+			std::unordered_map<ComponentMask, Archetype*> m_archetypeLookup;
+			Archetype* m_emptyArchetype = nullptr;
+			uint32_t m_archetypeGeneration = 0;
+
+			// Starts above 0 so every chunk counts as changed for a query that never ran
+			uint32_t m_version = 1;
+
+			// ======== BATCH SCRATCH ========
+			std::vector<BatchEntry> m_batchEntries;
+			std::vector<BatchGroup> m_batchGroups;
+			std::vector<uint32_t> m_batchGroupOf;
+			std::vector<Entity> m_instanceEntities;
+		};
+
+
+		// ================ TEMPLATE IMPLEMENTATIONS ======================
+
+		template <typename... Components>
+		Entity World::Create(Components&&... components)
+		{
+			Archetype& archetype = GetArchetype(MakeMask<Components...>());
+
+			RowLocation location;
+			const Entity entity = CreateEntity(archetype, location);
+
+			(new (archetype.GetComponent(location, archetype.GetColumn(ComponentRegistry::GetId<Components>())))
+				std::remove_cv_t<std::remove_reference_t<Components>>(std::forward<Components>(components)), ...);
+
+			return entity;
+		}
+
+		template <typename T>
+		T* World::Add(Entity entity, T component)
+		{
+			bool created = false;
+			void* memory = AddComponent(entity, ComponentRegistry::GetId<T>(), created);
+			if (memory == nullptr) { return nullptr; }
+
+			if (created) { return new (memory) T(std::move(component)); }
+
+			T* existing = static_cast<T*>(memory);
+			*existing = std::move(component);
+			return existing;
+		}
+
+		template <typename... Components, typename Function>
+		void World::Each(Function&& function)
+		{
+			EachImpl<false, Components...>(function, std::index_sequence_for<Components...>{});
+		}
+
+		template <typename... Components, typename Function>
+		void World::EachEntity(Function&& function)
+		{
+			EachImpl<true, Components...>(function, std::index_sequence_for<Components...>{});
+		}
+
+		template <bool WithEntity, typename... Components, typename Function, size_t... Indices>
+		void World::EachImpl(Function& function, std::index_sequence<Indices...>)
+		{
+			const ComponentMask mask = MakeMask<Components...>();
+			const ComponentId ids[] = { ComponentRegistry::GetId<Components>()..., 0 };
+
+			for (const Memory::UniquePtr<Archetype>& archetype : m_archetypes)
+			{
+				if ((archetype->GetMask() & mask) != mask || archetype->GetEntityCount() == 0) { continue; }
+
+				const uint32_t columns[] = { archetype->GetColumn(ids[Indices])..., 0 };
+
+				for (size_t chunkIndex = 0; chunkIndex < archetype->GetChunkCount(); ++chunkIndex)
+				{
+					const Chunk& chunk = archetype->GetChunk(chunkIndex);
+					((std::is_const_v<Components> ? void() : archetype->MarkChanged(chunk, columns[Indices], m_version)), ...);
+					const std::tuple<Components*...> data(archetype->template GetColumnData<std::remove_const_t<Components>>(chunk, columns[Indices])...);
+					const Entity* entities = archetype->GetEntities(chunk);
+
+					for (uint32_t row = 0; row < chunk.count; ++row)
+					{
+						if constexpr (WithEntity) { function(entities[row], std::get<Indices>(data)[row]...); }
+						else { function(std::get<Indices>(data)[row]...); }
+					}
+				}
+			}
+		}
+
+		template <typename Function>
+		void World::EachChunk(const ComponentMask& mask, Function&& function) const
+		{
+			for (const Memory::UniquePtr<Archetype>& archetype : m_archetypes)
+			{
+				if ((archetype->GetMask() & mask) != mask) { continue; }
+
+				for (size_t chunkIndex = 0; chunkIndex < archetype->GetChunkCount(); ++chunkIndex)
+				{
+					function(*archetype, archetype->GetChunk(chunkIndex));
+				}
+			}
+		}
+	}
+}
+
+#endif // !WORLD_H
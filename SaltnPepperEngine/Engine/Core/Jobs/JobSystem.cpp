@@ -0,0 +1,191 @@
+#include "JobSystem.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Jobs
+	{
+		namespace
+		{
+			// The batch every thread is currently pulling slices from
+			struct Batch
+			{
+				const RangeFunction* function = nullptr;
+				size_t count = 0;
+				size_t grainSize = 1;
+				std::atomic<size_t> nextBegin{ 0 };
+			};
+
+			struct PoolState
+			{
+				std::vector<std::thread> workers;
+
+				// Serializes submissions from different outside threads , the pool runs one batch at a time
+				std::mutex submitMutex;
+
+				std::mutex mutex;
+				std::condition_variable wakeCondition;
+				std::condition_variable doneCondition;
+
+				Batch batch;
+				uint64_t generation = 0;
+				std::atomic<uint32_t> pendingWorkers{ 0 };
+				bool shutdown = false;
+
+				// Joins the workers if OnDestroy was never called , a static condition variable
+				// can't be destroyed while threads still wait on it
+				~PoolState() { StopWorkers(); }
+
+				void StopWorkers()
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						shutdown = true;
+					}
+					wakeCondition.notify_all();
+
+					for (std::thread& worker : workers) { worker.join(); }
+
+					workers.clear();
+					generation = 0;
+				}
+			};
+
+			PoolState& GetState()
+			{
+				static PoolState state;
+				return state;
+			}
+
+			thread_local uint32_t t_threadIndex = 0;
+
+			// Set while the thread runs slices of a batch , any ParallelFor issued from there runs inline.
+			// The submitting thread holds submitMutex for the whole batch , so waiting on the pool would deadlock it
+			thread_local bool t_insideBatch = false;
+
+			void RunSlices(Batch& batch)
+			{
+				t_insideBatch = true;
+
+				while (true)
+				{
+					const size_t begin = batch.nextBegin.fetch_add(batch.grainSize, std::memory_order_relaxed);
+					if (begin >= batch.count) { break; }
+
+					const size_t end = batch.count - begin < batch.grainSize ? batch.count : begin + batch.grainSize;
+					(*batch.function)(begin, end);
+				}
+
+				t_insideBatch = false;
+			}
+
+			void WorkerLoop(uint32_t threadIndex)
+			{
+				t_threadIndex = threadIndex;
+
+				PoolState& state = GetState();
+				uint64_t seenGeneration = 0;
+
+				while (true)
+				{
+					{
+						std::unique_lock<std::mutex> lock(state.mutex);
+						state.wakeCondition.wait(lock, [&]() { return state.shutdown || state.generation != seenGeneration; });
+
+						if (state.shutdown) { return; }
+						seenGeneration = state.generation;
+					}
+
+					RunSlices(state.batch);
+
+					if (state.pendingWorkers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						std::lock_guard<std::mutex> lock(state.mutex);
+						state.doneCondition.notify_one();
+					}
+				}
+			}
+		}
+
+		void JobSystem::OnInit(uint32_t workerCount)
+		{
+			PoolState& state = GetState();
+			if (!state.workers.empty()) { return; }
+
+			if (workerCount == 0)
+			{
+				const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+				workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+			}
+
+			state.shutdown = false;
+			state.workers.reserve(workerCount);
+
+			for (uint32_t index = 0; index < workerCount; ++index)
+			{
+				state.workers.emplace_back(WorkerLoop, index + 1);
+			}
+
+			LOG_INFO("Job System : {0} worker threads", workerCount);
+		}
+
+		void JobSystem::OnDestroy()
+		{
+			GetState().StopWorkers();
+		}
+
+		uint32_t JobSystem::GetWorkerCount()
+		{
+			return static_cast<uint32_t>(GetState().workers.size());
+		}
+
+		uint32_t JobSystem::GetThreadCount()
+		{
+			return GetWorkerCount() + 1;
+		}
+
+		uint32_t JobSystem::GetThreadIndex()
+		{
+			return t_threadIndex;
+		}
+
+		void JobSystem::ParallelFor(size_t count, size_t grainSize, const RangeFunction& function)
+		{
+			if (count == 0) { return; }
+			if (grainSize == 0) { grainSize = 1; }
+
+			PoolState& state = GetState();
+
+			// Nested submissions (from a worker or from the submitting thread's own slices) would wait on themselves , run those inline
+			if (state.workers.empty() || count <= grainSize || t_insideBatch)
+			{
+				function(0, count);
+				return;
+			}
+
+			std::lock_guard<std::mutex> submitLock(state.submitMutex);
+
+			state.batch.function = &function;
+			state.batch.count = count;
+			state.batch.grainSize = grainSize;
+			state.batch.nextBegin.store(0, std::memory_order_relaxed);
+			state.pendingWorkers.store(static_cast<uint32_t>(state.workers.size()), std::memory_order_relaxed);
+
+			{
+				std::lock_guard<std::mutex> lock(state.mutex);
+				++state.generation;
+			}
+			state.wakeCondition.notify_all();
+
+			RunSlices(state.batch);
+
+			std::unique_lock<std::mutex> lock(state.mutex);
+			state.doneCondition.wait(lock, [&]() { return state.pendingWorkers.load(std::memory_order_acquire) == 0; });
+		}
+	}
+}
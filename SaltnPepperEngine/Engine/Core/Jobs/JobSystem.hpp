@@ -0,0 +1,61 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+#include "Core/EngineDefines.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace SaltnPepperEngine
+{
+	namespace Jobs
+	{
+		/// <summary>
+		/// Range job : gets called with a half open [begin , end) slice of the full range
+		/// </summary>
+		using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+		/// <summary>
+		/// Fixed pool of worker threads for data parallel loops.
+		/// The calling thread always works on its own batch too , so a pool with zero workers simply runs everything inline
+		/// </summary>
+		class SNP_API JobSystem
+		{
+		public:
+
+			/// <summary>
+			/// Spawns the workers , 0 picks one per hardware thread minus the calling thread
+			/// </summary>
+			static void OnInit(uint32_t workerCount = 0);
+
+			/// <summary>
+			/// Joins every worker , must not be called while a ParallelFor is running.
+			/// A pool that is still running at exit gets joined during static destruction
+			/// </summary>
+			static void OnDestroy();
+
+			/// <summary>
+			/// Number of worker threads (not counting the thread that submits the work)
+			/// </summary>
+			static uint32_t GetWorkerCount();
+
+			/// <summary>
+			/// Number of threads that can run a batch at once (workers + the caller) , use it to size per thread scratch data
+			/// </summary>
+			static uint32_t GetThreadCount();
+
+			/// <summary>
+			/// 0 on any thread outside the pool , 1 ... GetWorkerCount() on the workers
+			/// </summary>
+			static uint32_t GetThreadIndex();
+
+			/// <summary>
+			/// Splits [0 , count) into slices of (at most) grainSize and runs them across the pool , returns once all of them are done.
+			/// Runs inline when the pool isn't initialized , the range fits in one slice or when called from inside a running batch
+			/// (a job on any thread , including the caller's own slices) , so nesting is safe
+			/// </summary>
+			static void ParallelFor(size_t count, size_t grainSize, const RangeFunction& function);
+		};
+	}
+}
+
+#endif // !JOBSYSTEM_H
@@ -0,0 +1,62 @@
+#include "LinearArena.hpp"
+#include <algorithm>
+#include <new>
+
+namespace SaltnPepperEngine
+{
+	namespace Memory
+	{
+		LinearArena::LinearArena(size_t blockSize)
+			: m_blockSize(std::max<size_t>(blockSize, BLOCKALIGNMENT))
+		{
+		}
+
+		LinearArena::~LinearArena()
+		{
+			for (Block& block : m_blocks)
+			{
+				operator delete(block.data, std::align_val_t(BLOCKALIGNMENT));
+			}
+		}
+
+		void* LinearArena::Allocate(size_t size, size_t alignment)
+		{
+			// Walk on through the blocks kept from before the last Reset , a request a block can't fit skips its tail
+			for (; m_blockIndex < m_blocks.size(); ++m_blockIndex, m_offset = 0)
+			{
+				const Block& block = m_blocks[m_blockIndex];
+				const size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+
+				if (offset + size <= block.size)
+				{
+					m_offset = offset + size;
+					m_usedSize += size;
+					return block.data + offset;
+				}
+			}
+
+			// Out of blocks , requests bigger than the block size get a block of their own
+			const size_t blockSize = std::max(m_blockSize, size);
+			m_blocks.push_back(Block{ static_cast<uint8_t*>(operator new(blockSize, std::align_val_t(BLOCKALIGNMENT))), blockSize });
+
+			m_blockIndex = m_blocks.size() - 1;
+			m_offset = size;
+			m_usedSize += size;
+			return m_blocks.back().data;
+		}
+
+		void LinearArena::Reset()
+		{
+			m_blockIndex = 0;
+			m_offset = 0;
+			m_usedSize = 0;
+		}
+
+		size_t LinearArena::GetCapacity() const
+		{
+			size_t capacity = 0;
+			for (const Block& block : m_blocks) { capacity += block.size; }
+			return capacity;
+		}
+	}
+}
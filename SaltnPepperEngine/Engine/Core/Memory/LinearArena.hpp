@@ -0,0 +1,69 @@
+#ifndef LINEARARENA_H
+#define LINEARARENA_H
+#include "Core/EngineDefines.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Memory
+	{
+		/// <summary>
+		/// Bump allocator over a list of blocks. Reset rewinds it without freeing anything , so once the blocks have grown to
+		/// a frame's worth of data a frame allocates nothing. Never runs destructors , not thread safe
+		/// </summary>
+		class SNP_API LinearArena
+		{
+		public:
+
+			inline static constexpr size_t DEFAULTBLOCKSIZE = 64 * 1024;
+
+			// Blocks start on a cache line , the largest alignment Allocate supports
+			inline static constexpr size_t BLOCKALIGNMENT = 64;
+
+			explicit LinearArena(size_t blockSize = DEFAULTBLOCKSIZE);
+			~LinearArena();
+
+			NONCOPYABLE(LinearArena)
+
+			/// <summary>
+			/// size bytes aligned to alignment (a power of two up to BLOCKALIGNMENT) , valid until the next Reset
+			/// </summary>
+			void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+			template <typename T>
+			T* Allocate(size_t count = 1) { return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))); }
+
+			/// <summary>
+			/// Hands every allocation back at once , the blocks are kept for reuse
+			/// </summary>
+			void Reset();
+
+			// Bytes allocated since the last Reset (padding not counted)
+			size_t GetUsedSize() const { return m_usedSize; }
+
+			// Bytes held in blocks
+			size_t GetCapacity() const;
+
+		private:
+
+			struct Block
+			{
+				uint8_t* data = nullptr;
+				size_t size = 0;
+			};
+
+			std::vector<Block> m_blocks;
+			size_t m_blockSize = DEFAULTBLOCKSIZE;
+
+			// Block allocations currently come from and the bump offset inside it
+			size_t m_blockIndex = 0;
+			size_t m_offset = 0;
+
+			size_t m_usedSize = 0;
+		};
+	}
+}
+
+#endif // !LINEARARENA_H
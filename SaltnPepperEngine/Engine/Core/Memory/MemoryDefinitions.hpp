@@ -1,6 +1,8 @@
 #ifndef MEMORYDEFINITIONS_H
 #define MEMORYDEFINITIONS_H
+#include <cstddef>
 #include <memory>
+#include <new>
 
 namespace SaltnPepperEngine
 {
@@ -30,6 +32,32 @@ namespace SaltnPepperEngine
 			return std::make_shared<T>(std::forward<Args>(args)...);
 		}
 
+		// Standard allocator handing out Alignment aligned storage , for containers whose data gets streamed by SIMD kernels
+		template<typename T, size_t Alignment>
+		struct AlignedAllocator
+		{
+			static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment has to be a power of two no smaller than the type's");
+
+			using value_type = T;
+
+			template<typename Other>
+			struct rebind { using other = AlignedAllocator<Other, Alignment>; };
+
+			AlignedAllocator() = default;
+
+			template<typename Other>
+			AlignedAllocator(const AlignedAllocator<Other, Alignment>&) {}
+
+			T* allocate(size_t count) { return static_cast<T*>(operator new(count * sizeof(T), std::align_val_t(Alignment))); }
+			void deallocate(T* data, size_t) { operator delete(data, std::align_val_t(Alignment)); }
+
+			template<typename Other>
+			bool operator==(const AlignedAllocator<Other, Alignment>&) const { return true; }
+
+			template<typename Other>
+			bool operator!=(const AlignedAllocator<Other, Alignment>&) const { return false; }
+		};
+
 	}
 }
 
@@ -0,0 +1,370 @@
+#ifndef REFLECTION_H
+#define REFLECTION_H
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace SaltnPepperEngine
+{
+	namespace Reflection
+	{
+		/// <summary>
+		/// What a field holds , for the inspector and anything else that has to pick a widget / encoding per field
+		/// </summary>
+		enum class FIELDTYPE : uint8_t
+		{
+			UNKNOWN,
+			BOOL,
+			INT8,
+			UINT8,
+			INT16,
+			UINT16,
+			INT32,
+			UINT32,
+			INT64,
+			UINT64,
+			FLOAT,
+			DOUBLE,
+			VECTOR2,
+			VECTOR3,
+			VECTOR4,
+			QUATERNION,
+			MATRIX
+		};
+
+		/// <summary>
+		/// One reflected field. Built at compile time by SNP_FIELD , so the tables below are constexpr data
+		/// </summary>
+		struct FieldInfo
+		{
+			const char* name = nullptr;
+			uint32_t offset = 0;
+			uint32_t size = 0;
+			FIELDTYPE type = FIELDTYPE::UNKNOWN;
+
+			// Trivially copyable : copies and compares as raw bytes , the functions below stay null
+			bool trivial = false;
+
+			// Copy assigns one value
+			void (*copy)(void* destination, const void* source) = nullptr;
+			bool (*equal)(const void* first, const void* second) = nullptr;
+		};
+
+		/// <summary>
+		/// Field list of a type , specialized next to the type with a FIELDS array of SNP_FIELD entries.
+		/// Only what's listed gets copied / serialized / diffed , list the fields in declaration order so neighbours collapse
+		/// </summary>
+		template <typename T>
+		struct TypeInfo;
+
+		template <typename T, typename = void>
+		struct IsReflected : std::false_type {};
+
+		template <typename T>
+		struct IsReflected<T, std::void_t<decltype(TypeInfo<T>::FIELDS)>> : std::true_type {};
+
+		template <typename T>
+		constexpr FIELDTYPE GetFieldType()
+		{
+			if constexpr (std::is_same_v<T, bool>) { return FIELDTYPE::BOOL; }
+			else if constexpr (std::is_same_v<T, int8_t>) { return FIELDTYPE::INT8; }
+			else if constexpr (std::is_same_v<T, uint8_t>) { return FIELDTYPE::UINT8; }
+			else if constexpr (std::is_same_v<T, int16_t>) { return FIELDTYPE::INT16; }
+			else if constexpr (std::is_same_v<T, uint16_t>) { return FIELDTYPE::UINT16; }
+			else if constexpr (std::is_same_v<T, int32_t>) { return FIELDTYPE::INT32; }
+			else if constexpr (std::is_same_v<T, uint32_t>) { return FIELDTYPE::UINT32; }
+			else if constexpr (std::is_same_v<T, int64_t>) { return FIELDTYPE::INT64; }
+			else if constexpr (std::is_same_v<T, uint64_t>) { return FIELDTYPE::UINT64; }
+			else if constexpr (std::is_same_v<T, float>) { return FIELDTYPE::FLOAT; }
+			else if constexpr (std::is_same_v<T, double>) { return FIELDTYPE::DOUBLE; }
+			else if constexpr (std::is_same_v<T, Vector2>) { return FIELDTYPE::VECTOR2; }
+			else if constexpr (std::is_same_v<T, Vector3>) { return FIELDTYPE::VECTOR3; }
+			else if constexpr (std::is_same_v<T, Vector4>) { return FIELDTYPE::VECTOR4; }
+			else if constexpr (std::is_same_v<T, Quaternion>) { return FIELDTYPE::QUATERNION; }
+			else if constexpr (std::is_same_v<T, Matrix>) { return FIELDTYPE::MATRIX; }
+			else if constexpr (std::is_enum_v<T>) { return GetFieldType<std::underlying_type_t<T>>(); }
+			else { return FIELDTYPE::UNKNOWN; }
+		}
+
+		template <typename T>
+		constexpr FieldInfo MakeField(const char* name, size_t offset)
+		{
+			FieldInfo field;
+			field.name = name;
+			field.offset = static_cast<uint32_t>(offset);
+			field.size = static_cast<uint32_t>(sizeof(T));
+			field.type = GetFieldType<T>();
+			field.trivial = std::is_trivially_copyable_v<T>;
+
+			if constexpr (!std::is_trivially_copyable_v<T>)
+			{
+				field.copy = [](void* destination, const void* source) { *static_cast<T*>(destination) = *static_cast<const T*>(source); };
+				field.equal = [](const void* first, const void* second) { return *static_cast<const T*>(first) == *static_cast<const T*>(second); };
+			}
+
+			return field;
+		}
+
+		/// <summary>
+		/// Neighbouring fields merged into one copy. Trivial runs are a single memcpy , a non trivial field is a run of its own.
+		/// packedOffset is where the run starts in the serialized stream (the listed fields back to back , no padding)
+		/// </summary>
+		struct FieldRun
+		{
+			uint32_t offset = 0;
+			uint32_t packedOffset = 0;
+			uint32_t size = 0;
+			uint32_t firstField = 0;
+			bool trivial = false;
+		};
+
+		namespace Detail
+		{
+			inline constexpr bool Extends(const FieldRun& run, const FieldInfo& field)
+			{
+				return run.trivial && field.trivial && run.offset + run.size == field.offset;
+			}
+
+			template <size_t COUNT>
+			constexpr size_t CountRuns(const FieldInfo (&fields)[COUNT])
+			{
+				size_t runCount = 0;
+				FieldRun run;
+				for (size_t index = 0; index < COUNT; ++index)
+				{
+					if (runCount != 0 && Extends(run, fields[index])) { run.size += fields[index].size; continue; }
+
+					run = FieldRun{ fields[index].offset, 0, fields[index].size, 0, fields[index].trivial };
+					++runCount;
+				}
+				return runCount;
+			}
+
+			template <size_t RUNCOUNT, size_t COUNT>
+			constexpr std::array<FieldRun, RUNCOUNT> BuildRuns(const FieldInfo (&fields)[COUNT])
+			{
+				std::array<FieldRun, RUNCOUNT> runs{};
+				size_t runCount = 0;
+				uint32_t packedOffset = 0;
+				for (size_t index = 0; index < COUNT; ++index)
+				{
+					const FieldInfo& field = fields[index];
+					if (runCount != 0 && Extends(runs[runCount - 1], field)) { runs[runCount - 1].size += field.size; }
+					else { runs[runCount++] = FieldRun{ field.offset, packedOffset, field.size, static_cast<uint32_t>(index), field.trivial }; }
+
+					packedOffset += field.size;
+				}
+				return runs;
+			}
+
+			template <size_t COUNT>
+			constexpr uint32_t SumSizes(const FieldInfo (&fields)[COUNT])
+			{
+				uint32_t size = 0;
+				for (size_t index = 0; index < COUNT; ++index) { size += fields[index].size; }
+				return size;
+			}
+
+			template <size_t COUNT>
+			constexpr bool AllTrivial(const FieldInfo (&fields)[COUNT])
+			{
+				for (size_t index = 0; index < COUNT; ++index)
+				{
+					if (!fields[index].trivial) { return false; }
+				}
+				return true;
+			}
+		}
+
+		/// <summary>
+		/// Everything derived from a type's field list , all of it constexpr
+		/// </summary>
+		template <typename T>
+		struct Layout
+		{
+			static_assert(IsReflected<T>::value, "Specialize Reflection::TypeInfo for the type first");
+
+			inline static constexpr size_t FIELDCOUNT = std::size(TypeInfo<T>::FIELDS);
+			inline static constexpr size_t RUNCOUNT = Detail::CountRuns(TypeInfo<T>::FIELDS);
+			inline static constexpr std::array<FieldRun, RUNCOUNT> RUNS = Detail::BuildRuns<RUNCOUNT>(TypeInfo<T>::FIELDS);
+
+			// Bytes WriteFields produces
+			inline static constexpr uint32_t PACKEDSIZE = Detail::SumSizes(TypeInfo<T>::FIELDS);
+
+			// Every field trivially copyable , required by the byte stream functions
+			inline static constexpr bool TRIVIAL = Detail::AllTrivial(TypeInfo<T>::FIELDS);
+		};
+
+		/// <summary>
+		/// The field called name , nullptr if the type doesn't list one
+		/// </summary>
+		template <typename T>
+		const FieldInfo* FindField(const char* name)
+		{
+			for (const FieldInfo& field : TypeInfo<T>::FIELDS)
+			{
+				if (std::strcmp(field.name, name) == 0) { return &field; }
+			}
+			return nullptr;
+		}
+
+
+		// ================ GENERATED COPY CODE ======================
+		// Unrolled per run at compile time : a type whose fields sit back to back copies with one fixed size memcpy
+
+		namespace Detail
+		{
+			template <typename T, size_t RUN>
+			inline void CopyRun(uint8_t* destination, const uint8_t* source)
+			{
+				constexpr FieldRun run = Layout<T>::RUNS[RUN];
+				if constexpr (run.trivial) { std::memcpy(destination + run.offset, source + run.offset, run.size); }
+				else { TypeInfo<T>::FIELDS[run.firstField].copy(destination + run.offset, source + run.offset); }
+			}
+
+			template <typename T, size_t... RUNS>
+			inline void CopyRuns(uint8_t* destination, const uint8_t* source, std::index_sequence<RUNS...>)
+			{
+				(CopyRun<T, RUNS>(destination, source), ...);
+			}
+
+			template <typename T, size_t RUN>
+			inline void WriteRun(const uint8_t* source, uint8_t* output)
+			{
+				constexpr FieldRun run = Layout<T>::RUNS[RUN];
+				std::memcpy(output + run.packedOffset, source + run.offset, run.size);
+			}
+
+			template <typename T, size_t... RUNS>
+			inline void WriteRuns(const uint8_t* source, uint8_t* output, std::index_sequence<RUNS...>)
+			{
+				(WriteRun<T, RUNS>(source, output), ...);
+			}
+
+			template <typename T, size_t RUN>
+			inline void ReadRun(uint8_t* destination, const uint8_t* input)
+			{
+				constexpr FieldRun run = Layout<T>::RUNS[RUN];
+				std::memcpy(destination + run.offset, input + run.packedOffset, run.size);
+			}
+
+			template <typename T, size_t... RUNS>
+			inline void ReadRuns(uint8_t* destination, const uint8_t* input, std::index_sequence<RUNS...>)
+			{
+				(ReadRun<T, RUNS>(destination, input), ...);
+			}
+
+			template <typename T, size_t FIELD>
+			inline uint64_t DiffField(const uint8_t* first, const uint8_t* second)
+			{
+				constexpr FieldInfo field = TypeInfo<T>::FIELDS[FIELD];
+				bool equal = false;
+				if constexpr (field.trivial) { equal = std::memcmp(first + field.offset, second + field.offset, field.size) == 0; }
+				else { equal = TypeInfo<T>::FIELDS[FIELD].equal(first + field.offset, second + field.offset); }
+
+				return equal ? 0 : uint64_t(1) << FIELD;
+			}
+
+			template <typename T, size_t... FIELDS>
+			inline uint64_t DiffFields(const uint8_t* first, const uint8_t* second, std::index_sequence<FIELDS...>)
+			{
+				return (DiffField<T, FIELDS>(first, second) | ...);
+			}
+		}
+
+		/// <summary>
+		/// Copies the listed fields of source over destination , the rest of destination is left alone
+		/// </summary>
+		template <typename T>
+		inline void CopyFields(T& destination, const T& source)
+		{
+			Detail::CopyRuns<T>(reinterpret_cast<uint8_t*>(&destination), reinterpret_cast<const uint8_t*>(&source), std::make_index_sequence<Layout<T>::RUNCOUNT>{});
+		}
+
+		/// <summary>
+		/// Writes the listed fields back to back into output (Layout<T>::PACKEDSIZE bytes , native byte order)
+		/// </summary>
+		template <typename T>
+		inline void WriteFields(const T& value, uint8_t* output)
+		{
+			static_assert(Layout<T>::TRIVIAL, "Only types whose listed fields are all trivially copyable serialize as bytes");
+			Detail::WriteRuns<T>(reinterpret_cast<const uint8_t*>(&value), output, std::make_index_sequence<Layout<T>::RUNCOUNT>{});
+		}
+
+		/// <summary>
+		/// Reads what WriteFields wrote into the listed fields of value
+		/// </summary>
+		template <typename T>
+		inline void ReadFields(T& value, const uint8_t* input)
+		{
+			static_assert(Layout<T>::TRIVIAL, "Only types whose listed fields are all trivially copyable serialize as bytes");
+			Detail::ReadRuns<T>(reinterpret_cast<uint8_t*>(&value), input, std::make_index_sequence<Layout<T>::RUNCOUNT>{});
+		}
+
+		/// <summary>
+		/// Bit per listed field (in list order) that differs between the two. Trivial fields compare as bytes ,
+		/// so -0 against 0 counts as a change and a NaN against itself doesn't
+		/// </summary>
+		template <typename T>
+		inline uint64_t DiffFields(const T& first, const T& second)
+		{
+			static_assert(Layout<T>::FIELDCOUNT <= 64, "Diff masks hold 64 fields");
+			return Detail::DiffFields<T>(reinterpret_cast<const uint8_t*>(&first), reinterpret_cast<const uint8_t*>(&second), std::make_index_sequence<Layout<T>::FIELDCOUNT>{});
+		}
+
+		/// <summary>
+		/// Writes only the fields in mask (a DiffFields result) back to back , returns the bytes written. The delta a replication
+		/// packet carries next to its mask
+		/// </summary>
+		template <typename T>
+		inline uint32_t WriteChangedFields(const T& value, uint64_t mask, uint8_t* output)
+		{
+			static_assert(Layout<T>::TRIVIAL, "Only types whose listed fields are all trivially copyable serialize as bytes");
+
+			const uint8_t* source = reinterpret_cast<const uint8_t*>(&value);
+			uint32_t written = 0;
+			for (size_t index = 0; index < Layout<T>::FIELDCOUNT; ++index)
+			{
+				if ((mask & (uint64_t(1) << index)) == 0) { continue; }
+
+				const FieldInfo& field = TypeInfo<T>::FIELDS[index];
+				std::memcpy(output + written, source + field.offset, field.size);
+				written += field.size;
+			}
+			return written;
+		}
+
+		/// <summary>
+		/// Applies what WriteChangedFields wrote with the same mask , returns the bytes read
+		/// </summary>
+		template <typename T>
+		inline uint32_t ReadChangedFields(T& value, uint64_t mask, const uint8_t* input)
+		{
+			static_assert(Layout<T>::TRIVIAL, "Only types whose listed fields are all trivially copyable serialize as bytes");
+
+			uint8_t* destination = reinterpret_cast<uint8_t*>(&value);
+			uint32_t read = 0;
+			for (size_t index = 0; index < Layout<T>::FIELDCOUNT; ++index)
+			{
+				if ((mask & (uint64_t(1) << index)) == 0) { continue; }
+
+				const FieldInfo& field = TypeInfo<T>::FIELDS[index];
+				std::memcpy(destination + field.offset, input + read, field.size);
+				read += field.size;
+			}
+			return read;
+		}
+	}
+}
+
+/// <summary>
+/// A FieldInfo entry for TypeInfo<Type>::FIELDS. The type has to be standard layout (offsetof)
+/// </summary>
+#define SNP_FIELD(Type, member) ::SaltnPepperEngine::Reflection::MakeField<decltype(Type::member)>(#member, offsetof(Type, member))
+
+#endif // !REFLECTION_H
@@ -0,0 +1,307 @@
+#include "SceneFile.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace SaltnPepperEngine
+{
+	namespace Scene
+	{
+		namespace
+		{
+			// What the view asks of the image it's given , enough for every built in column
+			inline static constexpr size_t IMAGEALIGNMENT = 16;
+
+			inline constexpr uint64_t AlignOffset(uint64_t offset)
+			{
+				return (offset + COLUMNALIGNMENT - 1) & ~static_cast<uint64_t>(COLUMNALIGNMENT - 1);
+			}
+
+			/// <summary>
+			/// Element size the built in columns must have in this build , 0 for columns the engine doesn't know
+			/// </summary>
+			uint32_t GetNativeElementSize(uint32_t id)
+			{
+				switch (id)
+				{
+				case LOCALPOSITIONS: return sizeof(Vector3);
+				case LOCALROTATIONS: return sizeof(Quaternion);
+				case LOCALSCALES: return sizeof(Vector3);
+				case WORLDMATRICES: return sizeof(Components::Transform::WorldMatrix);
+				case PARENTS: return sizeof(uint32_t);
+				case NODEFLAGS: return sizeof(uint8_t);
+				case TRANSFORMS: return sizeof(Components::Transform);
+				default: return 0;
+				}
+			}
+		}
+
+
+		// ================ SCENE VIEW ======================
+
+		bool SceneView::Open(const uint8_t* data, size_t size)
+		{
+			m_data = nullptr;
+			m_size = 0;
+
+			if (data == nullptr || size < sizeof(SceneHeader) || reinterpret_cast<uintptr_t>(data) % IMAGEALIGNMENT != 0)
+			{
+				LOG_ERROR("Scene : image too small or misaligned");
+				return false;
+			}
+
+			const SceneHeader& header = *reinterpret_cast<const SceneHeader*>(data);
+			if (header.magic != SCENEMAGIC)
+			{
+				LOG_ERROR("Scene : not a scene file");
+				return false;
+			}
+
+			if (header.version != SCENEVERSION || header.headerSize != sizeof(SceneHeader))
+			{
+				LOG_ERROR("Scene : format version {0} , this build reads version {1}", header.version, SCENEVERSION);
+				return false;
+			}
+
+			if (header.flags != NATIVESCENEFLAGS)
+			{
+				LOG_ERROR("Scene : saved with world matrix layout flags {0} , this build uses {1}", header.flags, NATIVESCENEFLAGS);
+				return false;
+			}
+
+			const uint64_t tableSize = static_cast<uint64_t>(header.columnCount) * sizeof(SceneColumnEntry);
+			if (header.fileSize > size || header.columnTableOffset % alignof(SceneColumnEntry) != 0 ||
+				header.columnTableOffset < sizeof(SceneHeader) || header.columnTableOffset > header.fileSize ||
+				tableSize > header.fileSize - header.columnTableOffset)
+			{
+				LOG_ERROR("Scene : truncated , {0} of {1} bytes", size, header.fileSize);
+				return false;
+			}
+
+			// Every column inside the file , aligned and in the size this build expects for the built in ones
+			const SceneColumnEntry* columns = reinterpret_cast<const SceneColumnEntry*>(data + header.columnTableOffset);
+			for (uint32_t index = 0; index < header.columnCount; ++index)
+			{
+				const SceneColumnEntry& column = columns[index];
+				const uint32_t nativeSize = GetNativeElementSize(column.id);
+
+				const bool fits = column.elementSize != 0 && column.count <= (header.fileSize - std::min(column.offset, header.fileSize)) / column.elementSize;
+				if (!fits || column.offset % COLUMNALIGNMENT != 0 || (nativeSize != 0 && nativeSize != column.elementSize))
+				{
+					LOG_ERROR("Scene : column {0} is corrupt", column.id);
+					return false;
+				}
+			}
+
+			m_data = data;
+			m_size = static_cast<size_t>(header.fileSize);
+			return true;
+		}
+
+		const SceneColumnEntry* SceneView::FindColumn(uint32_t id) const
+		{
+			if (!IsOpen()) { return nullptr; }
+
+			const SceneHeader& header = GetHeader();
+			const SceneColumnEntry* columns = reinterpret_cast<const SceneColumnEntry*>(m_data + header.columnTableOffset);
+
+			// A handful of columns , a scan beats anything fancier
+			for (uint32_t index = 0; index < header.columnCount; ++index)
+			{
+				if (columns[index].id == id) { return columns + index; }
+			}
+
+			return nullptr;
+		}
+
+		const void* SceneView::GetColumnData(uint32_t id, size_t elementSize, uint64_t& outCount) const
+		{
+			outCount = 0;
+
+			const SceneColumnEntry* column = FindColumn(id);
+			if (column == nullptr || column->elementSize != elementSize) { return nullptr; }
+
+			outCount = column->count;
+			return m_data + column->offset;
+		}
+
+		bool SceneView::GetHierarchy(Components::TransformSlotArrays& outArrays) const
+		{
+			outArrays = Components::TransformSlotArrays{};
+			if (!IsOpen()) { return false; }
+
+			const SceneHeader& header = GetHeader();
+			const uint64_t nodeCount = header.nodeCount;
+
+			uint64_t counts[6] = {};
+			outArrays.localPositions = GetColumn<Vector3>(LOCALPOSITIONS, counts[0]);
+			outArrays.localRotations = GetColumn<Quaternion>(LOCALROTATIONS, counts[1]);
+			outArrays.localScales = GetColumn<Vector3>(LOCALSCALES, counts[2]);
+			outArrays.worldMatrices = GetColumn<Components::Transform::WorldMatrix>(WORLDMATRICES, counts[3]);
+			outArrays.parents = GetColumn<uint32_t>(PARENTS, counts[4]);
+			outArrays.flags = GetColumn<uint8_t>(NODEFLAGS, counts[5]);
+			outArrays.count = header.nodeCount;
+			outArrays.frozenCount = header.frozenCount;
+
+			// The world matrices are optional , Assign rebuilds them when they are missing
+			if (counts[3] != nodeCount) { outArrays.worldMatrices = nullptr; }
+
+			return nodeCount > 0 && counts[0] == nodeCount && counts[1] == nodeCount && counts[2] == nodeCount && counts[4] == nodeCount && counts[5] == nodeCount;
+		}
+
+
+		// ================ SCENE FILE ======================
+
+		bool SceneFile::Open(const std::string& path)
+		{
+			Close();
+
+			if (!m_file.Open(path))
+			{
+				LOG_ERROR("Scene : could not map {0}", path);
+				return false;
+			}
+
+			if (!m_view.Open(m_file.GetData(), m_file.GetSize()))
+			{
+				LOG_ERROR("Scene : {0} can't be loaded", path);
+				m_file.Close();
+				return false;
+			}
+
+			return true;
+		}
+
+		void SceneFile::Close()
+		{
+			m_view = SceneView{};
+			m_file.Close();
+		}
+
+
+		// ================ SCENE WRITER ======================
+
+		void SceneWriter::AddColumn(uint32_t id, const void* data, uint32_t elementSize, uint64_t count)
+		{
+			auto existing = std::find_if(m_columns.begin(), m_columns.end(), [id](const Column& column) { return column.entry.id == id; });
+			Column& column = existing != m_columns.end() ? *existing : m_columns.emplace_back();
+
+			column.entry = SceneColumnEntry{ id, elementSize, count, 0 };
+
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			column.data.assign(bytes, bytes + elementSize * count);
+		}
+
+		bool SceneWriter::AddHierarchy(const Components::TransformHierarchy& hierarchy)
+		{
+			// Only a compacted hierarchy has the depth order and frozen prefix the file promises
+			if (hierarchy.NeedsCompact())
+			{
+				LOG_WARN("Scene : hierarchy needs a Compact before it can be saved");
+				return false;
+			}
+
+			const uint64_t count = hierarchy.GetCount();
+
+			AddColumn(LOCALPOSITIONS, hierarchy.GetLocalPositions(), sizeof(Vector3), count);
+			AddColumn(LOCALROTATIONS, hierarchy.GetLocalRotations(), sizeof(Quaternion), count);
+			AddColumn(LOCALSCALES, hierarchy.GetLocalScales(), sizeof(Vector3), count);
+			AddColumn(WORLDMATRICES, hierarchy.GetWorldMatrices(), sizeof(Components::Transform::WorldMatrix), count);
+			AddColumn(PARENTS, hierarchy.GetParentSlots(), sizeof(uint32_t), count);
+			AddColumn(NODEFLAGS, hierarchy.GetFlags(), sizeof(uint8_t), count);
+
+			m_nodeCount = static_cast<uint32_t>(count);
+			m_frozenCount = hierarchy.GetFrozenCount();
+			return true;
+		}
+
+		void SceneWriter::AddTransforms(const Components::Transform* transforms, size_t count)
+		{
+			static_assert(std::is_trivially_copyable_v<Components::Transform>, "Transform columns are saved and mapped as raw bytes");
+
+			AddColumn(TRANSFORMS, transforms, sizeof(Components::Transform), count);
+		}
+
+		void SceneWriter::Write(std::vector<uint8_t>& output) const
+		{
+			const uint32_t columnCount = static_cast<uint32_t>(m_columns.size());
+
+			SceneHeader header;
+			header.magic = SCENEMAGIC;
+			header.version = SCENEVERSION;
+			header.headerSize = sizeof(SceneHeader);
+			header.flags = NATIVESCENEFLAGS;
+			header.columnCount = columnCount;
+			header.columnTableOffset = sizeof(SceneHeader);
+			header.nodeCount = m_nodeCount;
+			header.frozenCount = m_frozenCount;
+
+			// Offsets get fixed here , once the table size is known
+			std::vector<SceneColumnEntry> table(columnCount);
+			uint64_t offset = AlignOffset(header.columnTableOffset + columnCount * sizeof(SceneColumnEntry));
+			for (uint32_t index = 0; index < columnCount; ++index)
+			{
+				table[index] = m_columns[index].entry;
+				table[index].offset = offset;
+				offset = AlignOffset(offset + m_columns[index].data.size());
+			}
+			header.fileSize = offset;
+
+			// Zero filled , the padding between columns stays deterministic
+			output.assign(static_cast<size_t>(header.fileSize), 0);
+			std::memcpy(output.data(), &header, sizeof(SceneHeader));
+			if (columnCount > 0) { std::memcpy(output.data() + header.columnTableOffset, table.data(), columnCount * sizeof(SceneColumnEntry)); }
+
+			for (uint32_t index = 0; index < columnCount; ++index)
+			{
+				const std::vector<uint8_t>& data = m_columns[index].data;
+				if (!data.empty()) { std::memcpy(output.data() + table[index].offset, data.data(), data.size()); }
+			}
+		}
+
+		bool SceneWriter::Save(const std::string& path) const
+		{
+			std::vector<uint8_t> image;
+			Write(image);
+
+			std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+			if (!file.is_open())
+			{
+				LOG_ERROR("Scene : could not open {0} for writing", path);
+				return false;
+			}
+
+			file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+			return file.good();
+		}
+
+		void SceneWriter::Clear()
+		{
+			m_columns.clear();
+			m_nodeCount = 0;
+			m_frozenCount = 0;
+		}
+
+
+		bool LoadHierarchy(const SceneView& view, Components::TransformHierarchy& hierarchy)
+		{
+			Components::TransformSlotArrays arrays;
+			if (!view.GetHierarchy(arrays))
+			{
+				hierarchy.Clear();
+				return false;
+			}
+
+			if (!hierarchy.Assign(arrays))
+			{
+				LOG_ERROR("Scene : hierarchy isn't in parent before child order");
+				return false;
+			}
+
+			return true;
+		}
+	}
+}
@@ -0,0 +1,236 @@
+#ifndef SCENEFILE_H
+#define SCENEFILE_H
+#include "Core/EngineDefines.hpp"
+#include "Core/Components/Transform.hpp"
+#include "Core/Components/TransformHierarchy.hpp"
+#include "Core/System/MappedFile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Scene
+	{
+		// ================ FILE LAYOUT ======================
+		// [SceneHeader] [SceneColumnEntry x columnCount] [column data ...]
+		// Every column is one array in exactly the layout the runtime keeps it in , starting on a COLUMNALIGNMENT boundary.
+		// Nothing in the file is a pointer : columns are found through byte offsets from the start of the file and parents
+		// through slot indices , so a mapped file is usable where it lands. Little endian , like every platform the engine targets
+
+		enum SCENECOLUMN : uint32_t
+		{
+			// TransformHierarchy slot arrays , node count entries each in slot order
+			LOCALPOSITIONS = 1,
+			LOCALROTATIONS,
+			LOCALSCALES,
+			WORLDMATRICES,
+			PARENTS,
+			NODEFLAGS,
+
+			// Standalone Components::Transform array
+			TRANSFORMS,
+
+			// Ids from here on are free for game specific columns
+			FIRSTUSERCOLUMN = 1024
+		};
+
+		enum SCENEFLAGS : uint32_t
+		{
+			NONE = 0,
+			// World matrices are stored in the 3x4 affine layout (SNP_AFFINE_WORLDMATRIX) , files only load into a build with the same layout
+			AFFINEWORLDMATRIX = 1 << 0
+		};
+
+		struct SceneHeader
+		{
+			uint32_t magic = 0;
+			uint16_t version = 0;
+			uint16_t headerSize = 0;
+			uint32_t flags = NONE;
+			uint32_t columnCount = 0;
+			uint64_t fileSize = 0;
+			uint64_t columnTableOffset = 0;
+
+			// Hierarchy node count and length of its frozen prefix
+			uint32_t nodeCount = 0;
+			uint32_t frozenCount = 0;
+
+			uint8_t reserved[24] = {};
+		};
+
+		struct SceneColumnEntry
+		{
+			uint32_t id = 0;
+			uint32_t elementSize = 0;
+			uint64_t count = 0;
+
+			// Bytes from the start of the file
+			uint64_t offset = 0;
+		};
+
+		static_assert(sizeof(SceneHeader) == 64, "SceneHeader is part of the file format");
+		static_assert(sizeof(SceneColumnEntry) == 24, "SceneColumnEntry is part of the file format");
+
+		// 'SNPS'
+		inline static constexpr uint32_t SCENEMAGIC = 0x53504E53;
+
+		// Bump on any change to the layout of the header , the column table or a built in column
+		inline static constexpr uint16_t SCENEVERSION = 1;
+
+		// Column data starts on cache line boundaries , enough for any SIMD load the runtime does on it
+		inline static constexpr size_t COLUMNALIGNMENT = 64;
+
+		// Flags a file written by this build carries (the ones that have to match on load)
+		inline static constexpr uint32_t NATIVESCENEFLAGS =
+#ifdef SNP_AFFINE_WORLDMATRIX
+			AFFINEWORLDMATRIX;
+#else
+			NONE;
+#endif
+
+
+		// ================ SCENE VIEW ======================
+
+		/// <summary>
+		/// Read only view over a scene image in memory (a mapped file or a buffer). Open checks the header and that every
+		/// column lies inside the image , after that columns are handed out as plain pointers into it , nothing is copied.
+		/// The image has to outlive the view and start on a 16 byte boundary
+		/// </summary>
+		class SNP_API SceneView
+		{
+		public:
+
+			SceneView() = default;
+
+			/// <summary>
+			/// Validates the image , logs why and returns false if it isn't a scene this build can use
+			/// </summary>
+			bool Open(const uint8_t* data, size_t size);
+
+			bool IsOpen() const { return m_data != nullptr; }
+
+			const SceneHeader& GetHeader() const { return *reinterpret_cast<const SceneHeader*>(m_data); }
+
+			uint32_t GetColumnCount() const { return IsOpen() ? GetHeader().columnCount : 0; }
+
+			/// <summary>
+			/// The column table entry for id , nullptr if the scene has no such column
+			/// </summary>
+			const SceneColumnEntry* FindColumn(uint32_t id) const;
+
+			/// <summary>
+			/// Pointer to the column's first element , nullptr if the column is missing or its elements aren't elementSize bytes
+			/// </summary>
+			const void* GetColumnData(uint32_t id, size_t elementSize, uint64_t& outCount) const;
+
+			template <typename T>
+			const T* GetColumn(uint32_t id, uint64_t& outCount) const { return static_cast<const T*>(GetColumnData(id, sizeof(T), outCount)); }
+
+			/// <summary>
+			/// The hierarchy slot arrays as pointers into the image , false when the scene doesn't hold a complete hierarchy
+			/// </summary>
+			bool GetHierarchy(Components::TransformSlotArrays& outArrays) const;
+
+		private:
+
+			const uint8_t* m_data = nullptr;
+			size_t m_size = 0;
+		};
+
+
+		// ================ SCENE FILE ======================
+
+		/// <summary>
+		/// A scene file mapped into memory plus its view. Loading costs the mapping and the header checks ,
+		/// column pages come in from disk as they are first touched
+		/// </summary>
+		class SNP_API SceneFile
+		{
+		public:
+
+			SceneFile() = default;
+
+			NONCOPYABLE(SceneFile)
+
+			bool Open(const std::string& path);
+			void Close();
+
+			bool IsOpen() const { return m_view.IsOpen(); }
+
+			const SceneView& GetView() const { return m_view; }
+
+		private:
+
+			Platform::MappedFile m_file;
+			SceneView m_view;
+		};
+
+
+		// ================ SCENE WRITER ======================
+
+		/// <summary>
+		/// Builds a scene image column by column (tools side). Columns are copied in when added ,
+		/// Write lays them out behind the header with their final offsets
+		/// </summary>
+		class SNP_API SceneWriter
+		{
+		public:
+
+			SceneWriter() = default;
+
+			/// <summary>
+			/// Adds a column of count elements of elementSize bytes. A column with the same id gets replaced
+			/// </summary>
+			void AddColumn(uint32_t id, const void* data, uint32_t elementSize, uint64_t count);
+
+			/// <summary>
+			/// Adds the slot arrays of hierarchy , which has to be compacted (!NeedsCompact()). World matrices are saved as of its last Update
+			/// </summary>
+			bool AddHierarchy(const Components::TransformHierarchy& hierarchy);
+
+			/// <summary>
+			/// Node count and frozen prefix length for hierarchy columns added one by one with AddColumn (a tool laying out the slot arrays itself).
+			/// The WORLDMATRICES column can be left out , LoadHierarchy then has them rebuilt by the next Update
+			/// </summary>
+			void SetHierarchy(uint32_t nodeCount, uint32_t frozenCount)
+			{
+				m_nodeCount = nodeCount;
+				m_frozenCount = frozenCount;
+			}
+
+			void AddTransforms(const Components::Transform* transforms, size_t count);
+
+			/// <summary>
+			/// The finished image , ready for SceneView::Open or to go to disk as is
+			/// </summary>
+			void Write(std::vector<uint8_t>& output) const;
+
+			bool Save(const std::string& path) const;
+
+			void Clear();
+
+		private:
+
+			struct Column
+			{
+				SceneColumnEntry entry;
+				std::vector<uint8_t> data;
+			};
+
+			std::vector<Column> m_columns;
+
+			uint32_t m_nodeCount = 0;
+			uint32_t m_frozenCount = 0;
+		};
+
+
+		/// <summary>
+		/// Loads the scene's hierarchy into hierarchy (see TransformHierarchy::Assign) , false if it has none or it doesn't check out
+		/// </summary>
+		SNP_API bool LoadHierarchy(const SceneView& view, Components::TransformHierarchy& hierarchy);
+	}
+}
+
+#endif // !SCENEFILE_H
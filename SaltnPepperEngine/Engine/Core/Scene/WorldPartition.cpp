@@ -0,0 +1,411 @@
+#include "WorldPartition.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+
+namespace SaltnPepperEngine
+{
+	namespace Scene
+	{
+		namespace
+		{
+			// Bytes between the loads that fault the mapped pages in
+			inline static constexpr size_t PAGESIZE = 4096;
+		}
+
+		WorldPartition::WorldPartition(ECS::World& world, const WorldPartitionSettings& settings)
+			: m_world(world)
+			, m_settings(settings)
+			, m_loadFunction(&WorldPartition::LoadSceneCell)
+		{
+			m_thread = std::thread(&WorldPartition::StreamingLoop, this);
+		}
+
+		WorldPartition::~WorldPartition()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
+
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+		void WorldPartition::AddCell(CellCoord cell, const std::string& path, uint64_t size)
+		{
+			if (m_cellLookup.find(GetKey(cell)) != m_cellLookup.end())
+			{
+				LOG_WARN("World Partition : cell ({0} , {1}) added twice", cell.x, cell.z);
+				return;
+			}
+
+			if (size == 0)
+			{
+				std::error_code error;
+				size = std::filesystem::file_size(path, error);
+				if (error) { size = 0; }
+			}
+
+			m_cellLookup.emplace(GetKey(cell), static_cast<uint32_t>(m_cells.size()));
+			m_rankedIn.push_back(0);
+
+			Cell& added = m_cells.emplace_back();
+			added.coord = cell;
+			added.path = path;
+			added.size = size;
+		}
+
+		CellCoord WorldPartition::GetCellCoord(const Vector3& position) const
+		{
+			return CellCoord{ static_cast<int32_t>(std::floor(position.x / m_settings.cellSize)), static_cast<int32_t>(std::floor(position.z / m_settings.cellSize)) };
+		}
+
+		WorldPartition::CellState WorldPartition::GetCellState(CellCoord cell) const
+		{
+			auto found = m_cellLookup.find(GetKey(cell));
+			return found != m_cellLookup.end() ? m_cells[found->second].state : CellState::UNLOADED;
+		}
+
+		const std::vector<ECS::Entity>* WorldPartition::GetCellEntities(CellCoord cell) const
+		{
+			auto found = m_cellLookup.find(GetKey(cell));
+			if (found == m_cellLookup.end() || m_cells[found->second].state != CellState::RESIDENT) { return nullptr; }
+
+			return &m_cells[found->second].entities;
+		}
+
+
+		// ================ STREAMING ======================
+
+		void WorldPartition::Update(const StreamingSource* sources, size_t sourceCount)
+		{
+			++m_updateIndex;
+
+			CollectLoads();
+			RankCells(sources, sourceCount);
+			IssueLoads();
+			Merge();
+
+			m_activeCells.erase(std::remove_if(m_activeCells.begin(), m_activeCells.end(), [this](uint32_t cellIndex)
+			{
+				return m_cells[cellIndex].state == CellState::UNLOADED || m_cells[cellIndex].state == CellState::FAILED;
+			}), m_activeCells.end());
+		}
+
+		void WorldPartition::Flush(const StreamingSource* sources, size_t sourceCount)
+		{
+			for (;;)
+			{
+				Update(sources, sourceCount);
+
+				const bool busy = std::any_of(m_activeCells.begin(), m_activeCells.end(), [this](uint32_t cellIndex) { return m_cells[cellIndex].state != CellState::RESIDENT; });
+				if (!busy) { return; }
+
+				// Only waits while the streaming thread has something , merging and unloading finish on this thread
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return !m_results.empty() || m_loadingCount == 0; });
+			}
+		}
+
+		void WorldPartition::CollectLoads()
+		{
+			// Swapped , so both vectors keep their capacity
+			m_collected.clear();
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_collected.swap(m_results);
+			}
+
+			for (LoadResult& result : m_collected)
+			{
+				Cell& cell = m_cells[result.cell];
+
+				// Cancelled while in flight , its memory was given back by Unload
+				if (cell.state != CellState::LOADING || cell.ticket != result.ticket) { continue; }
+
+				--m_loadingCount;
+
+				if (!result.loaded)
+				{
+					LOG_WARN("World Partition : cell ({0} , {1}) failed to load from {2}", cell.coord.x, cell.coord.z, cell.path);
+					m_usedMemory -= cell.size;
+					cell.state = CellState::FAILED;
+					continue;
+				}
+
+				// The real size replaces the estimate from here on
+				const uint64_t size = result.content->GetSize();
+				m_usedMemory = m_usedMemory - cell.size + size;
+				cell.size = size;
+
+				cell.content = std::move(result.content);
+				cell.entities.reserve(cell.content->count);
+				cell.state = CellState::MERGING;
+			}
+		}
+
+		void WorldPartition::RankCells(const StreamingSource* sources, size_t sourceCount)
+		{
+			m_candidates.clear();
+
+			const float cellSize = m_settings.cellSize;
+			for (size_t sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex)
+			{
+				const StreamingSource& source = sources[sourceIndex];
+				const float radius = std::max(source.loadRadius, 0.001f);
+				const float reach = radius + m_settings.unloadMargin;
+
+				const CellCoord first = GetCellCoord(Vector3(source.position.x - reach, 0.0f, source.position.z - reach));
+				const CellCoord last = GetCellCoord(Vector3(source.position.x + reach, 0.0f, source.position.z + reach));
+
+				for (int32_t z = first.z; z <= last.z; ++z)
+				{
+					for (int32_t x = first.x; x <= last.x; ++x)
+					{
+						auto found = m_cellLookup.find(GetKey(CellCoord{ x, z }));
+						if (found == m_cellLookup.end()) { continue; }
+
+						// Distance from the source to the nearest point of the cell
+						const float minX = static_cast<float>(x) * cellSize;
+						const float minZ = static_cast<float>(z) * cellSize;
+						const float deltaX = std::max({ minX - source.position.x, 0.0f, source.position.x - (minX + cellSize) });
+						const float deltaZ = std::max({ minZ - source.position.z, 0.0f, source.position.z - (minZ + cellSize) });
+						const float distance = std::sqrt(deltaX * deltaX + deltaZ * deltaZ);
+						if (distance > reach) { continue; }
+
+						const uint32_t cellIndex = found->second;
+						const float priority = distance / radius;
+
+						if (m_rankedIn[cellIndex] != m_updateIndex)
+						{
+							m_rankedIn[cellIndex] = m_updateIndex;
+							m_cells[cellIndex].priority = priority;
+							m_candidates.push_back(cellIndex);
+						}
+						else { m_cells[cellIndex].priority = std::min(m_cells[cellIndex].priority, priority); }
+					}
+				}
+			}
+
+			// Out of every source's reach
+			for (uint32_t cellIndex : m_activeCells)
+			{
+				if (m_rankedIn[cellIndex] != m_updateIndex)
+				{
+					m_cells[cellIndex].priority = std::numeric_limits<float>::max();
+					Unload(cellIndex);
+				}
+			}
+
+			// What's left to load , nearest first. Cells in the margin only stay if they're loaded already
+			m_candidates.erase(std::remove_if(m_candidates.begin(), m_candidates.end(), [this](uint32_t cellIndex)
+			{
+				return m_cells[cellIndex].state != CellState::UNLOADED || m_cells[cellIndex].priority > 1.0f;
+			}), m_candidates.end());
+
+			std::sort(m_candidates.begin(), m_candidates.end(), [this](uint32_t first, uint32_t second) { return m_cells[first].priority < m_cells[second].priority; });
+		}
+
+		void WorldPartition::IssueLoads()
+		{
+			const size_t firstNew = m_activeCells.size();
+
+			for (uint32_t cellIndex : m_candidates)
+			{
+				Cell& cell = m_cells[cellIndex];
+
+				if (m_usedMemory + cell.size > m_settings.memoryBudget)
+				{
+					// Make room by dropping the farthest cell if it ranks behind this one. Its memory comes back once its
+					// entities are gone , the load waits until then
+					uint32_t farthest = UINT32_MAX;
+					for (uint32_t activeIndex : m_activeCells)
+					{
+						const Cell& active = m_cells[activeIndex];
+						if (active.state == CellState::UNLOADING || active.priority <= cell.priority) { continue; }
+						if (farthest == UINT32_MAX || active.priority > m_cells[farthest].priority) { farthest = activeIndex; }
+					}
+
+					if (farthest != UINT32_MAX) { Unload(farthest); }
+					break;
+				}
+
+				cell.state = CellState::LOADING;
+				++cell.ticket;
+				m_usedMemory += cell.size;
+				++m_loadingCount;
+				m_activeCells.push_back(cellIndex);
+			}
+
+			// Drop the cancelled requests , re-rank the rest and add the new ones
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				m_requests.erase(std::remove_if(m_requests.begin(), m_requests.end(), [this](const LoadRequest& request)
+				{
+					const Cell& cell = m_cells[request.cell];
+					return cell.state != CellState::LOADING || cell.ticket != request.ticket;
+				}), m_requests.end());
+
+				for (LoadRequest& request : m_requests) { request.priority = m_cells[request.cell].priority; }
+
+				for (size_t index = firstNew; index < m_activeCells.size(); ++index)
+				{
+					const Cell& cell = m_cells[m_activeCells[index]];
+					m_requests.push_back(LoadRequest{ m_activeCells[index], cell.ticket, cell.priority, cell.coord, cell.path });
+				}
+
+				std::sort(m_requests.begin(), m_requests.end(), [](const LoadRequest& first, const LoadRequest& second) { return first.priority > second.priority; });
+			}
+
+			if (m_activeCells.size() > firstNew) { m_condition.notify_all(); }
+		}
+
+		void WorldPartition::Unload(uint32_t cellIndex)
+		{
+			Cell& cell = m_cells[cellIndex];
+
+			switch (cell.state)
+			{
+			case CellState::LOADING:
+				// The result gets ignored when it comes in , the request is dropped on the next IssueLoads
+				++cell.ticket;
+				--m_loadingCount;
+				m_usedMemory -= cell.size;
+				cell.state = CellState::UNLOADED;
+				break;
+
+			case CellState::RESIDENT:
+				--m_residentCount;
+				cell.state = CellState::UNLOADING;
+				break;
+
+			case CellState::MERGING:
+				cell.content.reset();
+				cell.state = CellState::UNLOADING;
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		void WorldPartition::Merge()
+		{
+			uint32_t budget = m_settings.mergeBudget;
+
+			for (uint32_t cellIndex : m_activeCells)
+			{
+				Cell& cell = m_cells[cellIndex];
+				if (cell.state != CellState::UNLOADING) { continue; }
+
+				const size_t count = std::min<size_t>(budget, cell.entities.size());
+				for (size_t index = cell.entities.size() - count; index < cell.entities.size(); ++index) { m_world.Destroy(cell.entities[index]); }
+
+				cell.entities.resize(cell.entities.size() - count);
+				budget -= static_cast<uint32_t>(count);
+
+				if (cell.entities.empty())
+				{
+					cell.entities.shrink_to_fit();
+					m_usedMemory -= cell.size;
+					cell.state = CellState::UNLOADED;
+				}
+
+				if (budget == 0) { break; }
+			}
+
+			// Nearest cells merge first
+			m_merging.clear();
+			for (uint32_t cellIndex : m_activeCells)
+			{
+				if (m_cells[cellIndex].state == CellState::MERGING) { m_merging.push_back(cellIndex); }
+			}
+			std::sort(m_merging.begin(), m_merging.end(), [this](uint32_t first, uint32_t second) { return m_cells[first].priority < m_cells[second].priority; });
+
+			for (uint32_t cellIndex : m_merging)
+			{
+				if (budget == 0) { break; }
+
+				Cell& cell = m_cells[cellIndex];
+				const CellContent& content = *cell.content;
+
+				const size_t begin = cell.entities.size();
+				const size_t end = std::min<size_t>(content.count, begin + budget);
+				for (size_t index = begin; index < end; ++index) { cell.entities.push_back(m_world.Create(content.transforms[index])); }
+
+				budget -= static_cast<uint32_t>(end - begin);
+
+				if (end == content.count)
+				{
+					cell.content.reset();
+					cell.state = CellState::RESIDENT;
+					++m_residentCount;
+				}
+			}
+
+			m_lastMergeCount = m_settings.mergeBudget - budget;
+		}
+
+
+		// ================ STREAMING THREAD ======================
+
+		void WorldPartition::StreamingLoop()
+		{
+			for (;;)
+			{
+				LoadRequest request;
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_condition.wait(lock, [this]() { return m_stop || !m_requests.empty(); });
+
+					if (m_stop) { return; }
+
+					// Nearest first
+					request = std::move(m_requests.back());
+					m_requests.pop_back();
+				}
+
+				LoadResult result;
+				result.cell = request.cell;
+				result.ticket = request.ticket;
+				result.content = Memory::MakeUnique<CellContent>();
+				result.loaded = m_loadFunction(request.coord, request.path, *result.content);
+
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_results.push_back(std::move(result));
+				}
+
+				// Flush may be waiting on it
+				m_condition.notify_all();
+			}
+		}
+
+		bool WorldPartition::LoadSceneCell(CellCoord cell, const std::string& path, CellContent& content)
+		{
+			(void)cell;
+
+			if (!content.file.Open(path)) { return false; }
+
+			uint64_t count = 0;
+			content.transforms = content.file.GetView().GetColumn<Components::Transform>(TRANSFORMS, count);
+			content.count = static_cast<size_t>(count);
+			if (content.transforms == nullptr) { return false; }
+
+			// Fault the pages in here , the main thread merging the cell shouldn't stall on the disk
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(content.transforms);
+			const size_t size = content.count * sizeof(Components::Transform);
+
+			uint32_t checksum = 0;
+			for (size_t offset = 0; offset < size; offset += PAGESIZE) { checksum += bytes[offset]; }
+
+			volatile uint32_t sink = checksum;
+			(void)sink;
+			return true;
+		}
+	}
+}
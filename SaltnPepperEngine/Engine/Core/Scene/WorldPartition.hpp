@@ -0,0 +1,258 @@
+#ifndef WORLDPARTITION_H
+#define WORLDPARTITION_H
+#include "Core/EngineDefines.hpp"
+#include "Core/Components/Transform.hpp"
+#include "Core/ECS/Entity.hpp"
+#include "Core/ECS/World.hpp"
+#include "Core/Memory/MemoryDefinitions.hpp"
+#include "Core/Scene/SceneFile.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Scene
+	{
+		/// <summary>
+		/// Grid cell on the XZ plane , cell (x , z) covers [x * cellSize , (x + 1) * cellSize) on both axes
+		/// </summary>
+		struct CellCoord
+		{
+			int32_t x = 0;
+			int32_t z = 0;
+
+			constexpr bool operator==(const CellCoord& other) const { return x == other.x && z == other.z; }
+			constexpr bool operator!=(const CellCoord& other) const { return !(*this == other); }
+		};
+
+		/// <summary>
+		/// Something the world streams in around (camera , player). Cells within loadRadius of it get loaded ,
+		/// a source with a larger radius pulls farther cells in but doesn't rank them ahead of a close cell of another source
+		/// </summary>
+		struct StreamingSource
+		{
+			Vector3 position = Vector3{ 0.0f,0.0f,0.0f };
+			float loadRadius = 256.0f;
+		};
+
+		struct WorldPartitionSettings
+		{
+			float cellSize = 64.0f;
+
+			// Loaded cells only unload past loadRadius + unloadMargin , so a source on a cell border doesn't make it flicker
+			float unloadMargin = 32.0f;
+
+			// Bytes of cell content resident or in flight at once , nearer cells evict farther ones when it's full
+			uint64_t memoryBudget = 256ull * 1024 * 1024;
+
+			// Entities created or destroyed per Update , cells larger than that merge into the world over several frames
+			uint32_t mergeBudget = 4096;
+		};
+
+		/// <summary>
+		/// What a cell load hands over to the main thread : the cell's transforms , mapped from its scene file
+		/// (TRANSFORMS column) or generated into storage by a custom loader
+		/// </summary>
+		struct CellContent
+		{
+			SceneFile file;
+			std::vector<Components::Transform> storage;
+
+			const Components::Transform* transforms = nullptr;
+			size_t count = 0;
+
+			// Counted against the memory budget
+			uint64_t GetSize() const { return count * sizeof(Components::Transform); }
+		};
+
+		/// <summary>
+		/// Loads a cell on the streaming thread : gets the cell and the path it was added with , fills content.
+		/// Must not touch the world or anything else the main thread uses
+		/// </summary>
+		using CellLoadFunction = std::function<bool(CellCoord cell, const std::string& path, CellContent& content)>;
+
+		/// <summary>
+		/// Grid based world partition. The world is cut into square cells , each stored on its own (a scene file by default).
+		/// Every Update ranks the cells around the streaming sources by distance , queues the nearest ones that fit the memory budget
+		/// for a background streaming thread and unloads the ones that fell out of range. Finished loads are merged into the
+		/// ECS world on the main thread a bounded number of entities a frame (one entity with a Transform per cell transform) ,
+		/// unloads tear them down the same way , so a cell coming in never costs a frame more than mergeBudget entities.
+		/// Main thread only , apart from the loader
+		/// </summary>
+		class SNP_API WorldPartition
+		{
+		public:
+
+			enum class CellState : uint8_t
+			{
+				UNLOADED,
+				// Waiting for or on the streaming thread
+				LOADING,
+				// Loaded , entities being created
+				MERGING,
+				RESIDENT,
+				// Entities being destroyed
+				UNLOADING,
+				// The loader gave up on it , not retried
+				FAILED
+			};
+
+			WorldPartition(ECS::World& world, const WorldPartitionSettings& settings = WorldPartitionSettings{});
+
+			/// <summary>
+			/// Stops the streaming thread , the entities of resident cells stay in the world
+			/// </summary>
+			~WorldPartition();
+
+			NONCOPYABLE(WorldPartition)
+
+			/// <summary>
+			/// Replaces the default loader (maps path as a scene file). Set it before the first Update
+			/// </summary>
+			void SetLoadFunction(CellLoadFunction function) { m_loadFunction = std::move(function); }
+
+			/// <summary>
+			/// Registers a cell and where its content lives. size is what it counts against the memory budget until it's been
+			/// loaded once (the size of the file when 0)
+			/// </summary>
+			void AddCell(CellCoord cell, const std::string& path, uint64_t size = 0);
+
+			/// <summary>
+			/// The cell a position falls in , what tools sort entities into cells by
+			/// </summary>
+			CellCoord GetCellCoord(const Vector3& position) const;
+
+
+			// ================ STREAMING ======================
+
+			/// <summary>
+			/// Collects finished loads , re-ranks the cells against sources , issues loads and unloads and spends the frame's
+			/// merge budget. Call once a frame
+			/// </summary>
+			void Update(const StreamingSource* sources, size_t sourceCount);
+
+			/// <summary>
+			/// Blocks until nothing is loading or merging anymore (level start , tests)
+			/// </summary>
+			void Flush(const StreamingSource* sources, size_t sourceCount);
+
+			CellState GetCellState(CellCoord cell) const;
+
+			/// <summary>
+			/// The entities a cell created , valid while it's resident
+			/// </summary>
+			const std::vector<ECS::Entity>* GetCellEntities(CellCoord cell) const;
+
+
+			// ================ STATS ======================
+
+			uint32_t GetCellCount() const { return static_cast<uint32_t>(m_cells.size()); }
+			uint32_t GetResidentCount() const { return m_residentCount; }
+			uint32_t GetLoadingCount() const { return m_loadingCount; }
+
+			// Bytes of resident and in flight cells
+			uint64_t GetUsedMemory() const { return m_usedMemory; }
+
+			// Entities created and destroyed by the last Update
+			uint32_t GetLastMergeCount() const { return m_lastMergeCount; }
+
+		private:
+
+			struct Cell
+			{
+				CellCoord coord;
+				std::string path;
+				uint64_t size = 0;
+
+				CellState state = CellState::UNLOADED;
+
+				// Distance to the nearest source over its load radius , below 1 wanted , above 1 + margin unwanted
+				float priority = 0.0f;
+
+				// Bumped on every load request , results of cancelled requests no longer match
+				uint32_t ticket = 0;
+
+				Memory::UniquePtr<CellContent> content;
+				std::vector<ECS::Entity> entities;
+			};
+
+			// Carries its own copy of what the loader needs , the streaming thread never reads m_cells
+			struct LoadRequest
+			{
+				uint32_t cell = 0;
+				uint32_t ticket = 0;
+				float priority = 0.0f;
+				CellCoord coord;
+				std::string path;
+			};
+
+			struct LoadResult
+			{
+				uint32_t cell = 0;
+				uint32_t ticket = 0;
+				bool loaded = false;
+				Memory::UniquePtr<CellContent> content;
+			};
+
+			static uint64_t GetKey(CellCoord cell) { return (static_cast<uint64_t>(static_cast<uint32_t>(cell.x)) << 32) | static_cast<uint32_t>(cell.z); }
+
+			void StreamingLoop();
+			static bool LoadSceneCell(CellCoord cell, const std::string& path, CellContent& content);
+
+			void CollectLoads();
+			void RankCells(const StreamingSource* sources, size_t sourceCount);
+			void IssueLoads();
+
+			/// <summary>
+			/// Starts taking the cell down , whatever state it is in
+			/// </summary>
+			void Unload(uint32_t cellIndex);
+
+			/// <summary>
+			/// Spends the merge budget , unloads first so their memory frees up
+			/// </summary>
+			void Merge();
+
+			ECS::World& m_world;
+			WorldPartitionSettings m_settings;
+			CellLoadFunction m_loadFunction;
+
+			std::vector<Cell> m_cells;
+			std::unordered_map<uint64_t, uint32_t> m_cellLookup;
+
+			// Cells not UNLOADED , and the wanted ones this frame ranked nearest first
+			std::vector<uint32_t> m_activeCells;
+			std::vector<uint32_t> m_candidates;
+			std::vector<uint32_t> m_merging;
+			std::vector<LoadResult> m_collected;
+
+			uint64_t m_usedMemory = 0;
+			uint32_t m_residentCount = 0;
+			uint32_t m_loadingCount = 0;
+			uint32_t m_lastMergeCount = 0;
+			uint32_t m_updateIndex = 0;
+
+			// Last Update each cell was ranked in , so overlapping sources rank it once
+			std::vector<uint32_t> m_rankedIn;
+
+			// ======== STREAMING THREAD ========
+			std::thread m_thread;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+
+			// Sorted farthest first , the thread takes from the back
+			std::vector<LoadRequest> m_requests;
+			std::vector<LoadResult> m_results;
+			bool m_stop = false;
+		};
+	}
+}
+
+#endif // !WORLDPARTITION_H
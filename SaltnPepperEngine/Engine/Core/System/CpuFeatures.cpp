@@ -0,0 +1,99 @@
+#include "CpuFeatures.hpp"
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+namespace SaltnPepperEngine
+{
+	namespace Platform
+	{
+		namespace
+		{
+			// registers are { eax, ebx, ecx, edx }
+			void CpuId(uint32_t leaf, uint32_t subLeaf, uint32_t registers[4])
+			{
+#if defined(_MSC_VER)
+				int values[4];
+				__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subLeaf));
+				for (int index = 0; index < 4; ++index) { registers[index] = static_cast<uint32_t>(values[index]); }
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+				__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#else
+				registers[0] = registers[1] = registers[2] = registers[3] = 0;
+#endif
+			}
+
+			// The extended register state the OS saves on context switch
+			uint64_t ReadXCR0()
+			{
+#if defined(_MSC_VER)
+				return _xgetbv(0);
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+				uint32_t low, high;
+				__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+				return (static_cast<uint64_t>(high) << 32) | low;
+#else
+				return 0;
+#endif
+			}
+
+			inline bool HasBit(uint32_t value, uint32_t bit)
+			{
+				return (value & (1u << bit)) != 0;
+			}
+
+			CpuFeatures DetectFeatures()
+			{
+				CpuFeatures features;
+				uint32_t registers[4] = {};
+
+				CpuId(0, 0, registers);
+				const uint32_t maxLeaf = registers[0];
+
+				std::memcpy(features.Vendor + 0, &registers[1], 4);
+				std::memcpy(features.Vendor + 4, &registers[3], 4);
+				std::memcpy(features.Vendor + 8, &registers[2], 4);
+
+				if (maxLeaf < 1) { return features; }
+
+				CpuId(1, 0, registers);
+				const bool osxsave = HasBit(registers[2], 27);
+
+				features.SSE42 = HasBit(registers[2], 20);
+				features.FMA = HasBit(registers[2], 12);
+				features.F16C = HasBit(registers[2], 29);
+
+				// The AVX bits only mean something when the OS saves the YMM (and ZMM) state
+				const uint64_t xcr0 = osxsave ? ReadXCR0() : 0;
+				const bool ymmState = (xcr0 & 0x6) == 0x6;
+				const bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+				features.AVX = HasBit(registers[2], 28) && ymmState;
+				features.FMA = features.FMA && features.AVX;
+				features.F16C = features.F16C && features.AVX;
+
+				if (maxLeaf < 7) { return features; }
+
+				CpuId(7, 0, registers);
+
+				features.AVX2 = HasBit(registers[1], 5) && features.AVX;
+				features.AVX512F = HasBit(registers[1], 16) && zmmState;
+				features.AVX512DQ = HasBit(registers[1], 17) && features.AVX512F;
+				features.AVX512BW = HasBit(registers[1], 30) && features.AVX512F;
+				features.AVX512VL = HasBit(registers[1], 31) && features.AVX512F;
+
+				return features;
+			}
+		}
+
+		const CpuFeatures& GetCpuFeatures()
+		{
+			static const CpuFeatures features = DetectFeatures();
+			return features;
+		}
+	}
+}
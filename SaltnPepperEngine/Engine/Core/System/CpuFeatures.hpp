@@ -0,0 +1,36 @@
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+#include "Core/EngineDefines.hpp"
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Platform
+	{
+		/// <summary>
+		/// Instruction set extensions reported by cpuid (and enabled by the OS through XCR0)
+		/// </summary>
+		struct CpuFeatures
+		{
+			bool SSE42 = false;
+			bool AVX = false;
+			bool AVX2 = false;
+			bool FMA = false;
+			bool F16C = false;
+			bool AVX512F = false;
+			bool AVX512DQ = false;
+			bool AVX512BW = false;
+			bool AVX512VL = false;
+
+			// Null terminated vendor string (GenuineIntel / AuthenticAMD ...)
+			char Vendor[13] = {};
+		};
+
+		/// <summary>
+		/// Runs cpuid once and returns the cached feature set for the current machine
+		/// </summary>
+		SNP_API const CpuFeatures& GetCpuFeatures();
+	}
+}
+
+#endif // !CPUFEATURES_H
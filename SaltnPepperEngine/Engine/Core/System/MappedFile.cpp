@@ -0,0 +1,116 @@
+#include "MappedFile.hpp"
+#include <utility>
+
+#if defined(_WIN32)
+#include "Core/System/PlatformDefinitions.hpp"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SaltnPepperEngine
+{
+	namespace Platform
+	{
+		MappedFile::~MappedFile()
+		{
+			Close();
+		}
+
+		MappedFile::MappedFile(MappedFile&& other) noexcept
+		{
+			*this = std::move(other);
+		}
+
+		MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Close();
+
+				m_data = std::exchange(other.m_data, nullptr);
+				m_size = std::exchange(other.m_size, 0);
+				m_file = std::exchange(other.m_file, nullptr);
+				m_mapping = std::exchange(other.m_mapping, nullptr);
+			}
+
+			return *this;
+		}
+
+		bool MappedFile::Open(const std::string& path)
+		{
+			Close();
+
+#if defined(_WIN32)
+			HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (file == INVALID_HANDLE_VALUE) { return false; }
+
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+			{
+				CloseHandle(file);
+				return false;
+			}
+
+			HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping == nullptr)
+			{
+				CloseHandle(file);
+				return false;
+			}
+
+			void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (data == nullptr)
+			{
+				CloseHandle(mapping);
+				CloseHandle(file);
+				return false;
+			}
+
+			m_file = file;
+			m_mapping = mapping;
+			m_data = static_cast<const uint8_t*>(data);
+			m_size = static_cast<size_t>(size.QuadPart);
+#else
+			const int descriptor = open(path.c_str(), O_RDONLY);
+			if (descriptor < 0) { return false; }
+
+			struct stat status;
+			if (fstat(descriptor, &status) != 0 || status.st_size == 0)
+			{
+				close(descriptor);
+				return false;
+			}
+
+			void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+			close(descriptor);
+			if (data == MAP_FAILED) { return false; }
+
+			m_data = static_cast<const uint8_t*>(data);
+			m_size = static_cast<size_t>(status.st_size);
+#endif
+
+			return true;
+		}
+
+		void MappedFile::Close()
+		{
+			if (m_data == nullptr) { return; }
+
+#if defined(_WIN32)
+			UnmapViewOfFile(m_data);
+			CloseHandle(static_cast<HANDLE>(m_mapping));
+			CloseHandle(static_cast<HANDLE>(m_file));
+#else
+			munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+
+			m_data = nullptr;
+			m_size = 0;
+			m_file = nullptr;
+			m_mapping = nullptr;
+		}
+	}
+}
@@ -0,0 +1,52 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+#include "Core/EngineDefines.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace SaltnPepperEngine
+{
+	namespace Platform
+	{
+		/// <summary>
+		/// Read only memory mapping of a whole file. The OS pages the contents in on first touch , so opening costs
+		/// the same for any file size and nothing gets copied into the process heap
+		/// </summary>
+		class SNP_API MappedFile
+		{
+		public:
+
+			MappedFile() = default;
+			~MappedFile();
+
+			NONCOPYABLE(MappedFile)
+
+			MappedFile(MappedFile&& other) noexcept;
+			MappedFile& operator=(MappedFile&& other) noexcept;
+
+			/// <summary>
+			/// Maps the file , returns false (and stays closed) if it can't be opened or is empty
+			/// </summary>
+			bool Open(const std::string& path);
+
+			void Close();
+
+			bool IsOpen() const { return m_data != nullptr; }
+
+			const uint8_t* GetData() const { return m_data; }
+			size_t GetSize() const { return m_size; }
+
+		private:
+
+			const uint8_t* m_data = nullptr;
+			size_t m_size = 0;
+
+			// File and mapping handles on Windows , unused elsewhere (the descriptor is closed as soon as mmap returns)
+			void* m_file = nullptr;
+			void* m_mapping = nullptr;
+		};
+	}
+}
+
+#endif // !MAPPEDFILE_H
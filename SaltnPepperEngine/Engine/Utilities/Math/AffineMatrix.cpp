@@ -0,0 +1,36 @@
+#include "AffineMatrix.hpp"
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		void ExpandAffine(const Matrix3X4* source, Matrix* destination, size_t count)
+		{
+			for (size_t index = 0; index < count; ++index)
+			{
+				XMStoreFloat4x4(&destination[index], XMLoadFloat3x4(&source[index]));
+			}
+		}
+
+		void ExpandAffineTransposed(const Matrix3X4* source, Matrix* destination, size_t count)
+		{
+			// Already the transposed rows , just the constant row to add
+			for (size_t index = 0; index < count; ++index)
+			{
+				float* rows = &destination[index].m[0][0];
+				XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(rows), AffineDetail::LoadRow(source[index], 0));
+				XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(rows + 4), AffineDetail::LoadRow(source[index], 1));
+				XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(rows + 8), AffineDetail::LoadRow(source[index], 2));
+				XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(rows + 12), g_XMIdentityR3);
+			}
+		}
+
+		void CompactAffine(const Matrix* source, Matrix3X4* destination, size_t count)
+		{
+			for (size_t index = 0; index < count; ++index)
+			{
+				XMStoreFloat3x4(&destination[index], XMLoadFloat4x4(&source[index]));
+			}
+		}
+	}
+}
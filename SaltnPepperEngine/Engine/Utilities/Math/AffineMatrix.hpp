@@ -0,0 +1,270 @@
+#ifndef AFFINEMATRIX_H
+#define AFFINEMATRIX_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cmath>
+#include <cstddef>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Affine matrix without the constant 0 , 0 , 0 , 1 column (48 bytes instead of 64).
+		/// Row i holds column i of the engine's row vector Matrix , the last element of the row being the translation ,
+		/// which is the XMLoadFloat3x4 layout and what a float3x4 shader constant expects
+		/// </summary>
+		using Matrix3X4 = XMFLOAT3X4;
+
+		inline static constexpr Matrix3X4 IDENTITYAFFINE = Matrix3X4(1, 0, 0, 0,
+																	 0, 1, 0, 0,
+																	 0, 0, 1, 0);
+
+		namespace AffineDetail
+		{
+			inline XMVECTOR XM_CALLCONV LoadRow(const Matrix3X4& matrix, int row)
+			{
+				return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(matrix.m[row]));
+			}
+
+			inline void XM_CALLCONV StoreRow(Matrix3X4& matrix, int row, FXMVECTOR value)
+			{
+				XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(matrix.m[row]), value);
+			}
+
+			/// <summary>
+			/// One stored row of first * second : the stored rows of first weighted by the column of second ,
+			/// summed in the same order as XMMatrixMultiply so both layouts give the same numbers
+			/// </summary>
+			inline XMVECTOR XM_CALLCONV MultiplyRow(FXMVECTOR first0, FXMVECTOR first1, FXMVECTOR first2, GXMVECTOR secondRow)
+			{
+				const XMVECTOR x = XMVectorMultiply(XMVectorSplatX(secondRow), first0);
+				const XMVECTOR y = XMVectorMultiply(XMVectorSplatY(secondRow), first1);
+				const XMVECTOR z = XMVectorMultiply(XMVectorSplatZ(secondRow), first2);
+
+				// Translation of second only lands in the w lane (first's 0 , 0 , 0 , 1 column)
+				const XMVECTOR w = XMVectorAndInt(secondRow, g_XMMaskW);
+				return XMVectorAdd(XMVectorAdd(x, z), XMVectorAdd(y, w));
+			}
+		}
+
+
+		// ================ LOAD / STORE ======================
+
+		/// <summary>
+		/// Expands to a full row vector matrix (the missing column comes back as 0 , 0 , 0 , 1)
+		/// </summary>
+		inline XMMATRIX XM_CALLCONV LoadMatrix(const Matrix3X4& matrix) { return XMLoadFloat3x4(&matrix); }
+		inline XMMATRIX XM_CALLCONV LoadMatrix(const Matrix& matrix) { return XMLoadFloat4x4(&matrix); }
+
+		/// <summary>
+		/// Drops the last column , matrix has to be affine
+		/// </summary>
+		inline void XM_CALLCONV StoreMatrix(Matrix3X4& destination, FXMMATRIX matrix) { XMStoreFloat3x4(&destination, matrix); }
+		inline void XM_CALLCONV StoreMatrix(Matrix& destination, FXMMATRIX matrix) { XMStoreFloat4x4(&destination, matrix); }
+
+		inline Matrix ToMatrix(const Matrix3X4& matrix)
+		{
+			Matrix result;
+			XMStoreFloat4x4(&result, XMLoadFloat3x4(&matrix));
+			return result;
+		}
+
+		inline const Matrix& ToMatrix(const Matrix& matrix) { return matrix; }
+
+		inline Matrix3X4 ToAffine(const Matrix& matrix)
+		{
+			Matrix3X4 result;
+			XMStoreFloat3x4(&result, XMLoadFloat4x4(&matrix));
+			return result;
+		}
+
+
+		// ================ AFFINE MATH ======================
+		// Every input has to be affine (last column 0 , 0 , 0 , 1) , that column is never read
+
+		/// <summary>
+		/// first * second (first applied , then second) for row vector matrices in registers.
+		/// Skips the products with the constant column , 12 multiplies instead of 16 , same result as XMMatrixMultiply
+		/// </summary>
+		inline XMMATRIX XM_CALLCONV AffineMultiply(FXMMATRIX first, CXMMATRIX second)
+		{
+			XMMATRIX result;
+			for (int row = 0; row < 3; ++row)
+			{
+				const XMVECTOR x = XMVectorMultiply(XMVectorSplatX(first.r[row]), second.r[0]);
+				const XMVECTOR y = XMVectorMultiply(XMVectorSplatY(first.r[row]), second.r[1]);
+				const XMVECTOR z = XMVectorMultiply(XMVectorSplatZ(first.r[row]), second.r[2]);
+				result.r[row] = XMVectorAdd(XMVectorAdd(x, z), y);
+			}
+
+			const XMVECTOR x = XMVectorMultiply(XMVectorSplatX(first.r[3]), second.r[0]);
+			const XMVECTOR y = XMVectorMultiply(XMVectorSplatY(first.r[3]), second.r[1]);
+			const XMVECTOR z = XMVectorMultiply(XMVectorSplatZ(first.r[3]), second.r[2]);
+			result.r[3] = XMVectorAdd(XMVectorAdd(x, z), XMVectorAdd(y, second.r[3]));
+			return result;
+		}
+
+		/// <summary>
+		/// first * second straight on the 3x4 storage , nothing gets expanded
+		/// </summary>
+		inline Matrix3X4 AffineMultiply(const Matrix3X4& first, const Matrix3X4& second)
+		{
+			const XMVECTOR first0 = AffineDetail::LoadRow(first, 0);
+			const XMVECTOR first1 = AffineDetail::LoadRow(first, 1);
+			const XMVECTOR first2 = AffineDetail::LoadRow(first, 2);
+
+			Matrix3X4 result;
+			for (int row = 0; row < 3; ++row)
+			{
+				AffineDetail::StoreRow(result, row, AffineDetail::MultiplyRow(first0, first1, first2, AffineDetail::LoadRow(second, row)));
+			}
+			return result;
+		}
+
+		/// <summary>
+		/// first (in registers , e.g. a freshly built local matrix) * second , stored in second's layout.
+		/// Lets the transform updates stay storage agnostic : the 3x4 version transposes first once and never expands second
+		/// </summary>
+		inline Matrix3X4 XM_CALLCONV AffineMultiply(FXMMATRIX first, const Matrix3X4& second)
+		{
+			const XMMATRIX transposed = XMMatrixTranspose(first);
+
+			Matrix3X4 result;
+			for (int row = 0; row < 3; ++row)
+			{
+				AffineDetail::StoreRow(result, row, AffineDetail::MultiplyRow(transposed.r[0], transposed.r[1], transposed.r[2], AffineDetail::LoadRow(second, row)));
+			}
+			return result;
+		}
+
+		inline Matrix XM_CALLCONV AffineMultiply(FXMMATRIX first, const Matrix& second)
+		{
+			Matrix result;
+			XMStoreFloat4x4(&result, AffineMultiply(first, XMLoadFloat4x4(&second)));
+			return result;
+		}
+
+		/// <summary>
+		/// Inverse from the 3x3 part's cofactors plus the rotated , negated translation. A singular matrix gives infinities
+		/// (like XMMatrixInverse) , outDeterminant reports it when given
+		/// </summary>
+		inline XMMATRIX XM_CALLCONV AffineInverse(FXMMATRIX matrix, float* outDeterminant = nullptr)
+		{
+			// Columns of the inverse 3x3 part are the cross products of its rows
+			const XMVECTOR column0 = XMVector3Cross(matrix.r[1], matrix.r[2]);
+			const XMVECTOR column1 = XMVector3Cross(matrix.r[2], matrix.r[0]);
+			const XMVECTOR column2 = XMVector3Cross(matrix.r[0], matrix.r[1]);
+			const XMVECTOR determinant = XMVector3Dot(matrix.r[0], column0);
+			if (outDeterminant != nullptr) { *outDeterminant = XMVectorGetX(determinant); }
+
+			const XMVECTOR reciprocal = XMVectorReciprocal(determinant);
+
+			XMMATRIX result = XMMatrixTranspose(XMMATRIX(column0, column1, column2, g_XMZero));
+			result.r[0] = XMVectorMultiply(result.r[0], reciprocal);
+			result.r[1] = XMVectorMultiply(result.r[1], reciprocal);
+			result.r[2] = XMVectorMultiply(result.r[2], reciprocal);
+
+			const XMVECTOR x = XMVectorMultiply(XMVectorSplatX(matrix.r[3]), result.r[0]);
+			const XMVECTOR y = XMVectorMultiply(XMVectorSplatY(matrix.r[3]), result.r[1]);
+			const XMVECTOR z = XMVectorMultiply(XMVectorSplatZ(matrix.r[3]), result.r[2]);
+			result.r[3] = XMVectorSelect(g_XMIdentityR3, XMVectorNegate(XMVectorAdd(XMVectorAdd(x, z), y)), g_XMSelect1110);
+			return result;
+		}
+
+		inline Matrix3X4 AffineInverse(const Matrix3X4& matrix, float* outDeterminant = nullptr)
+		{
+			const XMVECTOR row0 = AffineDetail::LoadRow(matrix, 0);
+			const XMVECTOR row1 = AffineDetail::LoadRow(matrix, 1);
+			const XMVECTOR row2 = AffineDetail::LoadRow(matrix, 2);
+
+			// The stored rows are the columns of the 3x3 part , so the crosses come out as the inverse's stored rows after one transpose
+			const XMVECTOR cross0 = XMVector3Cross(row1, row2);
+			const XMVECTOR cross1 = XMVector3Cross(row2, row0);
+			const XMVECTOR cross2 = XMVector3Cross(row0, row1);
+			const XMVECTOR determinant = XMVector3Dot(row0, cross0);
+			if (outDeterminant != nullptr) { *outDeterminant = XMVectorGetX(determinant); }
+
+			const XMVECTOR reciprocal = XMVectorReciprocal(determinant);
+			const XMVECTOR inverse0 = XMVectorMultiply(cross0, reciprocal);
+			const XMVECTOR inverse1 = XMVectorMultiply(cross1, reciprocal);
+			const XMVECTOR inverse2 = XMVectorMultiply(cross2, reciprocal);
+
+			// Translation (the w lanes) through the inverse 3x3 part , transposed along with the rest
+			const XMVECTOR x = XMVectorMultiply(XMVectorSplatW(row0), inverse0);
+			const XMVECTOR y = XMVectorMultiply(XMVectorSplatW(row1), inverse1);
+			const XMVECTOR z = XMVectorMultiply(XMVectorSplatW(row2), inverse2);
+			const XMVECTOR translation = XMVectorNegate(XMVectorAdd(XMVectorAdd(x, z), y));
+
+			const XMMATRIX transposed = XMMatrixTranspose(XMMATRIX(inverse0, inverse1, inverse2, translation));
+
+			Matrix3X4 result;
+			for (int row = 0; row < 3; ++row) { AffineDetail::StoreRow(result, row, transposed.r[row]); }
+			return result;
+		}
+
+
+		// ================ TRANSFORM VECTORS ======================
+
+		inline static constexpr Vector3 GetRight(const Matrix3X4& matrix)
+		{
+			return Vector3{ matrix.m[0][0], matrix.m[1][0], matrix.m[2][0] };
+		}
+
+		inline static constexpr Vector3 GetUp(const Matrix3X4& matrix)
+		{
+			return Vector3{ matrix.m[0][1], matrix.m[1][1], matrix.m[2][1] };
+		}
+
+		inline static constexpr Vector3 GetForward(const Matrix3X4& matrix)
+		{
+			return Vector3{ matrix.m[0][2], matrix.m[1][2], matrix.m[2][2] };
+		}
+
+		inline static constexpr Vector3 GetTranslation(const Matrix3X4& matrix)
+		{
+			return Vector3{ matrix.m[0][3], matrix.m[1][3], matrix.m[2][3] };
+		}
+
+		inline static constexpr Vector3 GetTranslation(const Matrix& matrix)
+		{
+			return Vector3{ matrix.m[3][0], matrix.m[3][1], matrix.m[3][2] };
+		}
+
+		// Lengths of the basis rows , the scale of a matrix without shear (no decompose needed)
+		inline Vector3 GetScale(const Matrix3X4& matrix)
+		{
+			return Vector3{ std::sqrt(matrix.m[0][0] * matrix.m[0][0] + matrix.m[1][0] * matrix.m[1][0] + matrix.m[2][0] * matrix.m[2][0]),
+				std::sqrt(matrix.m[0][1] * matrix.m[0][1] + matrix.m[1][1] * matrix.m[1][1] + matrix.m[2][1] * matrix.m[2][1]),
+				std::sqrt(matrix.m[0][2] * matrix.m[0][2] + matrix.m[1][2] * matrix.m[1][2] + matrix.m[2][2] * matrix.m[2][2]) };
+		}
+
+		inline Vector3 GetScale(const Matrix& matrix)
+		{
+			return Vector3{ std::sqrt(matrix.m[0][0] * matrix.m[0][0] + matrix.m[0][1] * matrix.m[0][1] + matrix.m[0][2] * matrix.m[0][2]),
+				std::sqrt(matrix.m[1][0] * matrix.m[1][0] + matrix.m[1][1] * matrix.m[1][1] + matrix.m[1][2] * matrix.m[1][2]),
+				std::sqrt(matrix.m[2][0] * matrix.m[2][0] + matrix.m[2][1] * matrix.m[2][1] + matrix.m[2][2] * matrix.m[2][2]) };
+		}
+
+
+		// ================ BULK ======================
+		// Upload paths : keep the 3x4 storage and expand while copying into the destination (staging / mapped buffer)
+
+		/// <summary>
+		/// Writes count full row vector matrices , source and destination must not overlap
+		/// </summary>
+		SNP_API void ExpandAffine(const Matrix3X4* source, Matrix* destination, size_t count);
+
+		/// <summary>
+		/// Same as ExpandAffine , but writes the transposed (column vector) matrices GL style shader constants expect
+		/// </summary>
+		SNP_API void ExpandAffineTransposed(const Matrix3X4* source, Matrix* destination, size_t count);
+
+		/// <summary>
+		/// Drops the constant column of count affine matrices
+		/// </summary>
+		SNP_API void CompactAffine(const Matrix* source, Matrix3X4* destination, size_t count);
+	}
+}
+
+#endif // !AFFINEMATRIX_H
@@ -0,0 +1,665 @@
+#include "BoundingVolumes.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+#include "Utilities/Math/Random.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include <cstring>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace
+		{
+			struct PointStream
+			{
+				const uint8_t* data = nullptr;
+				size_t count = 0;
+				size_t stride = sizeof(Vector3);
+
+				const uint8_t* At(size_t index) const { return data + index * stride; }
+
+				Vector3 Get(size_t index) const
+				{
+					Vector3 point;
+					std::memcpy(&point.x, At(index), sizeof(float) * 3);
+					return point;
+				}
+			};
+
+			struct Extents
+			{
+				float minimum[3];
+				float maximum[3];
+			};
+
+			struct FarthestPoint
+			{
+				float distanceSquared;
+				size_t index;
+			};
+
+			struct PointMoments
+			{
+				double sums[9];
+			};
+
+			/// <summary>
+			/// Runs reduce(first , count) over the whole stream , or over BOUNDS_PARALLELGRAIN sized slices across the job system when
+			/// the stream is big enough , then folds the slice results together in order with combine
+			/// </summary>
+			template <typename Partial, typename Reduce, typename Combine>
+			Partial ReduceStream(const PointStream& stream, Reduce reduce, Combine combine)
+			{
+				if (stream.count < BOUNDS_PARALLELTHRESHOLD)
+				{
+					return reduce(0, stream.count);
+				}
+
+				const size_t sliceCount = (stream.count + BOUNDS_PARALLELGRAIN - 1) / BOUNDS_PARALLELGRAIN;
+				std::vector<Partial> partials(sliceCount);
+
+				Jobs::JobSystem::ParallelFor(sliceCount, 1, [&](size_t begin, size_t end)
+				{
+					for (size_t slice = begin; slice < end; ++slice)
+					{
+						const size_t first = slice * BOUNDS_PARALLELGRAIN;
+						partials[slice] = reduce(first, std::min(BOUNDS_PARALLELGRAIN, stream.count - first));
+					}
+				});
+
+				Partial result = partials[0];
+				for (size_t slice = 1; slice < sliceCount; ++slice)
+				{
+					result = combine(result, partials[slice]);
+				}
+				return result;
+			}
+
+			Extents MinMax(const PointStream& stream)
+			{
+				const MathKernelTable& kernels = MathDispatch::GetKernels();
+
+				return ReduceStream<Extents>(stream, [&](size_t first, size_t count)
+				{
+					Extents extents;
+					kernels.BoundsMinMax(stream.At(first), count, stream.stride, extents.minimum, extents.maximum);
+					return extents;
+				},
+				[](Extents result, const Extents& other)
+				{
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						result.minimum[axis] = std::min(result.minimum[axis], other.minimum[axis]);
+						result.maximum[axis] = std::max(result.maximum[axis], other.maximum[axis]);
+					}
+					return result;
+				});
+			}
+
+			FarthestPoint Farthest(const PointStream& stream, const Vector3& center)
+			{
+				const MathKernelTable& kernels = MathDispatch::GetKernels();
+
+				return ReduceStream<FarthestPoint>(stream, [&](size_t first, size_t count)
+				{
+					FarthestPoint farthest;
+					kernels.BoundsFarthest(stream.At(first), count, stream.stride, &center.x, &farthest.distanceSquared, &farthest.index);
+					farthest.index += first;
+					return farthest;
+				},
+				[](const FarthestPoint& result, const FarthestPoint& other)
+				{
+					// Slices come in order , so keeping the earlier one on a tie keeps the lowest index
+					return other.distanceSquared > result.distanceSquared ? other : result;
+				});
+			}
+
+			PointMoments Moments(const PointStream& stream, const Vector3& origin)
+			{
+				const MathKernelTable& kernels = MathDispatch::GetKernels();
+
+				return ReduceStream<PointMoments>(stream, [&](size_t first, size_t count)
+				{
+					PointMoments moments;
+					kernels.BoundsMoments(stream.At(first), count, stream.stride, &origin.x, moments.sums);
+					return moments;
+				},
+				[](PointMoments result, const PointMoments& other)
+				{
+					for (int moment = 0; moment < 9; ++moment) { result.sums[moment] += other.sums[moment]; }
+					return result;
+				});
+			}
+
+			Extents Project(const PointStream& stream, const float* axes)
+			{
+				const MathKernelTable& kernels = MathDispatch::GetKernels();
+
+				return ReduceStream<Extents>(stream, [&](size_t first, size_t count)
+				{
+					Extents extents;
+					kernels.BoundsProject(stream.At(first), count, stream.stride, axes, extents.minimum, extents.maximum);
+					return extents;
+				},
+				[](Extents result, const Extents& other)
+				{
+					for (int axis = 0; axis < 3; ++axis)
+					{
+						result.minimum[axis] = std::min(result.minimum[axis], other.minimum[axis]);
+						result.maximum[axis] = std::max(result.maximum[axis], other.maximum[axis]);
+					}
+					return result;
+				});
+			}
+
+			// ===================== BOX =========================
+
+			BoundingBox BoxFromExtents(const Extents& extents)
+			{
+				const Vector3 minimum(extents.minimum[0], extents.minimum[1], extents.minimum[2]);
+				const Vector3 maximum(extents.maximum[0], extents.maximum[1], extents.maximum[2]);
+
+				return BoundingBox((minimum + maximum) * 0.5f, (maximum - minimum) * 0.5f);
+			}
+
+			BoundingBox BuildBox(const PointStream& stream)
+			{
+				if (stream.count == 0) { return BoundingBox(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f)); }
+
+				return BoxFromExtents(MinMax(stream));
+			}
+
+			// ===================== FAST SPHERE =========================
+
+			// Slack for the float distance compare , without it rounding can keep a point on the surface "outside" forever
+			inline static constexpr float SPHERETOLERANCE = 1e-6f;
+
+			BoundingSphere BuildSphere(const PointStream& stream)
+			{
+				if (stream.count == 0) { return BoundingSphere(Vector3(0.0f, 0.0f, 0.0f), 0.0f); }
+
+				// Ritter's seed pair : the point farthest from an arbitrary point , then the point farthest from that one
+				const Vector3 first = stream.Get(Farthest(stream, stream.Get(0)).index);
+				const FarthestPoint second = Farthest(stream, first);
+
+				Vector3 center = (first + stream.Get(second.index)) * 0.5f;
+				float radius = std::sqrt(second.distanceSquared) * 0.5f;
+
+				// Instead of one sequential grow pass , grow towards the farthest point each sweep so every sweep stays a vector reduction
+				for (uint32_t iteration = 0; ; ++iteration)
+				{
+					const FarthestPoint farthest = Farthest(stream, center);
+					const float distance = std::sqrt(farthest.distanceSquared);
+
+					if (distance <= radius * (1.0f + SPHERETOLERANCE) || iteration == BOUNDS_SPHEREITERATIONS)
+					{
+						radius = std::max(radius, distance);
+						break;
+					}
+
+					// The new sphere touches the far side of the old one and the outside point
+					const float grownRadius = 0.5f * (radius + distance);
+					center += (stream.Get(farthest.index) - center) * ((distance - grownRadius) / distance);
+					radius = grownRadius;
+				}
+
+				return BoundingSphere(center, radius);
+			}
+
+			// ===================== EXACT SPHERE =========================
+
+			struct SphereD
+			{
+				double center[3];
+				double radiusSquared;
+			};
+
+			struct PointD
+			{
+				double x, y, z;
+			};
+
+			// Relative slack on the radius for the containment test , inputs are floats so anything tighter is noise
+			inline static constexpr double EXACTTOLERANCE = 1e-7;
+
+			inline PointD Subtract(const PointD& a, const PointD& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+			inline double Dot(const PointD& a, const PointD& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+			inline PointD Cross(const PointD& a, const PointD& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+
+			inline bool Contains(const SphereD& sphere, const PointD& point)
+			{
+				const PointD offset = { point.x - sphere.center[0], point.y - sphere.center[1], point.z - sphere.center[2] };
+				return Dot(offset, offset) <= sphere.radiusSquared * (1.0 + 2.0 * EXACTTOLERANCE) + 1e-30;
+			}
+
+			SphereD SphereAround(const PointD& origin, const PointD& offset)
+			{
+				return { { origin.x + offset.x, origin.y + offset.y, origin.z + offset.z }, Dot(offset, offset) };
+			}
+
+			SphereD Diameter(const PointD& a, const PointD& b)
+			{
+				return SphereAround(a, { 0.5 * (b.x - a.x), 0.5 * (b.y - a.y), 0.5 * (b.z - a.z) });
+			}
+
+			// Circumcircle of a triangle , falls back to the longest edge when the points are collinear
+			SphereD Circumsphere(const PointD& a, const PointD& b, const PointD& c)
+			{
+				const PointD ab = Subtract(b, a), ac = Subtract(c, a);
+				const PointD normal = Cross(ab, ac);
+				const double denominator = 2.0 * Dot(normal, normal);
+
+				if (denominator <= 1e-12 * Dot(ab, ab) * Dot(ac, ac))
+				{
+					const SphereD candidates[3] = { Diameter(a, b), Diameter(a, c), Diameter(b, c) };
+					const SphereD* largest = &candidates[0];
+					for (const SphereD& candidate : candidates) { largest = candidate.radiusSquared > largest->radiusSquared ? &candidate : largest; }
+					return *largest;
+				}
+
+				const PointD first = Cross(normal, ab), second = Cross(ac, normal);
+				const double abLength = Dot(ab, ab), acLength = Dot(ac, ac);
+				const PointD offset = { (acLength * first.x + abLength * second.x) / denominator, (acLength * first.y + abLength * second.y) / denominator, (acLength * first.z + abLength * second.z) / denominator };
+				return SphereAround(a, offset);
+			}
+
+			// Smallest sphere with all four points on or inside it , used when they are (nearly) coplanar
+			SphereD SmallestOfFour(const PointD (&points)[4])
+			{
+				SphereD best = { { 0.0, 0.0, 0.0 }, -1.0 };
+
+				auto consider = [&](const SphereD& candidate)
+				{
+					if (best.radiusSquared >= 0.0 && candidate.radiusSquared >= best.radiusSquared) { return; }
+					for (const PointD& point : points) { if (!Contains(candidate, point)) { return; } }
+					best = candidate;
+				};
+
+				for (int i = 0; i < 4; ++i)
+				{
+					for (int j = i + 1; j < 4; ++j)
+					{
+						consider(Diameter(points[i], points[j]));
+						for (int k = j + 1; k < 4; ++k) { consider(Circumsphere(points[i], points[j], points[k])); }
+					}
+				}
+
+				return best;
+			}
+
+			// Sphere through four points , falls back to SmallestOfFour when they are coplanar
+			SphereD Circumsphere(const PointD& a, const PointD& b, const PointD& c, const PointD& d)
+			{
+				const PointD ab = Subtract(b, a), ac = Subtract(c, a), ad = Subtract(d, a);
+				const PointD bc = Cross(ac, ad), ca = Cross(ad, ab), cb = Cross(ab, ac);
+				const double determinant = 2.0 * Dot(ab, bc);
+				const double scale = std::sqrt(Dot(ab, ab) * Dot(ac, ac) * Dot(ad, ad));
+
+				if (std::abs(determinant) <= 1e-9 * scale)
+				{
+					const PointD points[4] = { a, b, c, d };
+					return SmallestOfFour(points);
+				}
+
+				const double abLength = Dot(ab, ab), acLength = Dot(ac, ac), adLength = Dot(ad, ad);
+				const PointD offset = {
+					(abLength * bc.x + acLength * ca.x + adLength * cb.x) / determinant,
+					(abLength * bc.y + acLength * ca.y + adLength * cb.y) / determinant,
+					(abLength * bc.z + acLength * ca.z + adLength * cb.z) / determinant };
+				return SphereAround(a, offset);
+			}
+
+			BoundingSphere BuildSphereExact(const PointStream& stream)
+			{
+				if (stream.count == 0) { return BoundingSphere(Vector3(0.0f, 0.0f, 0.0f), 0.0f); }
+
+				std::vector<PointD> points(stream.count);
+				for (size_t index = 0; index < stream.count; ++index)
+				{
+					const Vector3 point = stream.Get(index);
+					points[index] = { point.x, point.y, point.z };
+				}
+
+				// Random order is what makes Welzl expected linear , a fixed seed keeps the result reproducible
+				RandomGenerator random(DEFAULTRANDOMSEED);
+				for (size_t index = points.size() - 1; index > 0; --index)
+				{
+					const uint64_t wide = (static_cast<uint64_t>(random.NextUInt()) << 32) | random.NextUInt();
+					std::swap(points[index], points[static_cast<size_t>(wide % (index + 1))]);
+				}
+
+				// Each nesting level pins one more point to the surface
+				SphereD sphere = SphereAround(points[0], { 0.0, 0.0, 0.0 });
+				for (size_t i = 1; i < points.size(); ++i)
+				{
+					if (Contains(sphere, points[i])) { continue; }
+
+					sphere = SphereAround(points[i], { 0.0, 0.0, 0.0 });
+					for (size_t j = 0; j < i; ++j)
+					{
+						if (Contains(sphere, points[j])) { continue; }
+
+						sphere = Diameter(points[i], points[j]);
+						for (size_t k = 0; k < j; ++k)
+						{
+							if (Contains(sphere, points[k])) { continue; }
+
+							sphere = Circumsphere(points[i], points[j], points[k]);
+							for (size_t l = 0; l < k; ++l)
+							{
+								if (Contains(sphere, points[l])) { continue; }
+
+								sphere = Circumsphere(points[i], points[j], points[k], points[l]);
+							}
+						}
+					}
+				}
+
+				// One last sweep at float precision so the rounded center still encloses every point
+				const Vector3 center(static_cast<float>(sphere.center[0]), static_cast<float>(sphere.center[1]), static_cast<float>(sphere.center[2]));
+				const FarthestPoint farthest = Farthest(stream, center);
+
+				return BoundingSphere(center, std::sqrt(farthest.distanceSquared));
+			}
+
+			// ===================== ORIENTED BOX =========================
+
+			inline static constexpr int JACOBISWEEPS = 32;
+
+			/// <summary>
+			/// Cyclic Jacobi on a symmetric 3x3 , the columns of outVectors end up as the eigenvectors
+			/// </summary>
+			void SymmetricEigenvectors(double (&matrix)[3][3], double (&outVectors)[3][3])
+			{
+				for (int row = 0; row < 3; ++row)
+				{
+					for (int column = 0; column < 3; ++column) { outVectors[row][column] = row == column ? 1.0 : 0.0; }
+				}
+
+				const double scale = matrix[0][0] * matrix[0][0] + matrix[1][1] * matrix[1][1] + matrix[2][2] * matrix[2][2];
+
+				for (int sweep = 0; sweep < JACOBISWEEPS; ++sweep)
+				{
+					const double offDiagonal = matrix[0][1] * matrix[0][1] + matrix[0][2] * matrix[0][2] + matrix[1][2] * matrix[1][2];
+					if (offDiagonal <= 1e-24 * scale) { break; }
+
+					static constexpr int PAIRS[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+					for (const auto& pair : PAIRS)
+					{
+						const int p = pair[0], q = pair[1];
+						if (matrix[p][q] == 0.0) { continue; }
+
+						const double theta = (matrix[q][q] - matrix[p][p]) / (2.0 * matrix[p][q]);
+						const double tangent = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+						const double cosine = 1.0 / std::sqrt(tangent * tangent + 1.0);
+						const double sine = tangent * cosine;
+
+						for (int k = 0; k < 3; ++k)
+						{
+							const double kp = matrix[k][p], kq = matrix[k][q];
+							matrix[k][p] = cosine * kp - sine * kq;
+							matrix[k][q] = sine * kp + cosine * kq;
+						}
+						for (int k = 0; k < 3; ++k)
+						{
+							const double pk = matrix[p][k], qk = matrix[q][k];
+							matrix[p][k] = cosine * pk - sine * qk;
+							matrix[q][k] = sine * pk + cosine * qk;
+						}
+						for (int k = 0; k < 3; ++k)
+						{
+							const double kp = outVectors[k][p], kq = outVectors[k][q];
+							outVectors[k][p] = cosine * kp - sine * kq;
+							outVectors[k][q] = sine * kp + cosine * kq;
+						}
+					}
+				}
+			}
+
+			BoundingOrientedBox BuildOrientedBox(const PointStream& stream)
+			{
+				const XMFLOAT4 identity(0.0f, 0.0f, 0.0f, 1.0f);
+				if (stream.count == 0) { return BoundingOrientedBox(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f), identity); }
+
+				// Moments about the first point rather than the world origin keep the float sums well conditioned
+				const Vector3 origin = stream.Get(0);
+				const PointMoments moments = Moments(stream, origin);
+				const double inverseCount = 1.0 / static_cast<double>(stream.count);
+
+				const double mean[3] = { moments.sums[0] * inverseCount, moments.sums[1] * inverseCount, moments.sums[2] * inverseCount };
+				double covariance[3][3];
+				covariance[0][0] = moments.sums[3] * inverseCount - mean[0] * mean[0];
+				covariance[0][1] = covariance[1][0] = moments.sums[4] * inverseCount - mean[0] * mean[1];
+				covariance[0][2] = covariance[2][0] = moments.sums[5] * inverseCount - mean[0] * mean[2];
+				covariance[1][1] = moments.sums[6] * inverseCount - mean[1] * mean[1];
+				covariance[1][2] = covariance[2][1] = moments.sums[7] * inverseCount - mean[1] * mean[2];
+				covariance[2][2] = moments.sums[8] * inverseCount - mean[2] * mean[2];
+
+				double vectors[3][3];
+				SymmetricEigenvectors(covariance, vectors);
+
+				// Rows of a rotation matrix : the first two eigenvectors and their cross product , so the basis stays right handed
+				float axes[9];
+				for (int row = 0; row < 2; ++row)
+				{
+					const double length = std::sqrt(vectors[0][row] * vectors[0][row] + vectors[1][row] * vectors[1][row] + vectors[2][row] * vectors[2][row]);
+					for (int component = 0; component < 3; ++component) { axes[row * 3 + component] = static_cast<float>(vectors[component][row] / length); }
+				}
+				axes[6] = axes[1] * axes[5] - axes[2] * axes[4];
+				axes[7] = axes[2] * axes[3] - axes[0] * axes[5];
+				axes[8] = axes[0] * axes[4] - axes[1] * axes[3];
+
+				const Extents projected = Project(stream, axes);
+				const Extents aligned = MinMax(stream);
+
+				double orientedVolume = 1.0, alignedVolume = 1.0;
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					orientedVolume *= static_cast<double>(projected.maximum[axis]) - projected.minimum[axis];
+					alignedVolume *= static_cast<double>(aligned.maximum[axis]) - aligned.minimum[axis];
+				}
+
+				if (alignedVolume <= orientedVolume)
+				{
+					const BoundingBox box = BoxFromExtents(aligned);
+					return BoundingOrientedBox(box.Center, box.Extents, identity);
+				}
+
+				Vector3 center(0.0f, 0.0f, 0.0f);
+				Vector3 extents;
+				float* const extent = &extents.x;
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					const float middle = 0.5f * (projected.minimum[axis] + projected.maximum[axis]);
+					center += Vector3(axes[axis * 3], axes[axis * 3 + 1], axes[axis * 3 + 2]) * middle;
+					extent[axis] = 0.5f * (projected.maximum[axis] - projected.minimum[axis]);
+				}
+
+				const XMMATRIX rotation = XMMATRIX(axes[0], axes[1], axes[2], 0.0f, axes[3], axes[4], axes[5], 0.0f, axes[6], axes[7], axes[8], 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+				XMFLOAT4 orientation;
+				XMStoreFloat4(&orientation, XMQuaternionNormalize(XMQuaternionRotationMatrix(rotation)));
+
+				return BoundingOrientedBox(center, extents, orientation);
+			}
+
+			// ===================== RANGES =========================
+
+			/// <summary>
+			/// Calls build(stream) for every range across the job system. Indexed ranges are gathered into a per slice scratch copy first
+			/// </summary>
+			template <typename Volume, typename Build>
+			void BuildRanges(const Vector3* points, size_t stride, const BoundsRange* ranges, size_t rangeCount, Volume* outVolumes, const uint32_t* indices, Build build)
+			{
+				const uint8_t* const bytes = reinterpret_cast<const uint8_t*>(points);
+
+				Jobs::JobSystem::ParallelFor(rangeCount, BOUNDS_RANGEGRAIN, [&](size_t begin, size_t end)
+				{
+					std::vector<Vector3> scratch;
+
+					for (size_t index = begin; index < end; ++index)
+					{
+						const BoundsRange& range = ranges[index];
+						PointStream stream;
+						stream.count = range.count;
+
+						if (indices == nullptr)
+						{
+							stream.data = bytes + static_cast<size_t>(range.first) * stride;
+							stream.stride = stride;
+						}
+						else
+						{
+							scratch.resize(range.count);
+							for (uint32_t point = 0; point < range.count; ++point)
+							{
+								std::memcpy(&scratch[point].x, bytes + static_cast<size_t>(indices[range.first + point]) * stride, sizeof(float) * 3);
+							}
+							stream.data = reinterpret_cast<const uint8_t*>(scratch.data());
+							stream.stride = sizeof(Vector3);
+						}
+
+						outVolumes[index] = build(stream);
+					}
+				});
+			}
+
+			PointStream MakeStream(const Vector3* points, size_t count, size_t stride)
+			{
+				PointStream stream;
+				stream.data = reinterpret_cast<const uint8_t*>(points);
+				stream.count = count;
+				stream.stride = stride;
+				return stream;
+			}
+
+			// ===================== SELF TEST =========================
+
+			// Below every kernel width , a few blocks plus a tail , and past the parallel threshold , all odd
+			inline static constexpr size_t VERIFYCOUNTS[] = { 1, 3, 7, 17, 1021, BOUNDS_PARALLELTHRESHOLD + 37 };
+
+			// Packed Vector3s and an interleaved vertex (position , normal , uv)
+			inline static constexpr size_t VERIFYSTRIDES[] = { sizeof(Vector3), 32 };
+
+			// Relative slack for the containment tests , the kernels' FMA rounding differs from the scalar distances here
+			inline static constexpr float VERIFYTOLERANCE = 1.0e-5f;
+
+			bool VerifyCase(size_t count, size_t stride)
+			{
+				// An elongated , rotated cloud away from the origin , so the oriented box isn't just the axis aligned one.
+				// The buffer ends right after the last point's 12 bytes , a kernel reading past it shows up under ASan
+				std::vector<uint8_t> buffer((count - 1) * stride + sizeof(Vector3));
+				std::vector<Vector3> points(count);
+
+				RandomGenerator random(DEFAULTRANDOMSEED, count * 64 + stride);
+				const XMVECTOR rotation = XMQuaternionRotationRollPitchYaw(0.3f, 0.7f, -0.4f);
+				for (size_t index = 0; index < count; ++index)
+				{
+					const XMVECTOR local = XMVectorSet(random.Range(-40.0f, 40.0f), random.Range(-5.0f, 5.0f), random.Range(-1.0f, 1.0f), 0.0f);
+					XMStoreFloat3(&points[index], XMVectorAdd(XMVector3Rotate(local, rotation), XMVectorSet(100.0f, -50.0f, 20.0f, 0.0f)));
+					std::memcpy(buffer.data() + index * stride, &points[index].x, sizeof(Vector3));
+				}
+
+				const Vector3* const data = reinterpret_cast<const Vector3*>(buffer.data());
+
+				BoundingBox expected;
+				BoundingBox::CreateFromPoints(expected, count, data, stride);
+				const BoundingBox box = ComputeBoundingBox(data, count, stride);
+
+				if (box.Center.x != expected.Center.x || box.Center.y != expected.Center.y || box.Center.z != expected.Center.z ||
+					box.Extents.x != expected.Extents.x || box.Extents.y != expected.Extents.y || box.Extents.z != expected.Extents.z)
+				{
+					LOG_ERROR("Bounds self test ({0} points , stride {1}) : box ({2} , {3} , {4}) / ({5} , {6} , {7}) , CreateFromPoints gives ({8} , {9} , {10}) / ({11} , {12} , {13})",
+						count, stride, box.Center.x, box.Center.y, box.Center.z, box.Extents.x, box.Extents.y, box.Extents.z,
+						expected.Center.x, expected.Center.y, expected.Center.z, expected.Extents.x, expected.Extents.y, expected.Extents.z);
+					return false;
+				}
+
+				const BoundingSphere sphere = ComputeBoundingSphere(data, count, stride);
+				const BoundingSphere exact = ComputeBoundingSphereExact(data, count, stride);
+
+				if (!(exact.Radius <= sphere.Radius * (1.0f + VERIFYTOLERANCE)))
+				{
+					LOG_ERROR("Bounds self test ({0} points , stride {1}) : minimal sphere radius {2} is larger than the fast one's {3}", count, stride, exact.Radius, sphere.Radius);
+					return false;
+				}
+
+				BoundingOrientedBox oriented = ComputeOrientedBoundingBox(data, count, stride);
+				const float slack = VERIFYTOLERANCE * (std::max(oriented.Extents.x, std::max(oriented.Extents.y, oriented.Extents.z)) + 1.0f);
+				oriented.Extents = XMFLOAT3(oriented.Extents.x + slack, oriented.Extents.y + slack, oriented.Extents.z + slack);
+
+				for (size_t index = 0; index < count; ++index)
+				{
+					const Vector3& point = points[index];
+
+					for (const BoundingSphere* candidate : { &sphere, &exact })
+					{
+						const float distance = Vector3::Distance(point, Vector3(candidate->Center));
+						if (!(distance <= candidate->Radius * (1.0f + VERIFYTOLERANCE) + VERIFYTOLERANCE))
+						{
+							LOG_ERROR("Bounds self test ({0} points , stride {1}) : point {2} lies {3} from the {4} sphere's center , radius {5}",
+								count, stride, index, distance, candidate == &sphere ? "fast" : "minimal", candidate->Radius);
+							return false;
+						}
+					}
+
+					if (oriented.Contains(XMLoadFloat3(&point)) == DISJOINT)
+					{
+						LOG_ERROR("Bounds self test ({0} points , stride {1}) : point {2} lies outside the oriented box", count, stride, index);
+						return false;
+					}
+				}
+
+				return true;
+			}
+		}
+
+		BoundingBox ComputeBoundingBox(const Vector3* points, size_t count, size_t stride)
+		{
+			return BuildBox(MakeStream(points, count, stride));
+		}
+
+		BoundingSphere ComputeBoundingSphere(const Vector3* points, size_t count, size_t stride)
+		{
+			return BuildSphere(MakeStream(points, count, stride));
+		}
+
+		BoundingSphere ComputeBoundingSphereExact(const Vector3* points, size_t count, size_t stride)
+		{
+			return BuildSphereExact(MakeStream(points, count, stride));
+		}
+
+		BoundingOrientedBox ComputeOrientedBoundingBox(const Vector3* points, size_t count, size_t stride)
+		{
+			return BuildOrientedBox(MakeStream(points, count, stride));
+		}
+
+		void ComputeBoundingBoxes(const Vector3* points, size_t stride, const BoundsRange* ranges, size_t rangeCount, BoundingBox* outBoxes, const uint32_t* indices)
+		{
+			BuildRanges(points, stride, ranges, rangeCount, outBoxes, indices, [](const PointStream& stream) { return BuildBox(stream); });
+		}
+
+		void ComputeBoundingSpheres(const Vector3* points, size_t stride, const BoundsRange* ranges, size_t rangeCount, BoundingSphere* outSpheres, const uint32_t* indices)
+		{
+			BuildRanges(points, stride, ranges, rangeCount, outSpheres, indices, [](const PointStream& stream) { return BuildSphere(stream); });
+		}
+
+		void ComputeOrientedBoundingBoxes(const Vector3* points, size_t stride, const BoundsRange* ranges, size_t rangeCount, BoundingOrientedBox* outBoxes, const uint32_t* indices)
+		{
+			BuildRanges(points, stride, ranges, rangeCount, outBoxes, indices, [](const PointStream& stream) { return BuildOrientedBox(stream); });
+		}
+
+		bool VerifyBounds()
+		{
+			bool passed = true;
+
+			for (size_t stride : VERIFYSTRIDES)
+			{
+				for (size_t count : VERIFYCOUNTS) { passed &= VerifyCase(count, stride); }
+			}
+
+			return passed;
+		}
+	}
+}
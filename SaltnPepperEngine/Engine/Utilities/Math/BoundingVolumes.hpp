@@ -0,0 +1,87 @@
+#ifndef BOUNDINGVOLUMES_H
+#define BOUNDINGVOLUMES_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Point arrays with at least this many points get split across the job system
+		/// </summary>
+		inline static constexpr size_t BOUNDS_PARALLELTHRESHOLD = 1 << 16;
+
+		/// <summary>
+		/// Points per job slice. Partial results are combined in slice order , so the result doesn't depend on the worker count
+		/// </summary>
+		inline static constexpr size_t BOUNDS_PARALLELGRAIN = 1 << 14;
+
+		/// <summary>
+		/// Ranges per job slice for the many small volumes builders
+		/// </summary>
+		inline static constexpr size_t BOUNDS_RANGEGRAIN = 64;
+
+		/// <summary>
+		/// Growth passes the fast sphere runs before it falls back to just enclosing the farthest point
+		/// </summary>
+		inline static constexpr uint32_t BOUNDS_SPHEREITERATIONS = 16;
+
+		/// <summary>
+		/// A run of points (meshlet , cluster , skinned submesh) for the many volumes builders.
+		/// Indexes straight into the point array , or into the index array when one is given
+		/// </summary>
+		struct BoundsRange
+		{
+			uint32_t first = 0;
+			uint32_t count = 0;
+		};
+
+		// Every builder reads count Vector3s starting at points , stride bytes apart (>= 12 , so interleaved vertex buffers work in place),
+		// the same layout BoundingBox::CreateFromPoints takes. An empty input gives an empty volume at the origin.
+
+		/// <summary>
+		/// Axis aligned box around the points (same result as BoundingBox::CreateFromPoints)
+		/// </summary>
+		SNP_API BoundingBox ComputeBoundingBox(const Vector3* points, size_t count, size_t stride = sizeof(Vector3));
+
+		/// <summary>
+		/// Fast enclosing sphere , Ritter's method : start from a far apart pair , then keep growing towards the farthest outside point.
+		/// Every pass is one vectorized parallel sweep. Typically within 5 - 20 % of the minimal radius
+		/// </summary>
+		SNP_API BoundingSphere ComputeBoundingSphere(const Vector3* points, size_t count, size_t stride = sizeof(Vector3));
+
+		/// <summary>
+		/// Minimal enclosing sphere (Welzl , iterative move to front form over a shuffled copy). Expected linear time but single threaded ,
+		/// meant for asset import rather than per frame use
+		/// </summary>
+		SNP_API BoundingSphere ComputeBoundingSphereExact(const Vector3* points, size_t count, size_t stride = sizeof(Vector3));
+
+		/// <summary>
+		/// Oriented box along the principal axes of the points (covariance + Jacobi eigen solve).
+		/// Falls back to the axis aligned box when that one is smaller , which PCA can't promise on its own
+		/// </summary>
+		SNP_API BoundingOrientedBox ComputeOrientedBoundingBox(const Vector3* points, size_t count, size_t stride = sizeof(Vector3));
+
+
+		// ================= MANY SMALL VOLUMES ======================
+		// One volume per range , the ranges are spread across the job system. indices (optional) maps range entries to points ,
+		// e.g. meshlet vertex lists. Ranges are independent so they may overlap or come in any order
+
+		SNP_API void ComputeBoundingBoxes(const Vector3* points, size_t stride, const BoundsRange* ranges, size_t rangeCount, BoundingBox* outBoxes, const uint32_t* indices = nullptr);
+		SNP_API void ComputeBoundingSpheres(const Vector3* points, size_t stride, const BoundsRange* ranges, size_t rangeCount, BoundingSphere* outSpheres, const uint32_t* indices = nullptr);
+		SNP_API void ComputeOrientedBoundingBoxes(const Vector3* points, size_t stride, const BoundsRange* ranges, size_t rangeCount, BoundingOrientedBox* outBoxes, const uint32_t* indices = nullptr);
+
+
+		/// <summary>
+		/// Checks the active tier's kernels : ComputeBoundingBox against BoundingBox::CreateFromPoints , and that both spheres and the oriented box
+		/// enclose every point. Runs packed and interleaved (32 byte stride) points at odd counts , so the scalar tails and the parallel path are covered.
+		/// Logs and returns false on a mismatch
+		/// </summary>
+		SNP_API bool VerifyBounds();
+	}
+}
+
+#endif // !BOUNDINGVOLUMES_H
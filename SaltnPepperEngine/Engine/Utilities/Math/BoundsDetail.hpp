@@ -0,0 +1,211 @@
+#ifndef BOUNDSDETAIL_H
+#define BOUNDSDETAIL_H
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// The bounding volume reductions written once against a lane type , instantiated by each MathKernels<Tier>.cpp.
+		/// Points are Vector3s read through a byte stride (>= 12) , so interleaved vertex buffers work without a copy.
+		/// A lane type provides Float / Int / Mask , WIDTH and : Set , SetInt , Load , Store , StoreInt , Add , Sub , Mul , MulAdd (a * b + c) ,
+		/// Min , Max , Greater , Select (mask ? a : b) , IntAdd , IntSelect , LaneIndices (0 , 1 , ... WIDTH - 1) and LoadPoints (WIDTH strided points transposed to x / y / z).
+		/// LoadPoints may read 16 bytes per point , so the vector loops stop one block early and the last point always goes through
+		/// the tail , that way nothing past the final point's 12 bytes is ever touched
+		/// </summary>
+		namespace BoundsDetail
+		{
+			/// <summary>
+			/// Stages the last 1 ... WIDTH points (the ones LoadPoints can't touch) as x / y / z lanes , unused lanes get pad
+			/// </summary>
+			template <typename L>
+			void LoadTail(const uint8_t* points, size_t remaining, size_t stride, const float* pad, typename L::Float& x, typename L::Float& y, typename L::Float& z)
+			{
+				float staged[3][L::WIDTH];
+				for (size_t lane = 0; lane < L::WIDTH; ++lane)
+				{
+					float point[3] = { pad[0], pad[1], pad[2] };
+					if (lane < remaining) { std::memcpy(point, points + lane * stride, sizeof(point)); }
+
+					staged[0][lane] = point[0];
+					staged[1][lane] = point[1];
+					staged[2][lane] = point[2];
+				}
+
+				x = L::Load(staged[0]);
+				y = L::Load(staged[1]);
+				z = L::Load(staged[2]);
+			}
+
+			/// <summary>
+			/// Runs visit(x , y , z , indices) over the points in blocks of WIDTH. The last 1 ... WIDTH points are broadcast one at a time
+			/// (every lane holds the same point and index) , which is harmless for min / max / farthest and avoids staging them through memory.
+			/// count must be non zero
+			/// </summary>
+			template <typename L, typename Visit>
+			void ForEachBlock(const uint8_t* points, size_t count, size_t stride, Visit visit)
+			{
+				typename L::Float x, y, z;
+
+				size_t index = 0;
+				for (; index + L::WIDTH < count; index += L::WIDTH)
+				{
+					L::LoadPoints(points + index * stride, stride, x, y, z);
+					visit(x, y, z, L::IntAdd(L::LaneIndices(), L::SetInt(static_cast<int32_t>(index))));
+				}
+
+				for (; index < count; ++index)
+				{
+					float point[3];
+					std::memcpy(point, points + index * stride, sizeof(point));
+					visit(L::Set(point[0]), L::Set(point[1]), L::Set(point[2]), L::SetInt(static_cast<int32_t>(index)));
+				}
+			}
+
+			template <typename L>
+			void ReduceMinMax(const typename L::Float (&minimum)[3], const typename L::Float (&maximum)[3], float* outMinimum, float* outMaximum)
+			{
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					float lowest[L::WIDTH], highest[L::WIDTH];
+					L::Store(lowest, minimum[axis]);
+					L::Store(highest, maximum[axis]);
+
+					outMinimum[axis] = lowest[0];
+					outMaximum[axis] = highest[0];
+					for (size_t lane = 1; lane < L::WIDTH; ++lane)
+					{
+						outMinimum[axis] = lowest[lane] < outMinimum[axis] ? lowest[lane] : outMinimum[axis];
+						outMaximum[axis] = highest[lane] > outMaximum[axis] ? highest[lane] : outMaximum[axis];
+					}
+				}
+			}
+
+			// Ties keep the lowest index , so the answer doesn't depend on the lane width or how the range was sliced
+			template <typename L>
+			void Farthest(const uint8_t* points, size_t count, size_t stride, const float* center, float* outDistanceSquared, size_t* outIndex)
+			{
+				using Float = typename L::Float;
+				using Int = typename L::Int;
+
+				const Float centerX = L::Set(center[0]), centerY = L::Set(center[1]), centerZ = L::Set(center[2]);
+
+				Float best = L::Set(-1.0f);
+				Int bestIndex = L::SetInt(0);
+
+				ForEachBlock<L>(points, count, stride, [&](Float x, Float y, Float z, Int indices)
+				{
+					x = L::Sub(x, centerX);
+					y = L::Sub(y, centerY);
+					z = L::Sub(z, centerZ);
+					const Float distance = L::MulAdd(z, z, L::MulAdd(y, y, L::Mul(x, x)));
+
+					const typename L::Mask farther = L::Greater(distance, best);
+					best = L::Select(farther, distance, best);
+					bestIndex = L::IntSelect(farther, indices, bestIndex);
+				});
+
+				float distances[L::WIDTH];
+				int32_t indices[L::WIDTH];
+				L::Store(distances, best);
+				L::StoreInt(indices, bestIndex);
+
+				float result = distances[0];
+				size_t resultIndex = static_cast<size_t>(indices[0]);
+				for (size_t lane = 1; lane < L::WIDTH; ++lane)
+				{
+					const size_t candidate = static_cast<size_t>(indices[lane]);
+					if (distances[lane] > result || (distances[lane] == result && candidate < resultIndex))
+					{
+						result = distances[lane];
+						resultIndex = candidate;
+					}
+				}
+
+				*outDistanceSquared = result;
+				*outIndex = resultIndex;
+			}
+
+			// First and second moments about origin : x , y , z , xx , xy , xz , yy , yz , zz
+			template <typename L>
+			void Moments(const uint8_t* points, size_t count, size_t stride, const float* origin, double* outMoments)
+			{
+				using Float = typename L::Float;
+
+				const Float originX = L::Set(origin[0]), originY = L::Set(origin[1]), originZ = L::Set(origin[2]);
+
+				Float sums[9];
+				for (Float& sum : sums) { sum = L::Set(0.0f); }
+
+				auto accumulate = [&](Float x, Float y, Float z)
+				{
+					x = L::Sub(x, originX);
+					y = L::Sub(y, originY);
+					z = L::Sub(z, originZ);
+
+					sums[0] = L::Add(sums[0], x);
+					sums[1] = L::Add(sums[1], y);
+					sums[2] = L::Add(sums[2], z);
+					sums[3] = L::MulAdd(x, x, sums[3]);
+					sums[4] = L::MulAdd(x, y, sums[4]);
+					sums[5] = L::MulAdd(x, z, sums[5]);
+					sums[6] = L::MulAdd(y, y, sums[6]);
+					sums[7] = L::MulAdd(y, z, sums[7]);
+					sums[8] = L::MulAdd(z, z, sums[8]);
+				};
+
+				// Sums can't take broadcast points , the tail is staged instead with the origin as padding (adds exact zeros)
+				Float x, y, z;
+				size_t index = 0;
+				for (; index + L::WIDTH < count; index += L::WIDTH)
+				{
+					L::LoadPoints(points + index * stride, stride, x, y, z);
+					accumulate(x, y, z);
+				}
+
+				LoadTail<L>(points + index * stride, count - index, stride, origin, x, y, z);
+				accumulate(x, y, z);
+
+				for (int moment = 0; moment < 9; ++moment)
+				{
+					float lanes[L::WIDTH];
+					L::Store(lanes, sums[moment]);
+
+					outMoments[moment] = 0.0;
+					for (size_t lane = 0; lane < L::WIDTH; ++lane) { outMoments[moment] += lanes[lane]; }
+				}
+			}
+
+			// Extents of the points along three axes (axes holds them back to back , 9 floats)
+			template <typename L>
+			void Project(const uint8_t* points, size_t count, size_t stride, const float* axes, float* outMinimum, float* outMaximum)
+			{
+				using Float = typename L::Float;
+
+				Float axis[9];
+				for (int component = 0; component < 9; ++component) { axis[component] = L::Set(axes[component]); }
+
+				Float minimum[3] = { L::Set(FLT_MAX), L::Set(FLT_MAX), L::Set(FLT_MAX) };
+				Float maximum[3] = { L::Set(-FLT_MAX), L::Set(-FLT_MAX), L::Set(-FLT_MAX) };
+
+				ForEachBlock<L>(points, count, stride, [&](Float x, Float y, Float z, typename L::Int)
+				{
+					for (int row = 0; row < 3; ++row)
+					{
+						const Float projected = L::MulAdd(z, axis[row * 3 + 2], L::MulAdd(y, axis[row * 3 + 1], L::Mul(x, axis[row * 3])));
+						minimum[row] = L::Min(minimum[row], projected);
+						maximum[row] = L::Max(maximum[row], projected);
+					}
+				});
+
+				ReduceMinMax<L>(minimum, maximum, outMinimum, outMaximum);
+			}
+		}
+	}
+}
+
+#endif // !BOUNDSDETAIL_H
@@ -0,0 +1,383 @@
+#ifndef CONSTEXPRMATH_H
+#define CONSTEXPRMATH_H
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <array>
+#include <cstddef>
+#include <limits>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Math that can run at compile time (C++17 has no constexpr std::sqrt / std::sin).
+		/// Everything is evaluated in double and rounded to float once at the end , so baked values land within an ulp or two of the
+		/// runtime DirectXMath result. Meant for baking projections , basis tables , easing curves and LUTs into the binary ,
+		/// the functions work at runtime too but are slower than the std / XM versions.
+		/// Note : each table entry costs a few hundred constexpr steps , MSVC may need /constexpr:steps raised for tables over ~512 entries
+		/// </summary>
+		namespace Constexpr
+		{
+			inline static constexpr double PI_D = 3.14159265358979323846264338327950288;
+			inline static constexpr double TWOPI_D = 2.0 * PI_D;
+			inline static constexpr double HALFPI_D = 0.5 * PI_D;
+
+			// Newton / series iterations stop early once they stop changing , this is just a safety net
+			inline static constexpr int MAXITERATIONS = 256;
+
+			// ===================== SCALAR MATHS =========================
+
+			constexpr double Abs(double value)
+			{
+				return value < 0.0 ? -value : value;
+			}
+
+			/// <summary>
+			/// Square root by Newton iteration. Negative / NaN input gives NaN , same as std::sqrt
+			/// </summary>
+			constexpr double Sqrt(double value)
+			{
+				if (!(value >= 0.0)) { return std::numeric_limits<double>::quiet_NaN(); }
+				if (value == 0.0 || value == std::numeric_limits<double>::infinity()) { return value; }
+
+				// Start above the root so the sequence decreases monotonically , stop once it doesn't
+				double current = value > 1.0 ? value : 1.0;
+				for (int iteration = 0; iteration < MAXITERATIONS; ++iteration)
+				{
+					const double next = 0.5 * (current + value / current);
+					if (next >= current) { break; }
+					current = next;
+				}
+				return current;
+			}
+
+			constexpr float Sqrt(float value)
+			{
+				return static_cast<float>(Sqrt(static_cast<double>(value)));
+			}
+
+			/// <summary>
+			/// Wraps an angle in radians to [-PI , PI]. Exact enough for |angle| up to ~1e6 , past that double precision runs out
+			/// </summary>
+			constexpr double WrapAngle(double radians)
+			{
+				const double turns = radians / TWOPI_D;
+				const long long whole = static_cast<long long>(turns < 0.0 ? turns - 0.5 : turns + 0.5);
+				return radians - static_cast<double>(whole) * TWOPI_D;
+			}
+
+			/// <summary>
+			/// Sine by Taylor series after folding the angle into [-PI/2 , PI/2] (angle in radians)
+			/// </summary>
+			constexpr double Sin(double radians)
+			{
+				double x = WrapAngle(radians);
+				if (x > HALFPI_D) { x = PI_D - x; }
+				else if (x < -HALFPI_D) { x = -PI_D - x; }
+
+				const double squared = x * x;
+				double term = x;
+				double sum = x;
+
+				for (int index = 1; index < MAXITERATIONS; ++index)
+				{
+					term *= -squared / static_cast<double>((2 * index) * (2 * index + 1));
+					const double next = sum + term;
+					if (next == sum) { break; }
+					sum = next;
+				}
+				return sum;
+			}
+
+			/// <summary>
+			/// Cosine (angle in radians)
+			/// </summary>
+			constexpr double Cos(double radians)
+			{
+				return Sin(HALFPI_D - WrapAngle(radians));
+			}
+
+			/// <summary>
+			/// Tangent (angle in radians)
+			/// </summary>
+			constexpr double Tan(double radians)
+			{
+				return Sin(radians) / Cos(radians);
+			}
+
+			constexpr float Sin(float radians) { return static_cast<float>(Sin(static_cast<double>(radians))); }
+			constexpr float Cos(float radians) { return static_cast<float>(Cos(static_cast<double>(radians))); }
+			constexpr float Tan(float radians) { return static_cast<float>(Tan(static_cast<double>(radians))); }
+
+			// ===================== EASING =========================
+
+			/// <summary>
+			/// Hermite smoothstep , 3t^2 - 2t^3 with t clamped to [0 , 1]
+			/// </summary>
+			constexpr float SmoothStep(float t)
+			{
+				t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+				return t * t * (3.0f - 2.0f * t);
+			}
+
+			/// <summary>
+			/// Perlin's smootherstep , 6t^5 - 15t^4 + 10t^3 with t clamped to [0 , 1]
+			/// </summary>
+			constexpr float SmootherStep(float t)
+			{
+				t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+				return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+			}
+
+			/// <summary>
+			/// Sine ease in / out , t clamped to [0 , 1]
+			/// </summary>
+			constexpr float EaseInOutSine(float t)
+			{
+				t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+				return static_cast<float>(0.5 - 0.5 * Cos(PI_D * static_cast<double>(t)));
+			}
+
+			// ===================== VECTOR MATHS =========================
+
+			constexpr float Dot(const Vector3& vectorOne, const Vector3& vectorTwo)
+			{
+				return vectorOne.x * vectorTwo.x + vectorOne.y * vectorTwo.y + vectorOne.z * vectorTwo.z;
+			}
+
+			constexpr Vector3 Cross(const Vector3& vectorOne, const Vector3& vectorTwo)
+			{
+				return Vector3(vectorOne.y * vectorTwo.z - vectorOne.z * vectorTwo.y,
+							   vectorOne.z * vectorTwo.x - vectorOne.x * vectorTwo.z,
+							   vectorOne.x * vectorTwo.y - vectorOne.y * vectorTwo.x);
+			}
+
+			/// <summary>
+			/// Returns the unit vector , or zero for a zero length input (same as XMVector3Normalize)
+			/// </summary>
+			constexpr Vector3 Normalize(const Vector3& vector)
+			{
+				const double length = Sqrt(static_cast<double>(vector.x) * vector.x + static_cast<double>(vector.y) * vector.y + static_cast<double>(vector.z) * vector.z);
+				if (length == 0.0) { return Vector3(0.0f, 0.0f, 0.0f); }
+
+				return Vector3(static_cast<float>(vector.x / length), static_cast<float>(vector.y / length), static_cast<float>(vector.z / length));
+			}
+
+			// ===================== QUATERNION MATHS =========================
+
+			/// <summary>
+			/// Rotation of angle radians around axis , the axis doesn't need to be normalized (matches XMQuaternionRotationAxis)
+			/// </summary>
+			constexpr Quaternion QuaternionFromAxisAngle(const Vector3& axis, float radians)
+			{
+				const Vector3 unit = Normalize(axis);
+				const double halfAngle = 0.5 * static_cast<double>(radians);
+				const double sine = Sin(halfAngle);
+
+				return Quaternion(static_cast<float>(unit.x * sine), static_cast<float>(unit.y * sine), static_cast<float>(unit.z * sine), static_cast<float>(Cos(halfAngle)));
+			}
+
+			/// <summary>
+			/// Rotation by first followed by second (same order as XMQuaternionMultiply)
+			/// </summary>
+			constexpr Quaternion Multiply(const Quaternion& first, const Quaternion& second)
+			{
+				return Quaternion(second.w * first.x + second.x * first.w + second.y * first.z - second.z * first.y,
+								  second.w * first.y - second.x * first.z + second.y * first.w + second.z * first.x,
+								  second.w * first.z + second.x * first.y - second.y * first.x + second.z * first.w,
+								  second.w * first.w - second.x * first.x - second.y * first.y - second.z * first.z);
+			}
+
+			// ===================== MATRIX MATHS =========================
+			// Row vector convention like the rest of the engine : v' = v * M , translation in the fourth row.
+			// Elements are read through _11 ... _44 only , m[][] is the inactive union member and can't be read in a constant expression
+
+			/// <summary>
+			/// first * second (same as XMMatrixMultiply)
+			/// </summary>
+			constexpr Matrix Multiply(const Matrix& a, const Matrix& b)
+			{
+				return Matrix(
+					a._11 * b._11 + a._12 * b._21 + a._13 * b._31 + a._14 * b._41,
+					a._11 * b._12 + a._12 * b._22 + a._13 * b._32 + a._14 * b._42,
+					a._11 * b._13 + a._12 * b._23 + a._13 * b._33 + a._14 * b._43,
+					a._11 * b._14 + a._12 * b._24 + a._13 * b._34 + a._14 * b._44,
+
+					a._21 * b._11 + a._22 * b._21 + a._23 * b._31 + a._24 * b._41,
+					a._21 * b._12 + a._22 * b._22 + a._23 * b._32 + a._24 * b._42,
+					a._21 * b._13 + a._22 * b._23 + a._23 * b._33 + a._24 * b._43,
+					a._21 * b._14 + a._22 * b._24 + a._23 * b._34 + a._24 * b._44,
+
+					a._31 * b._11 + a._32 * b._21 + a._33 * b._31 + a._34 * b._41,
+					a._31 * b._12 + a._32 * b._22 + a._33 * b._32 + a._34 * b._42,
+					a._31 * b._13 + a._32 * b._23 + a._33 * b._33 + a._34 * b._43,
+					a._31 * b._14 + a._32 * b._24 + a._33 * b._34 + a._34 * b._44,
+
+					a._41 * b._11 + a._42 * b._21 + a._43 * b._31 + a._44 * b._41,
+					a._41 * b._12 + a._42 * b._22 + a._43 * b._32 + a._44 * b._42,
+					a._41 * b._13 + a._42 * b._23 + a._43 * b._33 + a._44 * b._43,
+					a._41 * b._14 + a._42 * b._24 + a._43 * b._34 + a._44 * b._44);
+			}
+
+			constexpr Matrix Transpose(const Matrix& matrix)
+			{
+				return Matrix(matrix._11, matrix._21, matrix._31, matrix._41,
+							  matrix._12, matrix._22, matrix._32, matrix._42,
+							  matrix._13, matrix._23, matrix._33, matrix._43,
+							  matrix._14, matrix._24, matrix._34, matrix._44);
+			}
+
+			constexpr Matrix Translation(const Vector3& position)
+			{
+				return Matrix(1.0f, 0.0f, 0.0f, 0.0f,
+							  0.0f, 1.0f, 0.0f, 0.0f,
+							  0.0f, 0.0f, 1.0f, 0.0f,
+							  position.x, position.y, position.z, 1.0f);
+			}
+
+			constexpr Matrix Scale(const Vector3& scale)
+			{
+				return Matrix(scale.x, 0.0f, 0.0f, 0.0f,
+							  0.0f, scale.y, 0.0f, 0.0f,
+							  0.0f, 0.0f, scale.z, 0.0f,
+							  0.0f, 0.0f, 0.0f, 1.0f);
+			}
+
+			/// <summary>
+			/// Rotation matrix from a unit quaternion (same as XMMatrixRotationQuaternion)
+			/// </summary>
+			constexpr Matrix RotationQuaternion(const Quaternion& rotation)
+			{
+				const float xx = rotation.x * rotation.x, yy = rotation.y * rotation.y, zz = rotation.z * rotation.z;
+				const float xy = rotation.x * rotation.y, xz = rotation.x * rotation.z, yz = rotation.y * rotation.z;
+				const float wx = rotation.w * rotation.x, wy = rotation.w * rotation.y, wz = rotation.w * rotation.z;
+
+				return Matrix(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f,
+							  2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f,
+							  2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f,
+							  0.0f, 0.0f, 0.0f, 1.0f);
+			}
+
+			/// <summary>
+			/// Scale * Rotation * Translation , the same composition as Transform::GetlocalMatrix
+			/// </summary>
+			constexpr Matrix AffineTransformation(const Vector3& scale, const Quaternion& rotation, const Vector3& position)
+			{
+				return Multiply(Multiply(Scale(scale), RotationQuaternion(rotation)), Translation(position));
+			}
+
+			/// <summary>
+			/// Left handed perspective projection , depth mapped to [0 , 1] (same as XMMatrixPerspectiveFovLH)
+			/// </summary>
+			constexpr Matrix PerspectiveFovLH(float fovY, float aspectRatio, float nearZ, float farZ)
+			{
+				const double halfFov = 0.5 * static_cast<double>(fovY);
+				const float height = static_cast<float>(Cos(halfFov) / Sin(halfFov));
+				const float width = height / aspectRatio;
+				const float range = farZ / (farZ - nearZ);
+
+				return Matrix(width, 0.0f, 0.0f, 0.0f,
+							  0.0f, height, 0.0f, 0.0f,
+							  0.0f, 0.0f, range, 1.0f,
+							  0.0f, 0.0f, -range * nearZ, 0.0f);
+			}
+
+			/// <summary>
+			/// Right handed perspective projection , depth mapped to [0 , 1] (same as XMMatrixPerspectiveFovRH)
+			/// </summary>
+			constexpr Matrix PerspectiveFovRH(float fovY, float aspectRatio, float nearZ, float farZ)
+			{
+				const double halfFov = 0.5 * static_cast<double>(fovY);
+				const float height = static_cast<float>(Cos(halfFov) / Sin(halfFov));
+				const float width = height / aspectRatio;
+				const float range = farZ / (nearZ - farZ);
+
+				return Matrix(width, 0.0f, 0.0f, 0.0f,
+							  0.0f, height, 0.0f, 0.0f,
+							  0.0f, 0.0f, range, -1.0f,
+							  0.0f, 0.0f, range * nearZ, 0.0f);
+			}
+
+			/// <summary>
+			/// Left handed orthographic projection , depth mapped to [0 , 1] (same as XMMatrixOrthographicLH)
+			/// </summary>
+			constexpr Matrix OrthographicLH(float viewWidth, float viewHeight, float nearZ, float farZ)
+			{
+				const float range = 1.0f / (farZ - nearZ);
+
+				return Matrix(2.0f / viewWidth, 0.0f, 0.0f, 0.0f,
+							  0.0f, 2.0f / viewHeight, 0.0f, 0.0f,
+							  0.0f, 0.0f, range, 0.0f,
+							  0.0f, 0.0f, -range * nearZ, 1.0f);
+			}
+
+			/// <summary>
+			/// Right handed orthographic projection , depth mapped to [0 , 1] (same as XMMatrixOrthographicRH)
+			/// </summary>
+			constexpr Matrix OrthographicRH(float viewWidth, float viewHeight, float nearZ, float farZ)
+			{
+				const float range = 1.0f / (nearZ - farZ);
+
+				return Matrix(2.0f / viewWidth, 0.0f, 0.0f, 0.0f,
+							  0.0f, 2.0f / viewHeight, 0.0f, 0.0f,
+							  0.0f, 0.0f, range, 0.0f,
+							  0.0f, 0.0f, range * nearZ, 1.0f);
+			}
+
+			// ===================== LOOKUP TABLES =========================
+
+			/// <summary>
+			/// Builds a table of Count entries from generator(index). Use with a constexpr lambda , e.g.
+			/// constexpr auto ease = MakeTable<64>([](size_t i) { return SmoothStep(i / 63.0f); });
+			/// </summary>
+			template <size_t Count, typename Generator>
+			constexpr auto MakeTable(Generator generator)
+			{
+				std::array<decltype(generator(size_t(0))), Count> table{};
+				for (size_t index = 0; index < Count; ++index)
+				{
+					table[index] = generator(index);
+				}
+				return table;
+			}
+
+			/// <summary>
+			/// Sine over one full turn , entry i = sin(i * 2PI / Count)
+			/// </summary>
+			template <size_t Count>
+			constexpr std::array<float, Count> MakeSinTable()
+			{
+				return MakeTable<Count>([](size_t index) { return static_cast<float>(Sin(TWOPI_D * static_cast<double>(index) / static_cast<double>(Count))); });
+			}
+
+			/// <summary>
+			/// Easing curve sampled at Count evenly spaced points over [0 , 1] , both ends included
+			/// </summary>
+			template <size_t Count, typename Curve>
+			constexpr std::array<float, Count> MakeCurveTable(Curve curve)
+			{
+				static_assert(Count > 1, "A curve table needs both end points");
+				return MakeTable<Count>([curve](size_t index) { return static_cast<float>(curve(static_cast<float>(index) / static_cast<float>(Count - 1))); });
+			}
+
+			// ===================== COMPILE TIME CHECKS =========================
+
+			namespace ConstexprDetail
+			{
+				constexpr bool Near(double value, double expected, double tolerance)
+				{
+					return Abs(value - expected) <= tolerance;
+				}
+			}
+
+			static_assert(ConstexprDetail::Near(Sqrt(2.0), 1.41421356237309505, 1e-15), "Constexpr Sqrt drifted");
+			static_assert(ConstexprDetail::Near(Sqrt(1e-6), 1e-3, 1e-18), "Constexpr Sqrt drifted");
+			static_assert(ConstexprDetail::Near(Sin(1.0), 0.841470984807896507, 1e-15), "Constexpr Sin drifted");
+			static_assert(ConstexprDetail::Near(Sin(-100.0), 0.506365641109758794, 1e-13), "Constexpr Sin drifted");
+			static_assert(ConstexprDetail::Near(Cos(2.5), -0.801143615546933609, 1e-15), "Constexpr Cos drifted");
+			static_assert(Multiply(IDENTITYMATRIX, Translation(Vector3(1.0f, 2.0f, 3.0f)))._42 == 2.0f, "Constexpr Multiply broke");
+		}
+	}
+}
+
+#endif // !CONSTEXPRMATH_H
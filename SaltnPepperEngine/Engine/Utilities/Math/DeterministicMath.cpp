@@ -0,0 +1,123 @@
+#include "DeterministicMath.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <limits>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace Deterministic
+		{
+			// The edges that used to be UB : out of range / non finite floats and wrapping adds
+			static_assert(Fixed::FromFloat(std::numeric_limits<float>::quiet_NaN()).raw == 0, "NaN converts to 0");
+			static_assert(Fixed::FromFloat(std::numeric_limits<float>::infinity()).raw == INT32_MAX, "Infinity saturates");
+			static_assert(Fixed::FromFloat(-std::numeric_limits<float>::infinity()).raw == INT32_MIN, "Infinity saturates");
+			static_assert(Fixed::FromFloat(1.0e20f).raw == INT32_MAX && Fixed::FromFloat(-1.0e20f).raw == INT32_MIN, "Out of range saturates");
+			static_assert(Fixed::FromFloat(-1.5f).raw == -Fixed::ONE - Fixed::ONE / 2, "In range values round to nearest");
+			static_assert((Fixed::FromRaw(INT32_MAX) + Fixed::FromRaw(1)).raw == INT32_MIN, "Addition wraps");
+			static_assert((Fixed::FromRaw(INT32_MIN) - Fixed::FromRaw(1)).raw == INT32_MAX, "Subtraction wraps");
+			static_assert((-Fixed::FromRaw(INT32_MIN)).raw == INT32_MIN, "Negation wraps");
+
+			namespace
+			{
+				inline static constexpr int BODYCOUNT = 64;
+				inline static constexpr int STEPCOUNT = 240;
+
+				struct TestBody
+				{
+					FixedVector3 position;
+					FixedVector3 velocity;
+					FixedQuaternion rotation;
+					FixedVector3 spinAxis;
+					Fixed spinSpeed;
+				};
+
+				// Integer LCG , so the inputs themselves never touch floating point
+				struct TestRandom
+				{
+					uint32_t state;
+
+					Fixed Next(int32_t minRaw, int32_t maxRaw)
+					{
+						state = state * 1664525u + 1013904223u;
+						const uint32_t span = static_cast<uint32_t>(maxRaw - minRaw);
+						return Fixed::FromRaw(minRaw + static_cast<int32_t>((state >> 8) % (span + 1u)));
+					}
+				};
+			}
+
+			uint64_t ComputeSelfTestHash()
+			{
+				TestRandom random{ 0x5A17u };
+				TestBody bodies[BODYCOUNT];
+
+				for (TestBody& body : bodies)
+				{
+					body.position = FixedVector3{ random.Next(-Fixed::ONE * 500, Fixed::ONE * 500), random.Next(0, Fixed::ONE * 100), random.Next(-Fixed::ONE * 500, Fixed::ONE * 500) };
+					body.velocity = FixedVector3{ random.Next(-Fixed::ONE * 20, Fixed::ONE * 20), random.Next(0, Fixed::ONE * 30), random.Next(-Fixed::ONE * 20, Fixed::ONE * 20) };
+					body.spinAxis = Normalize(FixedVector3{ random.Next(-Fixed::ONE, Fixed::ONE), random.Next(-Fixed::ONE, Fixed::ONE), random.Next(-Fixed::ONE, Fixed::ONE) });
+					body.spinSpeed = random.Next(-Fixed::ONE * 6, Fixed::ONE * 6);
+				}
+
+				const Fixed deltaTime = Fixed::FromRaw(Fixed::ONE / 60);
+				const FixedVector3 gravity{ FIXEDZERO, Fixed::FromRaw(-642252), FIXEDZERO };
+				const FixedVector3 forward{ FIXEDZERO, FIXEDZERO, FIXEDONE };
+				const Fixed restitution = Fixed::FromRaw(Fixed::ONE * 3 / 4);
+
+				StateHash hash;
+
+				for (int step = 0; step < STEPCOUNT; ++step)
+				{
+					for (TestBody& body : bodies)
+					{
+						body.velocity += gravity * deltaTime;
+						body.position += body.velocity * deltaTime;
+
+						if (body.position.y < FIXEDZERO)
+						{
+							body.position.y = -body.position.y;
+							body.velocity.y = -body.velocity.y * restitution;
+						}
+
+						const FixedQuaternion spin = FromAxisAngle(body.spinAxis, body.spinSpeed * deltaTime);
+						body.rotation = Normalize(Multiply(body.rotation, spin));
+
+						const FixedVector3 heading = Rotate(forward, body.rotation);
+						const Fixed yaw = ATan2(heading.x, heading.z);
+						const Fixed distance = Length(body.position);
+						const Fixed wobble = Sin(yaw) * Cos(distance);
+
+						hash.Add(body.position);
+						hash.Add(body.rotation);
+						hash.Add(yaw);
+						hash.Add(wobble);
+						hash.Add(SquareRoot(Abs(body.velocity.y)));
+					}
+				}
+
+				// Blend across the whole set so NLerp / Dot / Cross are covered as well
+				for (int index = 1; index < BODYCOUNT; ++index)
+				{
+					hash.Add(NLerp(bodies[index - 1].rotation, bodies[index].rotation, Fixed::FromRaw(Fixed::ONE / 3)));
+					hash.Add(Cross(bodies[index - 1].position, bodies[index].spinAxis));
+					hash.Add(Dot(bodies[index - 1].velocity, bodies[index].velocity));
+				}
+
+				return hash.GetValue();
+			}
+
+			bool VerifyDeterminism()
+			{
+				const uint64_t hash = ComputeSelfTestHash();
+
+				if (hash != DETERMINISM_REFERENCEHASH)
+				{
+					LOG_ERROR("Deterministic math self test mismatch : got {0:x} , expected {1:x}", hash, DETERMINISM_REFERENCEHASH);
+					return false;
+				}
+
+				return true;
+			}
+		}
+	}
+}
@@ -0,0 +1,496 @@
+#ifndef DETERMINISTICMATH_H
+#define DETERMINISTICMATH_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Bit exact math for lockstep simulation.
+		/// Everything in here is done on integers (Q16.16 values with 64 bit intermediates) , so the results do not depend on
+		/// the compiler , the FP model , FMA contraction , the SIMD tier or libm. Only floats coming in through FromFloat need to agree.
+		/// Range is +-32768 with a resolution of ~1.5e-5
+		/// </summary>
+		namespace Deterministic
+		{
+			namespace FixedDetail
+			{
+				// Q30 constants (rounded once , offline)
+				inline static constexpr int64_t HALFPI_Q30 = 1686629713;
+				inline static constexpr int64_t QUARTERPI_Q30 = 843314857;
+				inline static constexpr int64_t PI_Q30 = 3373259426;
+
+				// Same minimax polynomials as the Full / Medium trig tiers , scaled to Q30
+				inline static constexpr int64_t SIN_Q30[] = { 1073741824, -178956841, 8946590, -209544 };
+				inline static constexpr int64_t COS_Q30[] = { 1073741824, -536870912, 44739220, -1491139, 26235 };
+				inline static constexpr int64_t ATAN_Q30[] = { 1073717363, -357151042, 207812396, -125011983, 56529663, -12583326 };
+
+				// Rounded Q30 multiply
+				constexpr int64_t MultiplyQ30(int64_t first, int64_t second)
+				{
+					return (first * second + (int64_t(1) << 29)) >> 30;
+				}
+
+				template <size_t Count>
+				constexpr int64_t HornerQ30(int64_t x, const int64_t(&coefficients)[Count])
+				{
+					int64_t result = coefficients[Count - 1];
+					for (size_t index = Count - 1; index-- > 0;)
+					{
+						result = MultiplyQ30(result, x) + coefficients[index];
+					}
+					return result;
+				}
+
+				// Division that rounds towards negative infinity (C++ truncates towards zero)
+				constexpr int64_t FloorDivide(int64_t numerator, int64_t denominator)
+				{
+					const int64_t quotient = numerator / denominator;
+					return (numerator % denominator != 0 && ((numerator < 0) != (denominator < 0))) ? quotient - 1 : quotient;
+				}
+
+				/// <summary>
+				/// Bit by bit integer square root (floor) , no floating point involved
+				/// </summary>
+				constexpr uint64_t IntegerSqrt(uint64_t value)
+				{
+					uint64_t result = 0;
+					uint64_t bit = uint64_t(1) << 62;
+
+					while (bit > value) { bit >>= 2; }
+
+					while (bit != 0)
+					{
+						if (value >= result + bit)
+						{
+							value -= result + bit;
+							result = (result >> 1) + bit;
+						}
+						else
+						{
+							result >>= 1;
+						}
+						bit >>= 2;
+					}
+					return result;
+				}
+
+				constexpr int32_t Saturate(int64_t value)
+				{
+					return value > INT32_MAX ? INT32_MAX : (value < INT32_MIN ? INT32_MIN : static_cast<int32_t>(value));
+				}
+
+				/// <summary>
+				/// Two's complement wrap around. Overflowing signed arithmetic is UB , which the optimizer may resolve differently
+				/// per build , unsigned arithmetic wraps the same way everywhere
+				/// </summary>
+				constexpr int32_t WrapAdd(int32_t first, int32_t second)
+				{
+					return static_cast<int32_t>(static_cast<uint32_t>(first) + static_cast<uint32_t>(second));
+				}
+
+				constexpr int32_t WrapSubtract(int32_t first, int32_t second)
+				{
+					return static_cast<int32_t>(static_cast<uint32_t>(first) - static_cast<uint32_t>(second));
+				}
+
+				/// <summary>
+				/// 64 bit sum that sticks at the limits , for the dot products (three or four 2^62 products can overflow int64).
+				/// Anything that large saturates the Q16.16 result anyway , so in range results are unchanged
+				/// </summary>
+				constexpr int64_t AddSaturate(int64_t first, int64_t second)
+				{
+					if (second > 0 && first > INT64_MAX - second) { return INT64_MAX; }
+					if (second < 0 && first < INT64_MIN - second) { return INT64_MIN; }
+					return first + second;
+				}
+			}
+
+			/// <summary>
+			/// Signed Q16.16 fixed point scalar
+			/// </summary>
+			struct Fixed
+			{
+				inline static constexpr int32_t FRACTIONBITS = 16;
+				inline static constexpr int32_t ONE = 1 << FRACTIONBITS;
+
+				int32_t raw = 0;
+
+				static constexpr Fixed FromRaw(int32_t raw) { Fixed result; result.raw = raw; return result; }
+				// Values outside +-32768 wrap
+				static constexpr Fixed FromInt(int32_t value) { return FromRaw(static_cast<int32_t>(static_cast<uint32_t>(value) << FRACTIONBITS)); }
+
+				/// <summary>
+				/// Rounds to the nearest representable value (the scale is a power of two so the multiply is exact).
+				/// Out of range values and infinities saturate , NaN becomes 0. Both are settled while still in float ,
+				/// converting such a float to an integer would be UB
+				/// </summary>
+				static constexpr Fixed FromFloat(float value)
+				{
+					constexpr float LIMIT = 2147483648.0f;
+
+					const float scaled = value * static_cast<float>(ONE);
+					if (!(scaled > -LIMIT && scaled < LIMIT))
+					{
+						return FromRaw(scaled > 0.0f ? INT32_MAX : (scaled < 0.0f ? INT32_MIN : 0));
+					}
+
+					return FromRaw(FixedDetail::Saturate(static_cast<int64_t>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f)));
+				}
+
+				constexpr float ToFloat() const { return static_cast<float>(raw) / static_cast<float>(ONE); }
+
+				// Addition and subtraction wrap on overflow (two's complement , the same on every platform)
+				constexpr Fixed operator-() const { return FromRaw(FixedDetail::WrapSubtract(0, raw)); }
+				constexpr Fixed operator+(Fixed other) const { return FromRaw(FixedDetail::WrapAdd(raw, other.raw)); }
+				constexpr Fixed operator-(Fixed other) const { return FromRaw(FixedDetail::WrapSubtract(raw, other.raw)); }
+
+				constexpr Fixed operator*(Fixed other) const
+				{
+					return FromRaw(static_cast<int32_t>((static_cast<int64_t>(raw) * other.raw + (int64_t(1) << (FRACTIONBITS - 1))) >> FRACTIONBITS));
+				}
+
+				// Division by zero saturates towards the sign of the numerator
+				constexpr Fixed operator/(Fixed other) const
+				{
+					if (other.raw == 0) { return FromRaw(raw >= 0 ? INT32_MAX : INT32_MIN); }
+					return FromRaw(FixedDetail::Saturate((static_cast<int64_t>(raw) * ONE) / other.raw));
+				}
+
+				constexpr Fixed& operator+=(Fixed other) { *this = *this + other; return *this; }
+				constexpr Fixed& operator-=(Fixed other) { *this = *this - other; return *this; }
+				constexpr Fixed& operator*=(Fixed other) { *this = *this * other; return *this; }
+				constexpr Fixed& operator/=(Fixed other) { *this = *this / other; return *this; }
+
+				constexpr bool operator==(Fixed other) const { return raw == other.raw; }
+				constexpr bool operator!=(Fixed other) const { return raw != other.raw; }
+				constexpr bool operator<(Fixed other) const { return raw < other.raw; }
+				constexpr bool operator<=(Fixed other) const { return raw <= other.raw; }
+				constexpr bool operator>(Fixed other) const { return raw > other.raw; }
+				constexpr bool operator>=(Fixed other) const { return raw >= other.raw; }
+			};
+
+			inline static constexpr Fixed FIXEDZERO = Fixed::FromRaw(0);
+			inline static constexpr Fixed FIXEDONE = Fixed::FromRaw(Fixed::ONE);
+			inline static constexpr Fixed FIXEDPI = Fixed::FromRaw(205887);
+			inline static constexpr Fixed FIXEDHALFPI = Fixed::FromRaw(102944);
+
+
+			// ==================== SCALAR FUNCTIONS =========================
+
+			constexpr Fixed Abs(Fixed value) { return value.raw < 0 ? -value : value; }
+			constexpr Fixed Min(Fixed first, Fixed second) { return first < second ? first : second; }
+			constexpr Fixed Max(Fixed first, Fixed second) { return first > second ? first : second; }
+			constexpr Fixed Clamp(Fixed value, Fixed min, Fixed max) { return Min(max, Max(min, value)); }
+
+			/// <summary>
+			/// Lerps Between Two values according to the given Delta
+			/// </summary>
+			constexpr Fixed Lerp(Fixed valueOne, Fixed valueTwo, Fixed delta)
+			{
+				return valueOne + (valueTwo - valueOne) * delta;
+			}
+
+			/// <summary>
+			/// Square root (negative values return 0)
+			/// </summary>
+			constexpr Fixed SquareRoot(Fixed value)
+			{
+				if (value.raw <= 0) { return FIXEDZERO; }
+				return Fixed::FromRaw(static_cast<int32_t>(FixedDetail::IntegerSqrt(static_cast<uint64_t>(value.raw) << Fixed::FRACTIONBITS)));
+			}
+
+			/// <summary>
+			/// Sine and CoSine of an angle in radians (max error ~1e-5 , dominated by the Q16.16 output)
+			/// </summary>
+			constexpr void SinCos(Fixed angle, Fixed& outSin, Fixed& outCos)
+			{
+				using namespace FixedDetail;
+
+				// Reduce in Q30 : angle = quadrant * PI/2 + reduced , reduced in [-PI/4, PI/4)
+				const int64_t angleQ30 = static_cast<int64_t>(angle.raw) * (int64_t(1) << 14);
+				const int64_t quadrant = FloorDivide(angleQ30 + QUARTERPI_Q30, HALFPI_Q30);
+				const int64_t reduced = angleQ30 - quadrant * HALFPI_Q30;
+				const int64_t reducedSq = MultiplyQ30(reduced, reduced);
+
+				const int64_t sine = MultiplyQ30(reduced, HornerQ30(reducedSq, SIN_Q30));
+				const int64_t cosine = HornerQ30(reducedSq, COS_Q30);
+
+				int64_t resultSin = 0;
+				int64_t resultCos = 0;
+
+				switch (quadrant & 3)
+				{
+				case 0: resultSin = sine; resultCos = cosine; break;
+				case 1: resultSin = cosine; resultCos = -sine; break;
+				case 2: resultSin = -sine; resultCos = -cosine; break;
+				default: resultSin = -cosine; resultCos = sine; break;
+				}
+
+				outSin = Fixed::FromRaw(static_cast<int32_t>((resultSin + (int64_t(1) << 13)) >> 14));
+				outCos = Fixed::FromRaw(static_cast<int32_t>((resultCos + (int64_t(1) << 13)) >> 14));
+			}
+
+			constexpr Fixed Sin(Fixed angle) { Fixed sine, cosine; SinCos(angle, sine, cosine); return sine; }
+			constexpr Fixed Cos(Fixed angle) { Fixed sine, cosine; SinCos(angle, sine, cosine); return cosine; }
+
+			/// <summary>
+			/// Arc Tangent of y/x in radians , in the range [-PI, PI]
+			/// </summary>
+			constexpr Fixed ATan2(Fixed y, Fixed x)
+			{
+				using namespace FixedDetail;
+
+				const int64_t absX = x.raw < 0 ? -static_cast<int64_t>(x.raw) : x.raw;
+				const int64_t absY = y.raw < 0 ? -static_cast<int64_t>(y.raw) : y.raw;
+				const int64_t maxValue = absX > absY ? absX : absY;
+				const int64_t minValue = absX > absY ? absY : absX;
+
+				if (maxValue == 0) { return FIXEDZERO; }
+
+				const int64_t ratio = (minValue << 30) / maxValue;
+				int64_t result = MultiplyQ30(ratio, HornerQ30(MultiplyQ30(ratio, ratio), ATAN_Q30));
+
+				if (absY > absX) { result = HALFPI_Q30 - result; }
+				if (x.raw < 0) { result = PI_Q30 - result; }
+				if (y.raw < 0) { result = -result; }
+
+				return Fixed::FromRaw(static_cast<int32_t>((result + (int64_t(1) << 13)) >> 14));
+			}
+
+
+			// ==================== VECTOR 3 =========================
+
+			struct FixedVector3
+			{
+				Fixed x;
+				Fixed y;
+				Fixed z;
+
+				static constexpr FixedVector3 FromFloat(const Vector3& vector)
+				{
+					return FixedVector3{ Fixed::FromFloat(vector.x), Fixed::FromFloat(vector.y), Fixed::FromFloat(vector.z) };
+				}
+
+				constexpr Vector3 ToFloat() const { return Vector3{ x.ToFloat(), y.ToFloat(), z.ToFloat() }; }
+
+				constexpr FixedVector3 operator-() const { return FixedVector3{ -x, -y, -z }; }
+				constexpr FixedVector3 operator+(const FixedVector3& other) const { return FixedVector3{ x + other.x, y + other.y, z + other.z }; }
+				constexpr FixedVector3 operator-(const FixedVector3& other) const { return FixedVector3{ x - other.x, y - other.y, z - other.z }; }
+				constexpr FixedVector3 operator*(Fixed scale) const { return FixedVector3{ x * scale, y * scale, z * scale }; }
+				constexpr FixedVector3 operator/(Fixed scale) const { return FixedVector3{ x / scale, y / scale, z / scale }; }
+
+				constexpr FixedVector3& operator+=(const FixedVector3& other) { *this = *this + other; return *this; }
+				constexpr FixedVector3& operator-=(const FixedVector3& other) { *this = *this - other; return *this; }
+				constexpr FixedVector3& operator*=(Fixed scale) { *this = *this * scale; return *this; }
+
+				constexpr bool operator==(const FixedVector3& other) const { return x == other.x && y == other.y && z == other.z; }
+				constexpr bool operator!=(const FixedVector3& other) const { return !(*this == other); }
+			};
+
+			/// <summary>
+			/// Dot product , accumulated in 64 bits and rounded once
+			/// </summary>
+			constexpr Fixed Dot(const FixedVector3& vectorOne, const FixedVector3& vectorTwo)
+			{
+				using namespace FixedDetail;
+
+				int64_t sum = static_cast<int64_t>(vectorOne.x.raw) * vectorTwo.x.raw;
+				sum = AddSaturate(sum, static_cast<int64_t>(vectorOne.y.raw) * vectorTwo.y.raw);
+				sum = AddSaturate(sum, static_cast<int64_t>(vectorOne.z.raw) * vectorTwo.z.raw);
+				return Fixed::FromRaw(Saturate(AddSaturate(sum, int64_t(1) << 15) >> 16));
+			}
+
+			constexpr FixedVector3 Cross(const FixedVector3& vectorOne, const FixedVector3& vectorTwo)
+			{
+				return FixedVector3{
+					vectorOne.y * vectorTwo.z - vectorOne.z * vectorTwo.y,
+					vectorOne.z * vectorTwo.x - vectorOne.x * vectorTwo.z,
+					vectorOne.x * vectorTwo.y - vectorOne.y * vectorTwo.x };
+			}
+
+			/// <summary>
+			/// Length of the vector , the squared sum stays in 64 bits so large vectors don't overflow
+			/// </summary>
+			constexpr Fixed Length(const FixedVector3& vector)
+			{
+				const uint64_t sum = static_cast<uint64_t>(static_cast<int64_t>(vector.x.raw) * vector.x.raw)
+					+ static_cast<uint64_t>(static_cast<int64_t>(vector.y.raw) * vector.y.raw)
+					+ static_cast<uint64_t>(static_cast<int64_t>(vector.z.raw) * vector.z.raw);
+
+				return Fixed::FromRaw(FixedDetail::Saturate(static_cast<int64_t>(FixedDetail::IntegerSqrt(sum))));
+			}
+
+			constexpr Fixed Distance(const FixedVector3& vectorOne, const FixedVector3& vectorTwo)
+			{
+				return Length(vectorTwo - vectorOne);
+			}
+
+			/// <summary>
+			/// Returns the unit vector (zero vectors stay zero)
+			/// </summary>
+			constexpr FixedVector3 Normalize(const FixedVector3& vector)
+			{
+				const Fixed length = Length(vector);
+				if (length.raw == 0) { return FixedVector3{}; }
+				return vector / length;
+			}
+
+			constexpr FixedVector3 Lerp(const FixedVector3& vectorOne, const FixedVector3& vectorTwo, Fixed delta)
+			{
+				return FixedVector3{ Lerp(vectorOne.x, vectorTwo.x, delta), Lerp(vectorOne.y, vectorTwo.y, delta), Lerp(vectorOne.z, vectorTwo.z, delta) };
+			}
+
+
+			// ==================== QUATERNION =========================
+
+			struct FixedQuaternion
+			{
+				Fixed x;
+				Fixed y;
+				Fixed z;
+				Fixed w = FIXEDONE;
+
+				static constexpr FixedQuaternion FromFloat(const Quaternion& rotation)
+				{
+					return FixedQuaternion{ Fixed::FromFloat(rotation.x), Fixed::FromFloat(rotation.y), Fixed::FromFloat(rotation.z), Fixed::FromFloat(rotation.w) };
+				}
+
+				constexpr Quaternion ToFloat() const { return Quaternion{ x.ToFloat(), y.ToFloat(), z.ToFloat(), w.ToFloat() }; }
+
+				constexpr bool operator==(const FixedQuaternion& other) const { return x == other.x && y == other.y && z == other.z && w == other.w; }
+				constexpr bool operator!=(const FixedQuaternion& other) const { return !(*this == other); }
+			};
+
+			constexpr Fixed Dot(const FixedQuaternion& rotOne, const FixedQuaternion& rotTwo)
+			{
+				using namespace FixedDetail;
+
+				int64_t sum = static_cast<int64_t>(rotOne.x.raw) * rotTwo.x.raw;
+				sum = AddSaturate(sum, static_cast<int64_t>(rotOne.y.raw) * rotTwo.y.raw);
+				sum = AddSaturate(sum, static_cast<int64_t>(rotOne.z.raw) * rotTwo.z.raw);
+				sum = AddSaturate(sum, static_cast<int64_t>(rotOne.w.raw) * rotTwo.w.raw);
+				return Fixed::FromRaw(Saturate(AddSaturate(sum, int64_t(1) << 15) >> 16));
+			}
+
+			constexpr FixedQuaternion Conjugate(const FixedQuaternion& rotation)
+			{
+				return FixedQuaternion{ -rotation.x, -rotation.y, -rotation.z, rotation.w };
+			}
+
+			/// <summary>
+			/// Same order as XMQuaternionMultiply : the result rotates by rotOne first and then by rotTwo
+			/// </summary>
+			constexpr FixedQuaternion Multiply(const FixedQuaternion& rotOne, const FixedQuaternion& rotTwo)
+			{
+				const FixedQuaternion& a = rotTwo;
+				const FixedQuaternion& b = rotOne;
+
+				return FixedQuaternion{
+					a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+					a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+					a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+					a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z };
+			}
+
+			constexpr FixedQuaternion Normalize(const FixedQuaternion& rotation)
+			{
+				const uint64_t sum = static_cast<uint64_t>(static_cast<int64_t>(rotation.x.raw) * rotation.x.raw)
+					+ static_cast<uint64_t>(static_cast<int64_t>(rotation.y.raw) * rotation.y.raw)
+					+ static_cast<uint64_t>(static_cast<int64_t>(rotation.z.raw) * rotation.z.raw)
+					+ static_cast<uint64_t>(static_cast<int64_t>(rotation.w.raw) * rotation.w.raw);
+
+				const Fixed length = Fixed::FromRaw(FixedDetail::Saturate(static_cast<int64_t>(FixedDetail::IntegerSqrt(sum))));
+				if (length.raw == 0) { return FixedQuaternion{}; }
+
+				return FixedQuaternion{ rotation.x / length, rotation.y / length, rotation.z / length, rotation.w / length };
+			}
+
+			/// <summary>
+			/// Rotation of 'angle' radians around the (unit) axis
+			/// </summary>
+			constexpr FixedQuaternion FromAxisAngle(const FixedVector3& axis, Fixed angle)
+			{
+				Fixed sine, cosine;
+				SinCos(Fixed::FromRaw(angle.raw / 2), sine, cosine);
+
+				return FixedQuaternion{ axis.x * sine, axis.y * sine, axis.z * sine, cosine };
+			}
+
+			/// <summary>
+			/// Rotates the vector by the (unit) quaternion : v + 2w(q x v) + 2 q x (q x v)
+			/// </summary>
+			constexpr FixedVector3 Rotate(const FixedVector3& vector, const FixedQuaternion& rotation)
+			{
+				const FixedVector3 axis{ rotation.x, rotation.y, rotation.z };
+				const FixedVector3 twiceCross = Cross(axis, vector) * Fixed::FromInt(2);
+
+				return vector + twiceCross * rotation.w + Cross(axis, twiceCross);
+			}
+
+			/// <summary>
+			/// Normalized lerp along the shortest path
+			/// </summary>
+			constexpr FixedQuaternion NLerp(const FixedQuaternion& rotOne, const FixedQuaternion& rotTwo, Fixed delta)
+			{
+				const Fixed sign = Dot(rotOne, rotTwo).raw < 0 ? -FIXEDONE : FIXEDONE;
+
+				return Normalize(FixedQuaternion{
+					Lerp(rotOne.x, rotTwo.x * sign, delta),
+					Lerp(rotOne.y, rotTwo.y * sign, delta),
+					Lerp(rotOne.z, rotTwo.z * sign, delta),
+					Lerp(rotOne.w, rotTwo.w * sign, delta) });
+			}
+
+
+			// ==================== STATE HASHING =========================
+
+			/// <summary>
+			/// FNV-1a over the raw fixed point bits , used to compare simulation state between peers / builds
+			/// </summary>
+			class StateHash
+			{
+			public:
+
+				constexpr void Add(uint32_t value)
+				{
+					for (int byte = 0; byte < 4; ++byte)
+					{
+						m_hash ^= (value >> (byte * 8)) & 0xFFu;
+						m_hash *= 1099511628211ull;
+					}
+				}
+
+				constexpr void Add(Fixed value) { Add(static_cast<uint32_t>(value.raw)); }
+				constexpr void Add(const FixedVector3& value) { Add(value.x); Add(value.y); Add(value.z); }
+				constexpr void Add(const FixedQuaternion& value) { Add(value.x); Add(value.y); Add(value.z); Add(value.w); }
+
+				constexpr uint64_t GetValue() const { return m_hash; }
+
+			private:
+
+				uint64_t m_hash = 14695981039346656037ull;
+			};
+
+			// Expected ComputeSelfTestHash() result , update it only when the fixed point math intentionally changes
+			inline static constexpr uint64_t DETERMINISM_REFERENCEHASH = 0xa7d252dd9415a83dull;
+
+			/// <summary>
+			/// Runs a fixed scripted simulation through every function above and hashes the results.
+			/// The value must match DETERMINISM_REFERENCEHASH on every platform and build configuration
+			/// </summary>
+			SNP_API uint64_t ComputeSelfTestHash();
+
+			/// <summary>
+			/// Compares the self test hash with the reference , logs an error on mismatch.
+			/// Call at startup before joining a lockstep session (and exchange the hash with the peers)
+			/// </summary>
+			SNP_API bool VerifyDeterminism();
+		}
+	}
+}
+
+#endif // !DETERMINISTICMATH_H
@@ -0,0 +1,270 @@
+#include "FastTrig.hpp"
+#include "MathDispatch.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace TrigDetail
+		{
+			void FixupLargeAngles(const float* angles, float* sines, float* cosines, size_t count)
+			{
+				for (size_t index = 0; index < count; ++index)
+				{
+					if (!(std::fabs(angles[index]) <= REDUCTIONLIMIT))
+					{
+						sines[index] = std::sin(angles[index]);
+						cosines[index] = std::cos(angles[index]);
+					}
+				}
+			}
+		}
+
+		namespace
+		{
+			inline static constexpr size_t VERIFYANGLES = 65536;
+			inline static constexpr float VERIFYANGLERANGE = 16.0f * PI;
+
+			// atan2 grid : VERIFYGRID x VERIFYGRID points over [-VERIFYGRIDRANGE , VERIFYGRIDRANGE]^2
+			inline static constexpr size_t VERIFYGRID = 257;
+			inline static constexpr float VERIFYGRIDRANGE = 4.0f;
+
+			inline static constexpr const char* PRECISIONNAMES[] = { "Fast", "Medium", "Full" };
+
+			struct TrigErrors
+			{
+				double sinCos = 0.0;
+				double tan = 0.0;
+				double atan2 = 0.0;
+			};
+
+			// Tracks the worst error , a NaN result counts as infinitely wrong
+			inline void Track(double& worst, double error)
+			{
+				worst = std::isnan(error) ? INFINITY : std::max(worst, error);
+			}
+
+			inline void TrackSinCos(TrigErrors& errors, float angle, float sine, float cosine)
+			{
+				Track(errors.sinCos, std::fabs(sine - std::sin(static_cast<double>(angle))));
+				Track(errors.sinCos, std::fabs(cosine - std::cos(static_cast<double>(angle))));
+			}
+
+			inline void TrackTan(TrigErrors& errors, float angle, float tangent)
+			{
+				if (std::fabs(std::cos(static_cast<double>(angle))) < 0.25) { return; }
+
+				const double expected = std::tan(static_cast<double>(angle));
+				Track(errors.tan, std::fabs(tangent - expected) / std::max(std::fabs(expected), 1.0));
+			}
+
+			inline void TrackATan2(TrigErrors& errors, float y, float x, float result)
+			{
+				Track(errors.atan2, std::fabs(result - std::atan2(static_cast<double>(y), static_cast<double>(x))));
+			}
+
+			bool CheckBound(const char* path, TrigPrecision precision, const char* function, double error, float bound)
+			{
+				if (error <= bound) { return true; }
+
+				LOG_ERROR("Trig self test ({0} , {1}) : {2} max error {3} above the bound {4}", path, PRECISIONNAMES[static_cast<size_t>(precision)], function, error, bound);
+				return false;
+			}
+
+			bool CheckErrors(const char* path, TrigPrecision precision, const TrigErrors& errors)
+			{
+				const size_t tier = static_cast<size_t>(precision);
+
+				bool passed = CheckBound(path, precision, "sin / cos", errors.sinCos, TRIG_MAXSINCOSERROR[tier]);
+				passed &= CheckBound(path, precision, "tan", errors.tan, TRIG_MAXTANERROR[tier]);
+				passed &= CheckBound(path, precision, "atan2", errors.atan2, TRIG_MAXATAN2ERROR[tier]);
+				return passed;
+			}
+
+			template <TrigPrecision Precision>
+			bool VerifyPrecision(const std::vector<float>& angles, const std::vector<float>& gridY, const std::vector<float>& gridX)
+			{
+				TrigErrors scalar;
+				TrigErrors wide;
+				TrigErrors batch;
+
+				// Scalar
+				for (float angle : angles)
+				{
+					float sine, cosine;
+					FastSinCos<Precision>(angle, sine, cosine);
+					TrackSinCos(scalar, angle, sine, cosine);
+					TrackTan(scalar, angle, FastTan<Precision>(angle));
+				}
+				for (size_t index = 0; index < gridY.size(); ++index) { TrackATan2(scalar, gridY[index], gridX[index], FastATan2<Precision>(gridY[index], gridX[index])); }
+
+				// 4 wide , the counts are multiples of 4
+				for (size_t index = 0; index + 4 <= angles.size(); index += 4)
+				{
+					XMFLOAT4 sines, cosines, tangents;
+					const XMVECTOR angle = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(angles.data() + index));
+
+					XMVECTOR sine, cosine;
+					FastSinCos<Precision>(angle, &sine, &cosine);
+					XMStoreFloat4(&sines, sine);
+					XMStoreFloat4(&cosines, cosine);
+					XMStoreFloat4(&tangents, FastTan<Precision>(angle));
+
+					const float* sineLanes = &sines.x;
+					const float* cosineLanes = &cosines.x;
+					const float* tangentLanes = &tangents.x;
+					for (size_t lane = 0; lane < 4; ++lane)
+					{
+						TrackSinCos(wide, angles[index + lane], sineLanes[lane], cosineLanes[lane]);
+						TrackTan(wide, angles[index + lane], tangentLanes[lane]);
+					}
+				}
+				for (size_t index = 0; index + 4 <= gridY.size(); index += 4)
+				{
+					XMFLOAT4 results;
+					XMStoreFloat4(&results, FastATan2<Precision>(XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(gridY.data() + index)), XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(gridX.data() + index))));
+
+					const float* lanes = &results.x;
+					for (size_t lane = 0; lane < 4; ++lane) { TrackATan2(wide, gridY[index + lane], gridX[index + lane], lanes[lane]); }
+				}
+
+				// Dispatched array kernels , odd counts so the tails get covered too
+				const size_t angleCount = angles.size() - 3;
+				std::vector<float> sines(angleCount), cosines(angleCount), tangents(angleCount);
+				FastSinCosArray(angles.data(), sines.data(), cosines.data(), angleCount, Precision);
+				FastTanArray(angles.data(), tangents.data(), angleCount, Precision);
+				for (size_t index = 0; index < angleCount; ++index)
+				{
+					TrackSinCos(batch, angles[index], sines[index], cosines[index]);
+					TrackTan(batch, angles[index], tangents[index]);
+				}
+
+				const size_t gridCount = gridY.size() - 1;
+				std::vector<float> results(gridCount);
+				FastATan2Array(gridY.data(), gridX.data(), results.data(), gridCount, Precision);
+				for (size_t index = 0; index < gridCount; ++index) { TrackATan2(batch, gridY[index], gridX[index], results[index]); }
+
+				bool passed = CheckErrors("scalar", Precision, scalar);
+				passed &= CheckErrors("4 wide", Precision, wide);
+				passed &= CheckErrors(MathDispatch::GetTierName(MathDispatch::GetTier()), Precision, batch);
+				return passed;
+			}
+
+			/// <summary>
+			/// The signed zero / axis inputs have to come out bit identical to std::atan2 on every path
+			/// </summary>
+			template <TrigPrecision Precision>
+			bool VerifyATan2Signs()
+			{
+				constexpr size_t CASECOUNT = 12;
+				static const float CASES[CASECOUNT][2] =
+				{
+					{ 0.0f, 0.0f }, { -0.0f, 0.0f }, { 0.0f, -0.0f }, { -0.0f, -0.0f },
+					{ 0.0f, -1.0f }, { -0.0f, -1.0f }, { 0.0f, 1.0f }, { -0.0f, 1.0f },
+					{ 1.0f, 0.0f }, { 1.0f, -0.0f }, { -1.0f, 0.0f }, { -1.0f, -0.0f }
+				};
+
+				float y[CASECOUNT], x[CASECOUNT], batch[CASECOUNT];
+				for (size_t index = 0; index < CASECOUNT; ++index)
+				{
+					y[index] = CASES[index][0];
+					x[index] = CASES[index][1];
+				}
+				FastATan2Array(y, x, batch, CASECOUNT, Precision);
+
+				bool passed = true;
+				for (size_t index = 0; index < CASECOUNT; index += 4)
+				{
+					XMFLOAT4 wide;
+					XMStoreFloat4(&wide, FastATan2<Precision>(XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(y + index)), XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(x + index))));
+
+					for (size_t lane = 0; lane < 4; ++lane)
+					{
+						const size_t point = index + lane;
+						const float expected = std::atan2(y[point], x[point]);
+						const float results[3] = { FastATan2<Precision>(y[point], x[point]), (&wide.x)[lane], batch[point] };
+
+						for (float result : results)
+						{
+							if (result == expected && std::signbit(result) == std::signbit(expected)) { continue; }
+
+							LOG_ERROR("Trig self test ({0}) : atan2({1} , {2}) gave {3} , std::atan2 gives {4}", PRECISIONNAMES[static_cast<size_t>(Precision)], y[point], x[point], result, expected);
+							passed = false;
+						}
+					}
+				}
+
+				return passed;
+			}
+		}
+
+		void FastSinArray(const float* angles, float* results, size_t count, TrigPrecision precision)
+		{
+			MathDispatch::GetKernels().SinCos(angles, results, nullptr, count, precision);
+		}
+
+		void FastCosArray(const float* angles, float* results, size_t count, TrigPrecision precision)
+		{
+			MathDispatch::GetKernels().SinCos(angles, nullptr, results, count, precision);
+		}
+
+		void FastSinCosArray(const float* angles, float* outSines, float* outCosines, size_t count, TrigPrecision precision)
+		{
+			MathDispatch::GetKernels().SinCos(angles, outSines, outCosines, count, precision);
+		}
+
+		void FastTanArray(const float* angles, float* results, size_t count, TrigPrecision precision)
+		{
+			MathDispatch::GetKernels().Tan(angles, results, count, precision);
+		}
+
+		void FastATan2Array(const float* y, const float* x, float* results, size_t count, TrigPrecision precision)
+		{
+			MathDispatch::GetKernels().ATan2(y, x, results, count, precision);
+		}
+
+		bool VerifyTrig()
+		{
+			std::vector<float> angles(VERIFYANGLES);
+			for (size_t index = 0; index < VERIFYANGLES; ++index)
+			{
+				angles[index] = -VERIFYANGLERANGE + 2.0f * VERIFYANGLERANGE * static_cast<float>(index) / static_cast<float>(VERIFYANGLES - 1);
+			}
+
+			// Past the reduction limit the results come from std:: , a few of those keep the fixup path honest
+			angles[1] = 1.0e4f;
+			angles[2] = -3.0e5f;
+
+			std::vector<float> gridY;
+			std::vector<float> gridX;
+			for (size_t row = 0; row < VERIFYGRID; ++row)
+			{
+				for (size_t column = 0; column < VERIFYGRID; ++column)
+				{
+					gridY.push_back(-VERIFYGRIDRANGE + 2.0f * VERIFYGRIDRANGE * static_cast<float>(row) / static_cast<float>(VERIFYGRID - 1));
+					gridX.push_back(-VERIFYGRIDRANGE + 2.0f * VERIFYGRIDRANGE * static_cast<float>(column) / static_cast<float>(VERIFYGRID - 1));
+				}
+			}
+
+			// Pad to a multiple of 4 for the 4 wide pass
+			while (gridY.size() % 4 != 0)
+			{
+				gridY.push_back(1.0f);
+				gridX.push_back(1.0f);
+			}
+
+			bool passed = VerifyPrecision<TrigPrecision::Fast>(angles, gridY, gridX);
+			passed &= VerifyPrecision<TrigPrecision::Medium>(angles, gridY, gridX);
+			passed &= VerifyPrecision<TrigPrecision::Full>(angles, gridY, gridX);
+
+			passed &= VerifyATan2Signs<TrigPrecision::Fast>();
+			passed &= VerifyATan2Signs<TrigPrecision::Medium>();
+			passed &= VerifyATan2Signs<TrigPrecision::Full>();
+
+			return passed;
+		}
+	}
+}
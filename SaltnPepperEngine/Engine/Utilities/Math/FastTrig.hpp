@@ -0,0 +1,519 @@
+#ifndef FASTTRIG_H
+#define FASTTRIG_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Accuracy tiers for the polynomial trig approximations (max absolute error against std::)
+		/// <para> Fast   : ~1.5e-4 (sin/cos) , ~6e-4 radians (atan2) </para>
+		/// <para> Medium : ~1.2e-6 (sin/cos) , ~2e-6 radians (atan2) </para>
+		/// <para> Full   : ~8e-8 (sin/cos) , ~3e-7 radians (atan2) , within a couple of ulps of the libm results </para>
+		/// </summary>
+		enum class TrigPrecision : uint8_t
+		{
+			Fast,
+			Medium,
+			Full
+		};
+
+		// Max errors VerifyTrig holds each tier to (indexed by TrigPrecision) : absolute for sin / cos and atan2 (radians) ,
+		// relative for tan (checked where |cos| >= 0.25). Measured over [-16 PI , 16 PI] and a [-4 , 4]^2 grid , plus headroom
+		inline static constexpr float TRIG_MAXSINCOSERROR[3] = { 2.0e-4f, 2.0e-6f, 1.5e-7f };
+		inline static constexpr float TRIG_MAXTANERROR[3] = { 8.0e-4f, 3.0e-6f, 4.0e-7f };
+		inline static constexpr float TRIG_MAXATAN2ERROR[3] = { 7.0e-4f, 2.5e-6f, 4.0e-7f };
+
+		namespace TrigDetail
+		{
+			// Cody-Waite split of PI/2 , the first part has few enough mantissa bits that (k * PIO2_1) is exact
+			inline static constexpr float PIO2_1 = 1.5703125f;
+			inline static constexpr float PIO2_2 = 4.837512969970703125e-4f;
+			inline static constexpr float PIO2_3 = 7.54978995489188216e-8f;
+			inline static constexpr float TWOOVERPI = 0.636619772367581343f;
+
+			// Above this the 3 part reduction starts to lose bits, those lanes fall back to std::
+			inline static constexpr float REDUCTIONLIMIT = 8192.0f;
+
+			// tan(PI/8) , the Full atan tier reduces its argument around this point
+			inline static constexpr float TANPIOVER8 = 0.414213562373095f;
+			inline static constexpr float QUARTERPI = 0.785398163397448f;
+
+			/// <summary>
+			/// Minimax coefficients (in r^2) for each precision tier.
+			/// Sin/Cos are fitted on [-PI/4, PI/4] , ATan on [0, 1] (or [-tan(PI/8), tan(PI/8)] for Full)
+			/// </summary>
+			template <TrigPrecision Precision>
+			struct TrigCoefficients;
+
+			template <>
+			struct TrigCoefficients<TrigPrecision::Fast>
+			{
+				static constexpr float SIN[] = { 9.9903142291e-01f, -1.6034401672e-01f };
+				static constexpr float COS[] = { 9.9999003496e-01f, -4.9970814036e-01f, 4.0398535969e-02f };
+				static constexpr float ATAN[] = { 9.9535795475e-01f, -2.8869023801e-01f, 7.9339041419e-02f };
+				static constexpr bool ATANREDUCE = false;
+			};
+
+			template <>
+			struct TrigCoefficients<TrigPrecision::Medium>
+			{
+				static constexpr float SIN[] = { 9.9999838540e-01f, -1.6661749354e-01f, 8.1365119623e-03f };
+				static constexpr float COS[] = { 9.9999997242e-01f, -4.9999856696e-01f, 4.1655026884e-02f, -1.3585908510e-03f };
+				static constexpr float ATAN[] = { 9.9997721908e-01f, -3.3262282789e-01f, 1.9354037608e-01f, -1.1642648197e-01f, 5.2647351466e-02f, -1.1719135734e-02f };
+				static constexpr bool ATANREDUCE = false;
+			};
+
+			template <>
+			struct TrigCoefficients<TrigPrecision::Full>
+			{
+				static constexpr float SIN[] = { 1.0f, -1.6666654611e-01f, 8.3321608736e-03f, -1.9515295891e-04f };
+				static constexpr float COS[] = { 1.0f, -0.5f, 4.166664568298827e-02f, -1.388731625493765e-03f, 2.443315711809948e-05f };
+				static constexpr float ATAN[] = { 1.0f, -3.33329491539e-01f, 1.99777106478e-01f, -1.38776856032e-01f, 8.05374449538e-02f };
+				static constexpr bool ATANREDUCE = true;
+			};
+
+
+			// ================ HORNER EVALUATION ======================
+
+			template <size_t Count>
+			inline float Horner(float x, const float(&coefficients)[Count])
+			{
+				float result = coefficients[Count - 1];
+				for (size_t index = Count - 1; index-- > 0;)
+				{
+					result = result * x + coefficients[index];
+				}
+				return result;
+			}
+
+			template <size_t Count>
+			inline XMVECTOR XM_CALLCONV Horner(FXMVECTOR x, const float(&coefficients)[Count])
+			{
+				XMVECTOR result = XMVectorReplicate(coefficients[Count - 1]);
+				for (size_t index = Count - 1; index-- > 0;)
+				{
+					result = XMVectorMultiplyAdd(result, x, XMVectorReplicate(coefficients[index]));
+				}
+				return result;
+			}
+
+#if defined(_XM_AVX2_INTRINSICS_)
+			template <size_t Count>
+			inline __m256 XM_CALLCONV Horner(__m256 x, const float(&coefficients)[Count])
+			{
+				__m256 result = _mm256_set1_ps(coefficients[Count - 1]);
+				for (size_t index = Count - 1; index-- > 0;)
+				{
+					result = _mm256_fmadd_ps(result, x, _mm256_set1_ps(coefficients[index]));
+				}
+				return result;
+			}
+#endif // _XM_AVX2_INTRINSICS_
+
+			/// <summary>
+			/// Replaces the lanes that are out of the reduction range (or NaN / Inf) with the std:: results.
+			/// Kept out of line so the AVX kernel translation units never emit their own copy of it
+			/// </summary>
+			SNP_API void FixupLargeAngles(const float* angles, float* sines, float* cosines, size_t count);
+		}
+
+
+		// ===================== SCALAR APPROXIMATIONS =========================
+
+		/// <summary>
+		/// Computes the Sine and Cosine of the angle (in radians) in one go , sharing the range reduction
+		/// </summary>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline void FastSinCos(float angle, float& outSin, float& outCos)
+		{
+			using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+			if (!(std::fabs(angle) <= TrigDetail::REDUCTIONLIMIT))
+			{
+				outSin = std::sin(angle);
+				outCos = std::cos(angle);
+				return;
+			}
+
+			// angle = quadrant * PI/2 + reduced , reduced lies in [-PI/4, PI/4]
+			const float quadrant = std::nearbyint(angle * TrigDetail::TWOOVERPI);
+			const float reduced = ((angle - quadrant * TrigDetail::PIO2_1) - quadrant * TrigDetail::PIO2_2) - quadrant * TrigDetail::PIO2_3;
+			const float reducedSq = reduced * reduced;
+
+			const float sine = reduced * TrigDetail::Horner(reducedSq, Coefficients::SIN);
+			const float cosine = TrigDetail::Horner(reducedSq, Coefficients::COS);
+
+			switch (static_cast<int32_t>(quadrant) & 3)
+			{
+			case 0: outSin = sine; outCos = cosine; break;
+			case 1: outSin = cosine; outCos = -sine; break;
+			case 2: outSin = -sine; outCos = -cosine; break;
+			default: outSin = -cosine; outCos = sine; break;
+			}
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Sine of the angle (angle should be in radians)
+		/// </summary>
+		/// <returns> float </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline float FastSin(float angle)
+		{
+			float sine, cosine;
+			FastSinCos<Precision>(angle, sine, cosine);
+			return sine;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the CoSine of the angle (angle should be in radians)
+		/// </summary>
+		/// <returns> float </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline float FastCos(float angle)
+		{
+			float sine, cosine;
+			FastSinCos<Precision>(angle, sine, cosine);
+			return cosine;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Tangent of the angle (angle should be in radians)
+		///  The error is relative here , it grows without bounds close to the poles like the real function
+		/// </summary>
+		/// <returns> float </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline float FastTan(float angle)
+		{
+			float sine, cosine;
+			FastSinCos<Precision>(angle, sine, cosine);
+			return sine / cosine;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Arc Tangent of y/x (result in radians , in the range [-PI, PI])
+		/// </summary>
+		/// <returns> float </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline float FastATan2(float y, float x)
+		{
+			using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+			const float absX = std::fabs(x);
+			const float absY = std::fabs(y);
+			const float maxValue = std::max(absX, absY);
+			const float minValue = std::min(absX, absY);
+
+			// ratio is always in [0, 1]
+			float ratio = maxValue > 0.0f ? minValue / maxValue : 0.0f;
+			float offset = 0.0f;
+
+			if constexpr (Coefficients::ATANREDUCE)
+			{
+				if (ratio > TrigDetail::TANPIOVER8)
+				{
+					ratio = (ratio - 1.0f) / (ratio + 1.0f);
+					offset = TrigDetail::QUARTERPI;
+				}
+			}
+
+			float result = offset + ratio * TrigDetail::Horner(ratio * ratio, Coefficients::ATAN);
+
+			// Signs come from the sign bits like std::atan2 : atan2(+-0 , -0) = +-PI , atan2(-0 , -1) = -PI
+			if (absY > absX) { result = HALFPI - result; }
+			if (std::signbit(x)) { result = PI - result; }
+
+			return std::copysign(result, y);
+		}
+
+
+		// ===================== 4 WIDE (XMVECTOR) APPROXIMATIONS =========================
+
+		/// <summary>
+		/// Computes the Sine and Cosine for all four lanes of the vector (angles in radians)
+		/// </summary>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline void XM_CALLCONV FastSinCos(FXMVECTOR angle, XMVECTOR* outSin, XMVECTOR* outCos)
+		{
+			using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+			const XMVECTOR quadrant = XMVectorRound(XMVectorMultiply(angle, XMVectorReplicate(TrigDetail::TWOOVERPI)));
+
+			XMVECTOR reduced = XMVectorNegativeMultiplySubtract(quadrant, XMVectorReplicate(TrigDetail::PIO2_1), angle);
+			reduced = XMVectorNegativeMultiplySubtract(quadrant, XMVectorReplicate(TrigDetail::PIO2_2), reduced);
+			reduced = XMVectorNegativeMultiplySubtract(quadrant, XMVectorReplicate(TrigDetail::PIO2_3), reduced);
+
+			const XMVECTOR reducedSq = XMVectorMultiply(reduced, reduced);
+			const XMVECTOR sine = XMVectorMultiply(reduced, TrigDetail::Horner(reducedSq, Coefficients::SIN));
+			const XMVECTOR cosine = TrigDetail::Horner(reducedSq, Coefficients::COS);
+
+			// Quadrant bits : bit 0 swaps sin/cos , bit 1 negates the sine , bit 0 XOR bit 1 negates the cosine
+			const XMVECTOR quadrantInt = XMConvertVectorFloatToInt(quadrant, 0);
+			const XMVECTOR one = XMVectorSplatConstantInt(1);
+			const XMVECTOR two = XMVectorSplatConstantInt(2);
+
+			const XMVECTOR swapMask = XMVectorEqualInt(XMVectorAndInt(quadrantInt, one), one);
+			const XMVECTOR sinSign = XMVectorAndInt(XMVectorEqualInt(XMVectorAndInt(quadrantInt, two), two), g_XMNegativeZero);
+			const XMVECTOR cosSign = XMVectorXorInt(sinSign, XMVectorAndInt(swapMask, g_XMNegativeZero));
+
+			XMVECTOR resultSin = XMVectorXorInt(XMVectorSelect(sine, cosine, swapMask), sinSign);
+			XMVECTOR resultCos = XMVectorXorInt(XMVectorSelect(cosine, sine, swapMask), cosSign);
+
+			if (!XMVector4LessOrEqual(XMVectorAbs(angle), XMVectorReplicate(TrigDetail::REDUCTIONLIMIT)))
+			{
+				XMFLOAT4A angles, sines, cosines;
+				XMStoreFloat4A(&angles, angle);
+				XMStoreFloat4A(&sines, resultSin);
+				XMStoreFloat4A(&cosines, resultCos);
+
+				TrigDetail::FixupLargeAngles(&angles.x, &sines.x, &cosines.x, 4);
+
+				resultSin = XMLoadFloat4A(&sines);
+				resultCos = XMLoadFloat4A(&cosines);
+			}
+
+			*outSin = resultSin;
+			*outCos = resultCos;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Sine for all four lanes (angles in radians)
+		/// </summary>
+		/// <returns> XMVECTOR </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline XMVECTOR XM_CALLCONV FastSin(FXMVECTOR angle)
+		{
+			XMVECTOR sine, cosine;
+			FastSinCos<Precision>(angle, &sine, &cosine);
+			return sine;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the CoSine for all four lanes (angles in radians)
+		/// </summary>
+		/// <returns> XMVECTOR </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline XMVECTOR XM_CALLCONV FastCos(FXMVECTOR angle)
+		{
+			XMVECTOR sine, cosine;
+			FastSinCos<Precision>(angle, &sine, &cosine);
+			return cosine;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Tangent for all four lanes (angles in radians)
+		/// </summary>
+		/// <returns> XMVECTOR </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline XMVECTOR XM_CALLCONV FastTan(FXMVECTOR angle)
+		{
+			XMVECTOR sine, cosine;
+			FastSinCos<Precision>(angle, &sine, &cosine);
+			return XMVectorDivide(sine, cosine);
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Arc Tangent of y/x for all four lanes (results in radians)
+		/// </summary>
+		/// <returns> XMVECTOR </returns>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline XMVECTOR XM_CALLCONV FastATan2(FXMVECTOR y, FXMVECTOR x)
+		{
+			using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+			const XMVECTOR absX = XMVectorAbs(x);
+			const XMVECTOR absY = XMVectorAbs(y);
+			const XMVECTOR maxValue = XMVectorMax(absX, absY);
+			const XMVECTOR minValue = XMVectorMin(absX, absY);
+			const XMVECTOR zero = XMVectorZero();
+
+			XMVECTOR ratio = XMVectorSelect(zero, XMVectorDivide(minValue, maxValue), XMVectorGreater(maxValue, zero));
+			XMVECTOR offset = zero;
+
+			if constexpr (Coefficients::ATANREDUCE)
+			{
+				const XMVECTOR one = XMVectorSplatOne();
+				const XMVECTOR reduceMask = XMVectorGreater(ratio, XMVectorReplicate(TrigDetail::TANPIOVER8));
+				const XMVECTOR reducedRatio = XMVectorDivide(XMVectorSubtract(ratio, one), XMVectorAdd(ratio, one));
+
+				ratio = XMVectorSelect(ratio, reducedRatio, reduceMask);
+				offset = XMVectorAndInt(XMVectorReplicate(TrigDetail::QUARTERPI), reduceMask);
+			}
+
+			XMVECTOR result = XMVectorMultiplyAdd(ratio, TrigDetail::Horner(XMVectorMultiply(ratio, ratio), Coefficients::ATAN), offset);
+
+			result = XMVectorSelect(result, XMVectorSubtract(XMVectorReplicate(HALFPI), result), XMVectorGreater(absY, absX));
+			const XMVECTOR xNegative = XMVectorEqualInt(XMVectorAndInt(x, g_XMNegativeZero), g_XMNegativeZero);
+			result = XMVectorSelect(result, XMVectorSubtract(XMVectorReplicate(PI), result), xNegative);
+
+			return XMVectorXorInt(result, XMVectorAndInt(y, g_XMNegativeZero));
+		}
+
+
+#if defined(_XM_AVX2_INTRINSICS_)
+
+		// ===================== 8 WIDE (AVX2) APPROXIMATIONS =========================
+
+		/// <summary>
+		/// Computes the Sine and Cosine for all eight lanes (angles in radians)
+		/// </summary>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline void XM_CALLCONV FastSinCos(__m256 angle, __m256* outSin, __m256* outCos)
+		{
+			using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+			const __m256 quadrant = _mm256_round_ps(_mm256_mul_ps(angle, _mm256_set1_ps(TrigDetail::TWOOVERPI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+			__m256 reduced = _mm256_fnmadd_ps(quadrant, _mm256_set1_ps(TrigDetail::PIO2_1), angle);
+			reduced = _mm256_fnmadd_ps(quadrant, _mm256_set1_ps(TrigDetail::PIO2_2), reduced);
+			reduced = _mm256_fnmadd_ps(quadrant, _mm256_set1_ps(TrigDetail::PIO2_3), reduced);
+
+			const __m256 reducedSq = _mm256_mul_ps(reduced, reduced);
+			const __m256 sine = _mm256_mul_ps(reduced, TrigDetail::Horner(reducedSq, Coefficients::SIN));
+			const __m256 cosine = TrigDetail::Horner(reducedSq, Coefficients::COS);
+
+			const __m256i quadrantInt = _mm256_cvtps_epi32(quadrant);
+			const __m256i one = _mm256_set1_epi32(1);
+
+			const __m256 swapMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrantInt, one), one));
+			const __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_srli_epi32(quadrantInt, 1), 31));
+			const __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_srli_epi32(_mm256_add_epi32(quadrantInt, one), 1), 31));
+
+			__m256 resultSin = _mm256_xor_ps(_mm256_blendv_ps(sine, cosine, swapMask), sinSign);
+			__m256 resultCos = _mm256_xor_ps(_mm256_blendv_ps(cosine, sine, swapMask), cosSign);
+
+			const __m256 absAngle = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), angle);
+			if (_mm256_movemask_ps(_mm256_cmp_ps(absAngle, _mm256_set1_ps(TrigDetail::REDUCTIONLIMIT), _CMP_NLE_UQ)) != 0)
+			{
+				alignas(32) float angles[8], sines[8], cosines[8];
+				_mm256_store_ps(angles, angle);
+				_mm256_store_ps(sines, resultSin);
+				_mm256_store_ps(cosines, resultCos);
+
+				TrigDetail::FixupLargeAngles(angles, sines, cosines, 8);
+
+				resultSin = _mm256_load_ps(sines);
+				resultCos = _mm256_load_ps(cosines);
+			}
+
+			*outSin = resultSin;
+			*outCos = resultCos;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Sine for all eight lanes (angles in radians)
+		/// </summary>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline __m256 XM_CALLCONV FastSin(__m256 angle)
+		{
+			__m256 sine, cosine;
+			FastSinCos<Precision>(angle, &sine, &cosine);
+			return sine;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the CoSine for all eight lanes (angles in radians)
+		/// </summary>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline __m256 XM_CALLCONV FastCos(__m256 angle)
+		{
+			__m256 sine, cosine;
+			FastSinCos<Precision>(angle, &sine, &cosine);
+			return cosine;
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Tangent for all eight lanes (angles in radians)
+		/// </summary>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline __m256 XM_CALLCONV FastTan(__m256 angle)
+		{
+			__m256 sine, cosine;
+			FastSinCos<Precision>(angle, &sine, &cosine);
+			return _mm256_div_ps(sine, cosine);
+		}
+
+		/// <summary>
+		///  Polynomial approximation of the Arc Tangent of y/x for all eight lanes (results in radians)
+		/// </summary>
+		template <TrigPrecision Precision = TrigPrecision::Medium>
+		inline __m256 XM_CALLCONV FastATan2(__m256 y, __m256 x)
+		{
+			using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+			const __m256 signMask = _mm256_set1_ps(-0.0f);
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 absX = _mm256_andnot_ps(signMask, x);
+			const __m256 absY = _mm256_andnot_ps(signMask, y);
+			const __m256 maxValue = _mm256_max_ps(absX, absY);
+			const __m256 minValue = _mm256_min_ps(absX, absY);
+
+			__m256 ratio = _mm256_and_ps(_mm256_div_ps(minValue, maxValue), _mm256_cmp_ps(maxValue, zero, _CMP_GT_OQ));
+			__m256 offset = zero;
+
+			if constexpr (Coefficients::ATANREDUCE)
+			{
+				const __m256 one = _mm256_set1_ps(1.0f);
+				const __m256 reduceMask = _mm256_cmp_ps(ratio, _mm256_set1_ps(TrigDetail::TANPIOVER8), _CMP_GT_OQ);
+				const __m256 reducedRatio = _mm256_div_ps(_mm256_sub_ps(ratio, one), _mm256_add_ps(ratio, one));
+
+				ratio = _mm256_blendv_ps(ratio, reducedRatio, reduceMask);
+				offset = _mm256_and_ps(_mm256_set1_ps(TrigDetail::QUARTERPI), reduceMask);
+			}
+
+			__m256 result = _mm256_fmadd_ps(ratio, TrigDetail::Horner(_mm256_mul_ps(ratio, ratio), Coefficients::ATAN), offset);
+
+			result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(HALFPI), result), _mm256_cmp_ps(absY, absX, _CMP_GT_OQ));
+			// blendv picks on the sign bit , so -0 counts as negative like in std::atan2
+			result = _mm256_blendv_ps(result, _mm256_sub_ps(_mm256_set1_ps(PI), result), x);
+
+			return _mm256_xor_ps(result, _mm256_and_ps(signMask, y));
+		}
+
+#endif // _XM_AVX2_INTRINSICS_
+
+
+		// ===================== BATCH (ARRAY) APIS =========================
+
+		/// <summary>
+		/// Sine of every angle in the array (radians) , runs on the SSE4.2 / AVX2 / AVX-512 kernel picked by MathDispatch.
+		/// The output array may alias the input
+		/// </summary>
+		SNP_API void FastSinArray(const float* angles, float* results, size_t count, TrigPrecision precision = TrigPrecision::Medium);
+
+		/// <summary>
+		/// CoSine of every angle in the array (radians) , output may alias the input
+		/// </summary>
+		SNP_API void FastCosArray(const float* angles, float* results, size_t count, TrigPrecision precision = TrigPrecision::Medium);
+
+		/// <summary>
+		/// Sine and CoSine of every angle in the array (radians) sharing the range reduction
+		/// </summary>
+		SNP_API void FastSinCosArray(const float* angles, float* outSines, float* outCosines, size_t count, TrigPrecision precision = TrigPrecision::Medium);
+
+		/// <summary>
+		/// Tangent of every angle in the array (radians) , output may alias the input
+		/// </summary>
+		SNP_API void FastTanArray(const float* angles, float* results, size_t count, TrigPrecision precision = TrigPrecision::Medium);
+
+		/// <summary>
+		/// Arc Tangent of y[i]/x[i] for every pair (results in radians) , output may alias either input
+		/// </summary>
+		SNP_API void FastATan2Array(const float* y, const float* x, float* results, size_t count, TrigPrecision precision = TrigPrecision::Medium);
+
+		/// <summary>
+		/// Accuracy self test : every tier's scalar , 4 wide and dispatched array paths against std:: (in double) ,
+		/// held to the TRIG_MAX*ERROR bounds. The atan2 signed zero and axis cases have to match std::atan2 exactly.
+		/// Logs every failure , returns false if there was one
+		/// </summary>
+		SNP_API bool VerifyTrig();
+
+	}
+}
+
+#endif // !FASTTRIG_H
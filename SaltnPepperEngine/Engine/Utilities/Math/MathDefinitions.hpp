@@ -301,7 +301,7 @@ namespace SaltnPepperEngine
 			const XMVECTOR vecOne = XMLoadFloat3(&vectorOne);
 			const XMVECTOR vecTwo = XMLoadFloat3(&vectorTwo);
 
-			return Distance(vectorOne, vectorTwo);
+			return Distance(vecOne, vecTwo);
 		}
 
 
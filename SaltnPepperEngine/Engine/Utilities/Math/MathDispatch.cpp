@@ -0,0 +1,212 @@
+#include "MathDispatch.hpp"
+#include "Core/System/CpuFeatures.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		MathKernelTable MathDispatch::s_kernels;
+		SimdTier MathDispatch::s_tier = SimdTier::SSE42;
+
+		namespace
+		{
+			inline static constexpr std::string_view TIERSWITCH = "--simd-tier=";
+			inline static constexpr const char* TIERENVIRONMENT = "SNP_SIMD_TIER";
+
+			template <typename Function>
+			inline void Overlay(Function& target, Function source)
+			{
+				if (source != nullptr) { target = source; }
+			}
+
+			void OverlayTable(MathKernelTable& target, const MathKernelTable& source)
+			{
+				Overlay(target.SinCos, source.SinCos);
+				Overlay(target.Tan, source.Tan);
+				Overlay(target.ATan2, source.ATan2);
+				Overlay(target.NLerp, source.NLerp);
+				Overlay(target.Slerp, source.Slerp);
+				Overlay(target.SlerpApprox, source.SlerpApprox);
+				Overlay(target.InterpolateTransforms, source.InterpolateTransforms);
+				Overlay(target.PackFloats, source.PackFloats);
+				Overlay(target.UnpackFloats, source.UnpackFloats);
+				Overlay(target.RandomUInt, source.RandomUInt);
+				Overlay(target.RandomFloat, source.RandomFloat);
+				Overlay(target.RandomGaussian, source.RandomGaussian);
+				Overlay(target.RandomOnSphere, source.RandomOnSphere);
+				Overlay(target.RandomInDisc, source.RandomInDisc);
+				Overlay(target.Noise, source.Noise);
+				Overlay(target.BoundsMinMax, source.BoundsMinMax);
+				Overlay(target.BoundsFarthest, source.BoundsFarthest);
+				Overlay(target.BoundsMoments, source.BoundsMoments);
+				Overlay(target.BoundsProject, source.BoundsProject);
+			}
+
+			std::string ReadEnvironment(const char* name)
+			{
+#if defined(_MSC_VER)
+				char* value = nullptr;
+				size_t length = 0;
+				if (_dupenv_s(&value, &length, name) != 0 || value == nullptr) { return std::string(); }
+
+				std::string result(value);
+				free(value);
+				return result;
+#else
+				const char* value = std::getenv(name);
+				return value != nullptr ? std::string(value) : std::string();
+#endif
+			}
+
+			bool EqualsIgnoreCase(std::string_view first, std::string_view second)
+			{
+				if (first.size() != second.size()) { return false; }
+
+				for (size_t index = 0; index < first.size(); ++index)
+				{
+					if (std::tolower(static_cast<unsigned char>(first[index])) != std::tolower(static_cast<unsigned char>(second[index])))
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+
+			/// <summary>
+			/// The tier the first GetKernels call picks : the best supported one , or the SNP_SIMD_TIER override if it names
+			/// a tier the CPU can run. No logging , this can run before Log::OnInit (OnInit reports a bad override)
+			/// </summary>
+			SimdTier GetDefaultTier()
+			{
+				const std::string requested = ReadEnvironment(TIERENVIRONMENT);
+
+				SimdTier forcedTier;
+				if (!requested.empty() && MathDispatch::ParseTier(requested, forcedTier) && MathDispatch::IsTierSupported(forcedTier))
+				{
+					return forcedTier;
+				}
+
+				return MathDispatch::GetBestSupportedTier();
+			}
+		}
+
+		void MathDispatch::SelectTier(SimdTier tier)
+		{
+			MathKernelTable table = Kernels::GetSSE42Kernels();
+
+			if (tier >= SimdTier::AVX2) { OverlayTable(table, Kernels::GetAVX2Kernels()); }
+			if (tier >= SimdTier::AVX512) { OverlayTable(table, Kernels::GetAVX512Kernels()); }
+
+			s_kernels = table;
+			s_tier = tier;
+		}
+
+		void MathDispatch::OnInit(int argc, char** argv)
+		{
+			// Make sure the default selection (which already applied a valid SNP_SIMD_TIER) has happened so it can't
+			// overwrite the command line override later
+			GetKernels();
+
+			const SimdTier bestTier = GetBestSupportedTier();
+			std::string requested;
+
+			for (int index = 1; index < argc && argv != nullptr; ++index)
+			{
+				const std::string_view argument(argv[index]);
+				if (argument.substr(0, TIERSWITCH.size()) == TIERSWITCH)
+				{
+					requested = std::string(argument.substr(TIERSWITCH.size()));
+				}
+			}
+
+			if (requested.empty())
+			{
+				requested = ReadEnvironment(TIERENVIRONMENT);
+			}
+
+			if (!requested.empty())
+			{
+				SimdTier forcedTier;
+				if (!ParseTier(requested, forcedTier))
+				{
+					LOG_WARN("Unknown SIMD tier override : {0} (expected sse42 , avx2 or avx512)", requested);
+				}
+				else if (!SetTier(forcedTier))
+				{
+					LOG_WARN("SIMD tier override {0} is not supported on this CPU , staying on {1}", GetTierName(forcedTier), GetTierName(s_tier));
+				}
+			}
+
+			LOG_INFO("Math kernels : {0} (best supported : {1} , vendor : {2})", GetTierName(s_tier), GetTierName(bestTier), Platform::GetCpuFeatures().Vendor);
+		}
+
+		bool MathDispatch::SetTier(SimdTier tier)
+		{
+			GetKernels();
+
+			if (!IsTierSupported(tier)) { return false; }
+
+			SelectTier(tier);
+			return true;
+		}
+
+		SimdTier MathDispatch::GetTier()
+		{
+			GetKernels();
+			return s_tier;
+		}
+
+		SimdTier MathDispatch::GetBestSupportedTier()
+		{
+			if (IsTierSupported(SimdTier::AVX512)) { return SimdTier::AVX512; }
+			if (IsTierSupported(SimdTier::AVX2)) { return SimdTier::AVX2; }
+			return SimdTier::SSE42;
+		}
+
+		bool MathDispatch::IsTierSupported(SimdTier tier)
+		{
+			const Platform::CpuFeatures& features = Platform::GetCpuFeatures();
+
+			switch (tier)
+			{
+			// /arch:AVX512 lets the compiler use DQ / BW / VL instructions anywhere in that translation unit , and the tier
+			// runs on top of the AVX2 kernels
+			case SimdTier::AVX512: return features.AVX512F && features.AVX512DQ && features.AVX512BW && features.AVX512VL && IsTierSupported(SimdTier::AVX2);
+			case SimdTier::AVX2: return features.AVX2 && features.FMA && features.F16C;
+			default: return true;
+			}
+		}
+
+		const MathKernelTable& MathDispatch::GetKernels()
+		{
+			// Thread safe one time default selection
+			static const bool selected = (SelectTier(GetDefaultTier()), true);
+			(void)selected;
+
+			return s_kernels;
+		}
+
+		const char* MathDispatch::GetTierName(SimdTier tier)
+		{
+			switch (tier)
+			{
+			case SimdTier::AVX512: return "avx512";
+			case SimdTier::AVX2: return "avx2";
+			default: return "sse42";
+			}
+		}
+
+		bool MathDispatch::ParseTier(std::string_view name, SimdTier& outTier)
+		{
+			if (EqualsIgnoreCase(name, "sse42") || EqualsIgnoreCase(name, "sse4.2")) { outTier = SimdTier::SSE42; return true; }
+			if (EqualsIgnoreCase(name, "avx2")) { outTier = SimdTier::AVX2; return true; }
+			if (EqualsIgnoreCase(name, "avx512") || EqualsIgnoreCase(name, "avx-512")) { outTier = SimdTier::AVX512; return true; }
+
+			return false;
+		}
+	}
+}
@@ -0,0 +1,131 @@
+#ifndef MATHDISPATCH_H
+#define MATHDISPATCH_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/FastTrig.hpp"
+#include "Utilities/Math/QuaternionBatch.hpp"
+#include "Utilities/Math/TransformBatch.hpp"
+#include "Utilities/Math/PackedConversion.hpp"
+#include "Utilities/Math/Random.hpp"
+#include "Utilities/Math/Noise.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Instruction set tiers the batch math kernels are compiled for.
+		/// SSE4.2 is the engine baseline , the other tiers live in translation units built with /arch:AVX2 and /arch:AVX512
+		/// </summary>
+		enum class SimdTier : uint8_t
+		{
+			SSE42,
+			AVX2,
+			AVX512
+		};
+
+		/// <summary>
+		/// Function table for every batch math kernel.
+		/// A tier may leave an entry null , it then inherits the implementation of the tier below it
+		/// </summary>
+		struct MathKernelTable
+		{
+			void (*SinCos)(const float* angles, float* outSines, float* outCosines, size_t count, TrigPrecision precision) = nullptr;
+			void (*Tan)(const float* angles, float* results, size_t count, TrigPrecision precision) = nullptr;
+			void (*ATan2)(const float* y, const float* x, float* results, size_t count, TrigPrecision precision) = nullptr;
+
+			// Quaternion blends , weights == nullptr means every element uses uniformWeight
+			void (*NLerp)(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float uniformWeight, const QuaternionSoA& result, size_t count) = nullptr;
+			void (*Slerp)(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float uniformWeight, const QuaternionSoA& result, size_t count) = nullptr;
+			void (*SlerpApprox)(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float uniformWeight, const QuaternionSoA& result, size_t count) = nullptr;
+
+			// Blended TRS pairs to row major 4x4 world matrices (16 floats each)
+			void (*InterpolateTransforms)(const TransformSoA& previous, const TransformSoA& current, float alpha, float* outMatrices, size_t count) = nullptr;
+
+			// Float <-> half / normalized integer streams , single threaded (PackFloats / UnpackFloats do the splitting)
+			void (*PackFloats)(const float* source, void* destination, size_t count, PackedFormat format) = nullptr;
+			void (*UnpackFloats)(const void* source, float* destination, size_t count, PackedFormat format) = nullptr;
+
+			// Random fills , output i comes from lane (i % RANDOMLANES). A partial last step still advances every lane
+			void (*RandomUInt)(RandomLanes& lanes, uint32_t* output, size_t count) = nullptr;
+			void (*RandomFloat)(RandomLanes& lanes, float* output, size_t count, float minimum, float maximum) = nullptr;
+			void (*RandomGaussian)(RandomLanes& lanes, float* output, size_t count, float mean, float deviation) = nullptr;
+			void (*RandomOnSphere)(RandomLanes& lanes, float* x, float* y, float* z, size_t count, float radius) = nullptr;
+			void (*RandomInDisc)(RandomLanes& lanes, float* x, float* y, size_t count, float radius) = nullptr;
+
+			// Noise over SoA point arrays , coordinates holds one array per dimension (2 , 3 or 4)
+			void (*Noise)(const NoiseSettings& settings, uint32_t dimensions, const float* const* coordinates, float* output, size_t count) = nullptr;
+
+			// Bounding volume reductions over strided Vector3 streams (stride in bytes , at least 12) , count must be non zero.
+			// Single threaded , the BoundingVolumes builders do the splitting
+			void (*BoundsMinMax)(const void* points, size_t count, size_t stride, float* outMinimum, float* outMaximum) = nullptr;
+			void (*BoundsFarthest)(const void* points, size_t count, size_t stride, const float* center, float* outDistanceSquared, size_t* outIndex) = nullptr;
+			void (*BoundsMoments)(const void* points, size_t count, size_t stride, const float* origin, double* outMoments) = nullptr;
+			void (*BoundsProject)(const void* points, size_t count, size_t stride, const float* axes, float* outMinimum, float* outMaximum) = nullptr;
+		};
+
+		namespace Kernels
+		{
+			// Per tier tables , each one is defined in its own MathKernels<Tier>.cpp
+			const MathKernelTable& GetSSE42Kernels();
+			const MathKernelTable& GetAVX2Kernels();
+			const MathKernelTable& GetAVX512Kernels();
+		}
+
+		/// <summary>
+		/// Picks the kernel table for the running CPU.
+		/// The choice can be forced with the SNP_SIMD_TIER environment variable (honoured from the first kernel call on ,
+		/// OnInit or not) or the --simd-tier= command line switch passed to OnInit (values : sse42 , avx2 , avx512)
+		/// for benchmarking and reproducing bugs
+		/// </summary>
+		class SNP_API MathDispatch
+		{
+		public:
+
+			/// <summary>
+			/// Detects the CPU features and applies any tier override , call once at startup (after Log::OnInit)
+			/// </summary>
+			static void OnInit(int argc = 0, char** argv = nullptr);
+
+			/// <summary>
+			/// Forces a tier. Returns false (and keeps the current tier) if the CPU cannot run it.
+			/// Not thread safe , only switch tiers while no kernels are running
+			/// </summary>
+			static bool SetTier(SimdTier tier);
+
+			/// <summary>
+			/// The tier the kernels are currently dispatched to
+			/// </summary>
+			static SimdTier GetTier();
+
+			/// <summary>
+			/// The highest tier the current CPU (and OS) supports
+			/// </summary>
+			static SimdTier GetBestSupportedTier();
+
+			/// <summary>
+			/// Returns whether the current CPU can run the given tier
+			/// </summary>
+			static bool IsTierSupported(SimdTier tier);
+
+			/// <summary>
+			/// The active kernel table , every entry is guaranteed to be non null
+			/// </summary>
+			static const MathKernelTable& GetKernels();
+
+			static const char* GetTierName(SimdTier tier);
+			static bool ParseTier(std::string_view name, SimdTier& outTier);
+
+		private:
+
+			static void SelectTier(SimdTier tier);
+
+			static MathKernelTable s_kernels;
+			static SimdTier s_tier;
+		};
+	}
+}
+
+#endif // !MATHDISPATCH_H
@@ -0,0 +1,859 @@
+// This translation unit is compiled with /arch:AVX2 , it must only be reached through MathDispatch.
+// Keep it free of scalar / XMVECTOR inline helpers so no AVX encoded copy of them can leak to the other tiers.
+#include "MathDispatch.hpp"
+#include "NoiseDetail.hpp"
+#include "BoundsDetail.hpp"
+#include "TransformDetail.hpp"
+#include <cstring>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+#if defined(_XM_AVX2_INTRINSICS_)
+
+		namespace
+		{
+			// Lane mask with the first 'remaining' lanes enabled
+			inline __m256i TailMask(size_t remaining)
+			{
+				return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(remaining)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+			}
+
+			template <TrigPrecision Precision>
+			void SinCosArrayImpl(const float* angles, float* outSines, float* outCosines, size_t count)
+			{
+				size_t index = 0;
+
+				for (; index + 8 <= count; index += 8)
+				{
+					__m256 sine, cosine;
+					FastSinCos<Precision>(_mm256_loadu_ps(angles + index), &sine, &cosine);
+
+					if (outSines) { _mm256_storeu_ps(outSines + index, sine); }
+					if (outCosines) { _mm256_storeu_ps(outCosines + index, cosine); }
+				}
+
+				if (index < count)
+				{
+					const __m256i mask = TailMask(count - index);
+
+					__m256 sine, cosine;
+					FastSinCos<Precision>(_mm256_maskload_ps(angles + index, mask), &sine, &cosine);
+
+					if (outSines) { _mm256_maskstore_ps(outSines + index, mask, sine); }
+					if (outCosines) { _mm256_maskstore_ps(outCosines + index, mask, cosine); }
+				}
+			}
+
+			template <TrigPrecision Precision>
+			void TanArrayImpl(const float* angles, float* results, size_t count)
+			{
+				size_t index = 0;
+
+				for (; index + 8 <= count; index += 8)
+				{
+					_mm256_storeu_ps(results + index, FastTan<Precision>(_mm256_loadu_ps(angles + index)));
+				}
+
+				if (index < count)
+				{
+					const __m256i mask = TailMask(count - index);
+					_mm256_maskstore_ps(results + index, mask, FastTan<Precision>(_mm256_maskload_ps(angles + index, mask)));
+				}
+			}
+
+			template <TrigPrecision Precision>
+			void ATan2ArrayImpl(const float* y, const float* x, float* results, size_t count)
+			{
+				size_t index = 0;
+
+				for (; index + 8 <= count; index += 8)
+				{
+					_mm256_storeu_ps(results + index, FastATan2<Precision>(_mm256_loadu_ps(y + index), _mm256_loadu_ps(x + index)));
+				}
+
+				if (index < count)
+				{
+					const __m256i mask = TailMask(count - index);
+					const __m256 result = FastATan2<Precision>(_mm256_maskload_ps(y + index, mask), _mm256_maskload_ps(x + index, mask));
+					_mm256_maskstore_ps(results + index, mask, result);
+				}
+			}
+
+			enum class QuaternionBlend : uint8_t
+			{
+				NLerp,
+				Slerp,
+				SlerpApprox
+			};
+
+			/// <summary>
+			/// Blends 8 quaternions held as SoA registers (component major : x , y , z , w)
+			/// </summary>
+			template <QuaternionBlend Blend>
+			inline void BlendLanes(const __m256 from[4], __m256 to[4], __m256 weight, __m256 result[4])
+			{
+				const __m256 one = _mm256_set1_ps(1.0f);
+				const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+				__m256 dot = _mm256_mul_ps(from[0], to[0]);
+				dot = _mm256_fmadd_ps(from[1], to[1], dot);
+				dot = _mm256_fmadd_ps(from[2], to[2], dot);
+				dot = _mm256_fmadd_ps(from[3], to[3], dot);
+
+				// Shortest path : flip 'to' wherever the pair lies in opposite hemispheres
+				const __m256 sign = _mm256_and_ps(dot, signMask);
+				for (int component = 0; component < 4; ++component) { to[component] = _mm256_xor_ps(to[component], sign); }
+
+				const __m256 cosTheta = _mm256_andnot_ps(signMask, dot);
+				__m256 weightFrom;
+				__m256 weightTo;
+
+				if constexpr (Blend == QuaternionBlend::Slerp)
+				{
+					const __m256 sinTheta = _mm256_sqrt_ps(_mm256_max_ps(_mm256_setzero_ps(), _mm256_fnmadd_ps(cosTheta, cosTheta, one)));
+					const __m256 theta = FastATan2<TrigPrecision::Full>(sinTheta, cosTheta);
+					const __m256 inverseSin = _mm256_div_ps(one, sinTheta);
+
+					const __m256 sinFrom = FastSin<TrigPrecision::Full>(_mm256_mul_ps(_mm256_sub_ps(one, weight), theta));
+					const __m256 sinTo = FastSin<TrigPrecision::Full>(_mm256_mul_ps(weight, theta));
+
+					// Nearly identical rotations fall back to a plain lerp (same threshold as XMQuaternionSlerp)
+					const __m256 linear = _mm256_cmp_ps(cosTheta, _mm256_set1_ps(1.0f - 0.00001f), _CMP_GT_OQ);
+
+					weightFrom = _mm256_blendv_ps(_mm256_mul_ps(sinFrom, inverseSin), _mm256_sub_ps(one, weight), linear);
+					weightTo = _mm256_blendv_ps(_mm256_mul_ps(sinTo, inverseSin), weight, linear);
+				}
+				else
+				{
+					__m256 delta = weight;
+
+					if constexpr (Blend == QuaternionBlend::SlerpApprox)
+					{
+						// Cubic correction of the NLerp weight (A. Kapoulkine , "Approximating slerp")
+						const __m256 centered = _mm256_sub_ps(delta, _mm256_set1_ps(0.5f));
+
+						__m256 factorA = _mm256_fmadd_ps(cosTheta, _mm256_set1_ps(-1.43519f), _mm256_set1_ps(3.55645f));
+						factorA = _mm256_fmadd_ps(cosTheta, factorA, _mm256_set1_ps(-3.2452f));
+						factorA = _mm256_fmadd_ps(cosTheta, factorA, _mm256_set1_ps(1.0904f));
+
+						__m256 factorB = _mm256_fmadd_ps(cosTheta, _mm256_set1_ps(0.215638f), _mm256_set1_ps(-1.06021f));
+						factorB = _mm256_fmadd_ps(cosTheta, factorB, _mm256_set1_ps(0.848013f));
+
+						const __m256 correction = _mm256_fmadd_ps(_mm256_mul_ps(factorA, centered), centered, factorB);
+						const __m256 cubic = _mm256_mul_ps(_mm256_mul_ps(delta, centered), _mm256_sub_ps(delta, one));
+
+						delta = _mm256_fmadd_ps(cubic, correction, delta);
+					}
+
+					weightFrom = _mm256_sub_ps(one, delta);
+					weightTo = delta;
+				}
+
+				for (int component = 0; component < 4; ++component)
+				{
+					result[component] = _mm256_fmadd_ps(from[component], weightFrom, _mm256_mul_ps(to[component], weightTo));
+				}
+
+				if constexpr (Blend != QuaternionBlend::Slerp)
+				{
+					__m256 lengthSq = _mm256_mul_ps(result[0], result[0]);
+					lengthSq = _mm256_fmadd_ps(result[1], result[1], lengthSq);
+					lengthSq = _mm256_fmadd_ps(result[2], result[2], lengthSq);
+					lengthSq = _mm256_fmadd_ps(result[3], result[3], lengthSq);
+
+					// Full precision square root , rsqrt alone would leave ~1e-4 of length error
+					const __m256 inverseLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSq));
+					for (int component = 0; component < 4; ++component) { result[component] = _mm256_mul_ps(result[component], inverseLength); }
+				}
+			}
+
+			template <QuaternionBlend Blend>
+			void BlendArrayImpl(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float uniformWeight, const QuaternionSoA& result, size_t count)
+			{
+				const float* fromStreams[4] = { from.x, from.y, from.z, from.w };
+				const float* toStreams[4] = { to.x, to.y, to.z, to.w };
+				float* resultStreams[4] = { result.x, result.y, result.z, result.w };
+
+				const __m256 uniform = _mm256_set1_ps(uniformWeight);
+				size_t index = 0;
+
+				for (; index + 8 <= count; index += 8)
+				{
+					__m256 fromLanes[4], toLanes[4], resultLanes[4];
+					for (int component = 0; component < 4; ++component)
+					{
+						fromLanes[component] = _mm256_loadu_ps(fromStreams[component] + index);
+						toLanes[component] = _mm256_loadu_ps(toStreams[component] + index);
+					}
+
+					const __m256 weight = weights != nullptr ? _mm256_loadu_ps(weights + index) : uniform;
+
+					BlendLanes<Blend>(fromLanes, toLanes, weight, resultLanes);
+
+					for (int component = 0; component < 4; ++component) { _mm256_storeu_ps(resultStreams[component] + index, resultLanes[component]); }
+				}
+
+				if (index < count)
+				{
+					const __m256i mask = TailMask(count - index);
+
+					__m256 fromLanes[4], toLanes[4], resultLanes[4];
+					for (int component = 0; component < 4; ++component)
+					{
+						fromLanes[component] = _mm256_maskload_ps(fromStreams[component] + index, mask);
+						toLanes[component] = _mm256_maskload_ps(toStreams[component] + index, mask);
+					}
+
+					// Unused tail lanes blend identity with identity so they can't produce NaNs
+					const __m256 identityW = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_setzero_ps(), _mm256_castsi256_ps(mask));
+					fromLanes[3] = _mm256_or_ps(fromLanes[3], identityW);
+					toLanes[3] = _mm256_or_ps(toLanes[3], identityW);
+
+					const __m256 weight = weights != nullptr ? _mm256_maskload_ps(weights + index, mask) : uniform;
+
+					BlendLanes<Blend>(fromLanes, toLanes, weight, resultLanes);
+
+					for (int component = 0; component < 4; ++component) { _mm256_maskstore_ps(resultStreams[component] + index, mask, resultLanes[component]); }
+				}
+			}
+
+			// Floats converted per iteration
+			inline static constexpr size_t PACKBLOCKSIZE = 16;
+
+			struct NormRange
+			{
+				float minimum;
+				float scale;
+			};
+
+			constexpr NormRange GetNormRange(PackedFormat format)
+			{
+				switch (format)
+				{
+				case PackedFormat::SNorm8: return NormRange{ -1.0f, 127.0f };
+				case PackedFormat::SNorm16: return NormRange{ -1.0f, 32767.0f };
+				case PackedFormat::UNorm8: return NormRange{ 0.0f, 255.0f };
+				default: return NormRange{ 0.0f, 65535.0f };
+				}
+			}
+
+			template <PackedFormat Format>
+			inline __m256i QuantizeLanes(__m256 values)
+			{
+				constexpr NormRange range = GetNormRange(Format);
+
+				// Same clamp order as the SSE4.2 tier so NaNs land on the same value
+				const __m256 clamped = _mm256_min_ps(_mm256_max_ps(values, _mm256_set1_ps(range.minimum)), _mm256_set1_ps(1.0f));
+				return _mm256_cvtps_epi32(_mm256_mul_ps(clamped, _mm256_set1_ps(range.scale)));
+			}
+
+			template <PackedFormat Format>
+			inline __m256 DequantizeLanes(__m256i values)
+			{
+				constexpr NormRange range = GetNormRange(Format);
+				return _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(values), _mm256_set1_ps(1.0f / range.scale)), _mm256_set1_ps(range.minimum));
+			}
+
+			template <PackedFormat Format>
+			inline void PackBlock(const float* source, uint8_t* destination)
+			{
+				if constexpr (Format == PackedFormat::Half)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm256_cvtps_ph(_mm256_loadu_ps(source), _MM_FROUND_TO_NEAREST_INT));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 16), _mm256_cvtps_ph(_mm256_loadu_ps(source + 8), _MM_FROUND_TO_NEAREST_INT));
+				}
+				else
+				{
+					const __m256i low = QuantizeLanes<Format>(_mm256_loadu_ps(source));
+					const __m256i high = QuantizeLanes<Format>(_mm256_loadu_ps(source + 8));
+
+					// 256 bit packs work per 128 bit lane , the permute puts the 16 words back in order
+					const __m256i words = Format == PackedFormat::UNorm16 ? _mm256_packus_epi32(low, high) : _mm256_packs_epi32(low, high);
+					const __m256i ordered = _mm256_permute4x64_epi64(words, 0xD8);
+
+					if constexpr (Format == PackedFormat::SNorm16 || Format == PackedFormat::UNorm16)
+					{
+						_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), ordered);
+					}
+					else
+					{
+						const __m128i first = _mm256_castsi256_si128(ordered);
+						const __m128i second = _mm256_extracti128_si256(ordered, 1);
+						const __m128i bytes = Format == PackedFormat::SNorm8 ? _mm_packs_epi16(first, second) : _mm_packus_epi16(first, second);
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), bytes);
+					}
+				}
+			}
+
+			template <PackedFormat Format>
+			inline void UnpackBlock(const uint8_t* source, float* destination)
+			{
+				if constexpr (Format == PackedFormat::Half)
+				{
+					_mm256_storeu_ps(destination, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source))));
+					_mm256_storeu_ps(destination + 8, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16))));
+				}
+				else
+				{
+					__m256i low;
+					__m256i high;
+
+					if constexpr (Format == PackedFormat::SNorm16 || Format == PackedFormat::UNorm16)
+					{
+						const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+						const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16));
+						low = Format == PackedFormat::SNorm16 ? _mm256_cvtepi16_epi32(first) : _mm256_cvtepu16_epi32(first);
+						high = Format == PackedFormat::SNorm16 ? _mm256_cvtepi16_epi32(second) : _mm256_cvtepu16_epi32(second);
+					}
+					else
+					{
+						const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+						low = Format == PackedFormat::SNorm8 ? _mm256_cvtepi8_epi32(bytes) : _mm256_cvtepu8_epi32(bytes);
+						high = Format == PackedFormat::SNorm8 ? _mm256_cvtepi8_epi32(_mm_srli_si128(bytes, 8)) : _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+					}
+
+					_mm256_storeu_ps(destination, DequantizeLanes<Format>(low));
+					_mm256_storeu_ps(destination + 8, DequantizeLanes<Format>(high));
+				}
+			}
+
+			template <PackedFormat Format>
+			void PackArrayImpl(const float* source, void* destination, size_t count)
+			{
+				constexpr size_t elementSize = GetPackedSize(Format);
+				uint8_t* const bytes = static_cast<uint8_t*>(destination);
+				size_t index = 0;
+
+				for (; index + PACKBLOCKSIZE <= count; index += PACKBLOCKSIZE)
+				{
+					PackBlock<Format>(source + index, bytes + index * elementSize);
+				}
+
+				// Tail goes through padded stack copies so the block code never reads or writes out of bounds
+				if (index < count)
+				{
+					float staged[PACKBLOCKSIZE] = {};
+					uint8_t packed[PACKBLOCKSIZE * 2];
+
+					memcpy(staged, source + index, (count - index) * sizeof(float));
+					PackBlock<Format>(staged, packed);
+					memcpy(bytes + index * elementSize, packed, (count - index) * elementSize);
+				}
+			}
+
+			template <PackedFormat Format>
+			void UnpackArrayImpl(const void* source, float* destination, size_t count)
+			{
+				constexpr size_t elementSize = GetPackedSize(Format);
+				const uint8_t* const bytes = static_cast<const uint8_t*>(source);
+				size_t index = 0;
+
+				for (; index + PACKBLOCKSIZE <= count; index += PACKBLOCKSIZE)
+				{
+					UnpackBlock<Format>(bytes + index * elementSize, destination + index);
+				}
+
+				if (index < count)
+				{
+					uint8_t staged[PACKBLOCKSIZE * 2] = {};
+					float unpacked[PACKBLOCKSIZE];
+
+					memcpy(staged, bytes + index * elementSize, (count - index) * elementSize);
+					UnpackBlock<Format>(staged, unpacked);
+					memcpy(destination + index, unpacked, (count - index) * sizeof(float));
+				}
+			}
+
+			template <int Shift>
+			inline __m256i RotateLeft(__m256i value)
+			{
+				return _mm256_or_si256(_mm256_slli_epi32(value, Shift), _mm256_srli_epi32(value, 32 - Shift));
+			}
+
+			// All 8 xoshiro128** lanes in registers for the length of a fill , written back at the end
+			class RandomState
+			{
+			public:
+
+				explicit RandomState(RandomLanes& lanes) : m_lanes(lanes)
+				{
+					m_s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes.state[0]));
+					m_s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes.state[1]));
+					m_s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes.state[2]));
+					m_s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes.state[3]));
+				}
+
+				~RandomState()
+				{
+					_mm256_store_si256(reinterpret_cast<__m256i*>(m_lanes.state[0]), m_s0);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(m_lanes.state[1]), m_s1);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(m_lanes.state[2]), m_s2);
+					_mm256_store_si256(reinterpret_cast<__m256i*>(m_lanes.state[3]), m_s3);
+				}
+
+				// The multiplies by 5 and 9 are shift + add , same as the SSE4.2 tier
+				inline __m256i Next()
+				{
+					const __m256i timesFive = _mm256_add_epi32(_mm256_slli_epi32(m_s1, 2), m_s1);
+					const __m256i rotated = RotateLeft<7>(timesFive);
+					const __m256i result = _mm256_add_epi32(_mm256_slli_epi32(rotated, 3), rotated);
+					const __m256i shifted = _mm256_slli_epi32(m_s1, 9);
+
+					m_s2 = _mm256_xor_si256(m_s2, m_s0);
+					m_s3 = _mm256_xor_si256(m_s3, m_s1);
+					m_s1 = _mm256_xor_si256(m_s1, m_s2);
+					m_s0 = _mm256_xor_si256(m_s0, m_s3);
+					m_s2 = _mm256_xor_si256(m_s2, shifted);
+					m_s3 = RotateLeft<11>(m_s3);
+
+					return result;
+				}
+
+				// One step as [0 , 1) floats
+				inline __m256 NextUnit()
+				{
+					return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(Next(), 8)), _mm256_set1_ps(RandomDetail::UNITSCALE));
+				}
+
+			private:
+
+				RandomLanes& m_lanes;
+				__m256i m_s0, m_s1, m_s2, m_s3;
+			};
+
+			// Natural log for positive normal inputs
+			inline __m256 LogPositive(__m256 value)
+			{
+				const __m256 one = _mm256_set1_ps(1.0f);
+				const __m256i bits = _mm256_castps_si256(value);
+
+				// value = mantissa * 2^exponent with mantissa in [0.5 , 1)
+				__m256 exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+				const __m256 mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F000000)));
+
+				// Re-center on 1 : below sqrt(1/2) the mantissa gets doubled
+				const __m256 small = _mm256_cmp_ps(mantissa, _mm256_set1_ps(RandomDetail::SQRTHALF), _CMP_LT_OQ);
+				exponent = _mm256_sub_ps(exponent, _mm256_and_ps(small, one));
+
+				const __m256 x = _mm256_sub_ps(_mm256_add_ps(mantissa, _mm256_and_ps(small, mantissa)), one);
+				const __m256 xSquared = _mm256_mul_ps(x, x);
+
+				__m256 result = _mm256_mul_ps(_mm256_mul_ps(TrigDetail::Horner(x, RandomDetail::LOG), x), xSquared);
+				result = _mm256_fmadd_ps(exponent, _mm256_set1_ps(RandomDetail::LOGLOW), result);
+				result = _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), xSquared, result);
+				return _mm256_fmadd_ps(exponent, _mm256_set1_ps(RandomDetail::LOGHIGH), _mm256_add_ps(x, result));
+			}
+
+			/// <summary>
+			/// Runs generator once per BlockSize outputs , the last partial block is generated into stack copies
+			/// </summary>
+			template <size_t BlockSize, size_t StreamCount, typename Element, typename Generator>
+			inline void FillBlocks(Element* const (&streams)[StreamCount], size_t count, const Generator& generator)
+			{
+				size_t index = 0;
+
+				for (; index + BlockSize <= count; index += BlockSize)
+				{
+					Element* outputs[StreamCount];
+					for (size_t stream = 0; stream < StreamCount; ++stream) { outputs[stream] = streams[stream] + index; }
+
+					generator(outputs);
+				}
+
+				if (index < count)
+				{
+					Element staged[StreamCount][BlockSize];
+					Element* outputs[StreamCount];
+					for (size_t stream = 0; stream < StreamCount; ++stream) { outputs[stream] = staged[stream]; }
+
+					generator(outputs);
+
+					for (size_t stream = 0; stream < StreamCount; ++stream)
+					{
+						memcpy(streams[stream] + index, staged[stream], (count - index) * sizeof(Element));
+					}
+				}
+			}
+
+			void RandomUIntImpl(RandomLanes& lanes, uint32_t* output, size_t count)
+			{
+				RandomState state(lanes);
+				uint32_t* const streams[1] = { output };
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](uint32_t* const* outputs)
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(outputs[0]), state.Next());
+				});
+			}
+
+			void RandomFloatImpl(RandomLanes& lanes, float* output, size_t count, float minimum, float maximum)
+			{
+				RandomState state(lanes);
+				float* const streams[1] = { output };
+
+				const __m256 offset = _mm256_set1_ps(minimum);
+				const __m256 span = _mm256_set1_ps(maximum - minimum);
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](float* const* outputs)
+				{
+					_mm256_storeu_ps(outputs[0], _mm256_fmadd_ps(state.NextUnit(), span, offset));
+				});
+			}
+
+			void RandomGaussianImpl(RandomLanes& lanes, float* output, size_t count, float mean, float deviation)
+			{
+				RandomState state(lanes);
+				float* const streams[1] = { output };
+
+				const __m256 one = _mm256_set1_ps(1.0f);
+				const __m256 center = _mm256_set1_ps(mean);
+				const __m256 scale = _mm256_set1_ps(-2.0f * deviation * deviation);
+				const __m256 twoPi = _mm256_set1_ps(RandomDetail::TWOPI);
+
+				// Box-Muller , every pair of steps gives 16 samples : the cosine half first , then the sine half
+				FillBlocks<RANDOMLANES * 2>(streams, count, [&](float* const* outputs)
+				{
+					const __m256 first = state.NextUnit();
+					const __m256 second = state.NextUnit();
+
+					// 1 - u keeps the log argument in (0 , 1]
+					const __m256 radius = _mm256_sqrt_ps(_mm256_mul_ps(scale, LogPositive(_mm256_sub_ps(one, first))));
+
+					__m256 sine, cosine;
+					FastSinCos<TrigPrecision::Full>(_mm256_mul_ps(second, twoPi), &sine, &cosine);
+
+					_mm256_storeu_ps(outputs[0], _mm256_fmadd_ps(radius, cosine, center));
+					_mm256_storeu_ps(outputs[0] + RANDOMLANES, _mm256_fmadd_ps(radius, sine, center));
+				});
+			}
+
+			void RandomOnSphereImpl(RandomLanes& lanes, float* x, float* y, float* z, size_t count, float radius)
+			{
+				RandomState state(lanes);
+				float* const streams[3] = { x, y, z };
+
+				const __m256 one = _mm256_set1_ps(1.0f);
+				const __m256 scale = _mm256_set1_ps(radius);
+				const __m256 twoPi = _mm256_set1_ps(RandomDetail::TWOPI);
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](float* const* outputs)
+				{
+					const __m256 first = state.NextUnit();
+					const __m256 second = state.NextUnit();
+
+					const __m256 height = _mm256_fnmadd_ps(_mm256_set1_ps(2.0f), first, one);
+					const __m256 ring = _mm256_sqrt_ps(_mm256_max_ps(_mm256_setzero_ps(), _mm256_fnmadd_ps(height, height, one)));
+
+					__m256 sine, cosine;
+					FastSinCos<TrigPrecision::Full>(_mm256_mul_ps(second, twoPi), &sine, &cosine);
+
+					_mm256_storeu_ps(outputs[0], _mm256_mul_ps(_mm256_mul_ps(ring, cosine), scale));
+					_mm256_storeu_ps(outputs[1], _mm256_mul_ps(_mm256_mul_ps(ring, sine), scale));
+					_mm256_storeu_ps(outputs[2], _mm256_mul_ps(height, scale));
+				});
+			}
+
+			void RandomInDiscImpl(RandomLanes& lanes, float* x, float* y, size_t count, float radius)
+			{
+				RandomState state(lanes);
+				float* const streams[2] = { x, y };
+
+				const __m256 scale = _mm256_set1_ps(radius);
+				const __m256 twoPi = _mm256_set1_ps(RandomDetail::TWOPI);
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](float* const* outputs)
+				{
+					const __m256 first = state.NextUnit();
+					const __m256 second = state.NextUnit();
+
+					// sqrt keeps the density uniform over the area
+					const __m256 distance = _mm256_mul_ps(_mm256_sqrt_ps(first), scale);
+
+					__m256 sine, cosine;
+					FastSinCos<TrigPrecision::Full>(_mm256_mul_ps(second, twoPi), &sine, &cosine);
+
+					_mm256_storeu_ps(outputs[0], _mm256_mul_ps(distance, cosine));
+					_mm256_storeu_ps(outputs[1], _mm256_mul_ps(distance, sine));
+				});
+			}
+		}
+
+		namespace
+		{
+			// 8 wide lane type for the shared noise templates
+			struct NoiseLanes
+			{
+				using Float = __m256;
+				using Int = __m256i;
+				using Mask = __m256;
+
+				inline static constexpr size_t WIDTH = 8;
+
+				static Float Set(float value) { return _mm256_set1_ps(value); }
+				static Int SetInt(int32_t value) { return _mm256_set1_epi32(value); }
+				static Float Load(const float* source) { return _mm256_loadu_ps(source); }
+				static void Store(float* destination, Float value) { _mm256_storeu_ps(destination, value); }
+
+				static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+				static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+				static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+				static Float MulAdd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+				static Float Floor(Float value) { return _mm256_floor_ps(value); }
+				static Float Abs(Float value) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value); }
+				static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+
+				static Mask Greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+				static Float Select(Mask mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+				static Mask MaskOr(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+
+				static Int ToInt(Float value) { return _mm256_cvttps_epi32(value); }
+				static Float ToFloat(Int value) { return _mm256_cvtepi32_ps(value); }
+
+				static Int IntAdd(Int a, Int b) { return _mm256_add_epi32(a, b); }
+				static Int IntMul(Int a, Int b) { return _mm256_mullo_epi32(a, b); }
+				static Int IntAnd(Int a, Int b) { return _mm256_and_si256(a, b); }
+				static Int IntXor(Int a, Int b) { return _mm256_xor_si256(a, b); }
+				template <int Shift> static Int IntShiftRight(Int value) { return _mm256_srli_epi32(value, Shift); }
+				static Mask IntLess(Int a, Int b) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(b, a)); }
+				static Mask IntEqual(Int a, Int b) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)); }
+				static Int IntSelect(Mask mask, Int a, Int b) { return _mm256_blendv_epi8(b, a, _mm256_castps_si256(mask)); }
+
+				// Moves hash bit Bit into the sign position and flips the value with it
+				template <int Bit> static Float FlipSign(Float value, Int hash)
+				{
+					const __m256i sign = _mm256_and_si256(_mm256_slli_epi32(hash, 31 - Bit), _mm256_set1_epi32(static_cast<int32_t>(0x80000000u)));
+					return _mm256_xor_ps(value, _mm256_castsi256_ps(sign));
+				}
+			};
+
+			void NoiseImpl(const NoiseSettings& settings, uint32_t dimensions, const float* const* coordinates, float* output, size_t count)
+			{
+				switch (dimensions)
+				{
+				case 2: NoiseDetail::EvaluatePoints<NoiseLanes, 2>(settings, coordinates, output, count); break;
+				case 3: NoiseDetail::EvaluatePoints<NoiseLanes, 3>(settings, coordinates, output, count); break;
+				default: NoiseDetail::EvaluatePoints<NoiseLanes, 4>(settings, coordinates, output, count); break;
+				}
+			}
+		}
+
+		namespace
+		{
+			// 8 wide lane type for the shared bounding volume templates
+			struct BoundsLanes
+			{
+				using Float = __m256;
+				using Int = __m256i;
+				using Mask = __m256;
+
+				inline static constexpr size_t WIDTH = 8;
+
+				static Float Set(float value) { return _mm256_set1_ps(value); }
+				static Int SetInt(int32_t value) { return _mm256_set1_epi32(value); }
+				static Int LaneIndices() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+				static Float Load(const float* source) { return _mm256_loadu_ps(source); }
+				static void Store(float* destination, Float value) { _mm256_storeu_ps(destination, value); }
+				static void StoreInt(int32_t* destination, Int value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value); }
+
+				static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+				static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+				static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+				static Float MulAdd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+				static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+				static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+
+				static Mask Greater(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+				static Float Select(Mask mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+				static Int IntAdd(Int a, Int b) { return _mm256_add_epi32(a, b); }
+				static Int IntSelect(Mask mask, Int a, Int b) { return _mm256_blendv_epi8(b, a, _mm256_castps_si256(mask)); }
+
+				// Points i and i + 4 share a register (one per 128 bit half) , then the usual 4x4 transpose runs in both halves at once
+				static void LoadPoints(const uint8_t* source, size_t stride, Float& x, Float& y, Float& z)
+				{
+					auto pair = [source, stride](size_t first)
+					{
+						const __m128 low = _mm_loadu_ps(reinterpret_cast<const float*>(source + first * stride));
+						const __m128 high = _mm_loadu_ps(reinterpret_cast<const float*>(source + (first + 4) * stride));
+						return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+					};
+
+					const __m256 first = pair(0), second = pair(1), third = pair(2), fourth = pair(3);
+
+					const __m256 xy01 = _mm256_unpacklo_ps(first, second);
+					const __m256 zw01 = _mm256_unpackhi_ps(first, second);
+					const __m256 xy23 = _mm256_unpacklo_ps(third, fourth);
+					const __m256 zw23 = _mm256_unpackhi_ps(third, fourth);
+
+					x = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+					y = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+					z = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+				}
+			};
+
+			void BoundsFarthestImpl(const void* points, size_t count, size_t stride, const float* center, float* outDistanceSquared, size_t* outIndex)
+			{
+				BoundsDetail::Farthest<BoundsLanes>(static_cast<const uint8_t*>(points), count, stride, center, outDistanceSquared, outIndex);
+			}
+
+			void BoundsMomentsImpl(const void* points, size_t count, size_t stride, const float* origin, double* outMoments)
+			{
+				BoundsDetail::Moments<BoundsLanes>(static_cast<const uint8_t*>(points), count, stride, origin, outMoments);
+			}
+
+			void BoundsProjectImpl(const void* points, size_t count, size_t stride, const float* axes, float* outMinimum, float* outMaximum)
+			{
+				BoundsDetail::Project<BoundsLanes>(static_cast<const uint8_t*>(points), count, stride, axes, outMinimum, outMaximum);
+			}
+		}
+
+		namespace
+		{
+			// 8 wide lane type for the shared transform interpolation template
+			struct TransformLanes
+			{
+				using Float = __m256;
+
+				inline static constexpr size_t WIDTH = 8;
+
+				static Float Set(float value) { return _mm256_set1_ps(value); }
+				static Float Load(const float* source) { return _mm256_loadu_ps(source); }
+
+				static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+				static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+				static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+				static Float MulAdd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+				static Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+				static Float SignBit(Float a) { return _mm256_and_ps(a, _mm256_set1_ps(-0.0f)); }
+				static Float Xor(Float a, Float b) { return _mm256_xor_ps(a, b); }
+
+				// Same transpose as the 4 wide tier , run in both 128 bit halves at once : the low halves hold matrices 0 - 3 , the high halves 4 - 7
+				static void StoreMatrices(float* output, const Float (&elements)[16])
+				{
+					for (int row = 0; row < 4; ++row)
+					{
+						const __m256 xy01 = _mm256_unpacklo_ps(elements[row * 4], elements[row * 4 + 1]);
+						const __m256 zw01 = _mm256_unpackhi_ps(elements[row * 4], elements[row * 4 + 1]);
+						const __m256 xy23 = _mm256_unpacklo_ps(elements[row * 4 + 2], elements[row * 4 + 3]);
+						const __m256 zw23 = _mm256_unpackhi_ps(elements[row * 4 + 2], elements[row * 4 + 3]);
+
+						const __m256 rows[4] =
+						{
+							_mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0)),
+							_mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2)),
+							_mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0)),
+							_mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2))
+						};
+
+						for (int matrix = 0; matrix < 4; ++matrix)
+						{
+							_mm_storeu_ps(output + matrix * 16 + row * 4, _mm256_castps256_ps128(rows[matrix]));
+							_mm_storeu_ps(output + (matrix + 4) * 16 + row * 4, _mm256_extractf128_ps(rows[matrix], 1));
+						}
+					}
+				}
+			};
+
+			void InterpolateTransformsImpl(const TransformSoA& previous, const TransformSoA& current, float alpha, float* outMatrices, size_t count)
+			{
+				const float* const previousStreams[TransformDetail::STREAMCOUNT] = { previous.position[0], previous.position[1], previous.position[2],
+					previous.rotation[0], previous.rotation[1], previous.rotation[2], previous.rotation[3], previous.scale[0], previous.scale[1], previous.scale[2] };
+				const float* const currentStreams[TransformDetail::STREAMCOUNT] = { current.position[0], current.position[1], current.position[2],
+					current.rotation[0], current.rotation[1], current.rotation[2], current.rotation[3], current.scale[0], current.scale[1], current.scale[2] };
+
+				TransformDetail::Interpolate<TransformLanes>(previousStreams, currentStreams, alpha, outMatrices, count);
+			}
+		}
+
+		namespace Kernels
+		{
+			const MathKernelTable& GetAVX2Kernels()
+			{
+				static const MathKernelTable table = []()
+				{
+					MathKernelTable kernels;
+					kernels.SinCos = [](const float* angles, float* outSines, float* outCosines, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: SinCosArrayImpl<TrigPrecision::Fast>(angles, outSines, outCosines, count); break;
+						case TrigPrecision::Medium: SinCosArrayImpl<TrigPrecision::Medium>(angles, outSines, outCosines, count); break;
+						default: SinCosArrayImpl<TrigPrecision::Full>(angles, outSines, outCosines, count); break;
+						}
+					};
+					kernels.Tan = [](const float* angles, float* results, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: TanArrayImpl<TrigPrecision::Fast>(angles, results, count); break;
+						case TrigPrecision::Medium: TanArrayImpl<TrigPrecision::Medium>(angles, results, count); break;
+						default: TanArrayImpl<TrigPrecision::Full>(angles, results, count); break;
+						}
+					};
+					kernels.ATan2 = [](const float* y, const float* x, float* results, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: ATan2ArrayImpl<TrigPrecision::Fast>(y, x, results, count); break;
+						case TrigPrecision::Medium: ATan2ArrayImpl<TrigPrecision::Medium>(y, x, results, count); break;
+						default: ATan2ArrayImpl<TrigPrecision::Full>(y, x, results, count); break;
+						}
+					};
+					kernels.NLerp = BlendArrayImpl<QuaternionBlend::NLerp>;
+					kernels.Slerp = BlendArrayImpl<QuaternionBlend::Slerp>;
+					kernels.SlerpApprox = BlendArrayImpl<QuaternionBlend::SlerpApprox>;
+					kernels.InterpolateTransforms = InterpolateTransformsImpl;
+					kernels.PackFloats = [](const float* source, void* destination, size_t count, PackedFormat format)
+					{
+						switch (format)
+						{
+						case PackedFormat::Half: PackArrayImpl<PackedFormat::Half>(source, destination, count); break;
+						case PackedFormat::SNorm8: PackArrayImpl<PackedFormat::SNorm8>(source, destination, count); break;
+						case PackedFormat::SNorm16: PackArrayImpl<PackedFormat::SNorm16>(source, destination, count); break;
+						case PackedFormat::UNorm8: PackArrayImpl<PackedFormat::UNorm8>(source, destination, count); break;
+						default: PackArrayImpl<PackedFormat::UNorm16>(source, destination, count); break;
+						}
+					};
+					kernels.UnpackFloats = [](const void* source, float* destination, size_t count, PackedFormat format)
+					{
+						switch (format)
+						{
+						case PackedFormat::Half: UnpackArrayImpl<PackedFormat::Half>(source, destination, count); break;
+						case PackedFormat::SNorm8: UnpackArrayImpl<PackedFormat::SNorm8>(source, destination, count); break;
+						case PackedFormat::SNorm16: UnpackArrayImpl<PackedFormat::SNorm16>(source, destination, count); break;
+						case PackedFormat::UNorm8: UnpackArrayImpl<PackedFormat::UNorm8>(source, destination, count); break;
+						default: UnpackArrayImpl<PackedFormat::UNorm16>(source, destination, count); break;
+						}
+					};
+					kernels.RandomUInt = RandomUIntImpl;
+					kernels.RandomFloat = RandomFloatImpl;
+					kernels.RandomGaussian = RandomGaussianImpl;
+					kernels.RandomOnSphere = RandomOnSphereImpl;
+					kernels.RandomInDisc = RandomInDiscImpl;
+					kernels.Noise = NoiseImpl;
+					kernels.BoundsFarthest = BoundsFarthestImpl;
+					kernels.BoundsMoments = BoundsMomentsImpl;
+					kernels.BoundsProject = BoundsProjectImpl;
+					return kernels;
+				}();
+
+				return table;
+			}
+		}
+
+#else
+
+		namespace Kernels
+		{
+			// Built without AVX2 code generation , the tier falls back to the SSE4.2 kernels
+			const MathKernelTable& GetAVX2Kernels()
+			{
+				static const MathKernelTable table;
+				return table;
+			}
+		}
+
+#endif // _XM_AVX2_INTRINSICS_
+	}
+}
@@ -0,0 +1,202 @@
+// This translation unit is compiled with /arch:AVX512 , it must only be reached through MathDispatch.
+// Everything here has internal linkage so the EVEX encoded code can never be picked up by the other tiers.
+#include "MathDispatch.hpp"
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+#if defined(__AVX512F__)
+
+		namespace
+		{
+			inline __mmask16 TailMask(size_t remaining)
+			{
+				return static_cast<__mmask16>((1u << remaining) - 1u);
+			}
+
+			template <size_t Count>
+			inline __m512 Horner(__m512 x, const float(&coefficients)[Count])
+			{
+				__m512 result = _mm512_set1_ps(coefficients[Count - 1]);
+				for (size_t index = Count - 1; index-- > 0;)
+				{
+					result = _mm512_fmadd_ps(result, x, _mm512_set1_ps(coefficients[index]));
+				}
+				return result;
+			}
+
+			inline __m512 FlipSign(__m512 value, __mmask16 mask)
+			{
+				const __m512i signBit = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+				return _mm512_castsi512_ps(_mm512_mask_xor_epi32(_mm512_castps_si512(value), mask, _mm512_castps_si512(value), signBit));
+			}
+
+			template <TrigPrecision Precision>
+			inline void SinCos16(__m512 angle, __m512& outSin, __m512& outCos)
+			{
+				using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+				const __m512 quadrant = _mm512_roundscale_ps(_mm512_mul_ps(angle, _mm512_set1_ps(TrigDetail::TWOOVERPI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+				__m512 reduced = _mm512_fnmadd_ps(quadrant, _mm512_set1_ps(TrigDetail::PIO2_1), angle);
+				reduced = _mm512_fnmadd_ps(quadrant, _mm512_set1_ps(TrigDetail::PIO2_2), reduced);
+				reduced = _mm512_fnmadd_ps(quadrant, _mm512_set1_ps(TrigDetail::PIO2_3), reduced);
+
+				const __m512 reducedSq = _mm512_mul_ps(reduced, reduced);
+				const __m512 sine = _mm512_mul_ps(reduced, Horner(reducedSq, Coefficients::SIN));
+				const __m512 cosine = Horner(reducedSq, Coefficients::COS);
+
+				const __m512i quadrantInt = _mm512_cvtps_epi32(quadrant);
+				const __mmask16 swapMask = _mm512_test_epi32_mask(quadrantInt, _mm512_set1_epi32(1));
+				const __mmask16 sinNegative = _mm512_test_epi32_mask(quadrantInt, _mm512_set1_epi32(2));
+				const __mmask16 cosNegative = static_cast<__mmask16>(sinNegative ^ swapMask);
+
+				outSin = FlipSign(_mm512_mask_blend_ps(swapMask, sine, cosine), sinNegative);
+				outCos = FlipSign(_mm512_mask_blend_ps(swapMask, cosine, sine), cosNegative);
+
+				const __m512 absAngle = _mm512_abs_ps(angle);
+				if (_mm512_cmp_ps_mask(absAngle, _mm512_set1_ps(TrigDetail::REDUCTIONLIMIT), _CMP_NLE_UQ) != 0)
+				{
+					alignas(64) float angles[16], sines[16], cosines[16];
+					_mm512_store_ps(angles, angle);
+					_mm512_store_ps(sines, outSin);
+					_mm512_store_ps(cosines, outCos);
+
+					TrigDetail::FixupLargeAngles(angles, sines, cosines, 16);
+
+					outSin = _mm512_load_ps(sines);
+					outCos = _mm512_load_ps(cosines);
+				}
+			}
+
+			template <TrigPrecision Precision>
+			inline __m512 ATan2x16(__m512 y, __m512 x)
+			{
+				using Coefficients = TrigDetail::TrigCoefficients<Precision>;
+
+				const __m512 zero = _mm512_setzero_ps();
+				const __m512 absX = _mm512_abs_ps(x);
+				const __m512 absY = _mm512_abs_ps(y);
+				const __m512 maxValue = _mm512_max_ps(absX, absY);
+				const __m512 minValue = _mm512_min_ps(absX, absY);
+
+				__m512 ratio = _mm512_maskz_div_ps(_mm512_cmp_ps_mask(maxValue, zero, _CMP_GT_OQ), minValue, maxValue);
+				__m512 offset = zero;
+
+				if constexpr (Coefficients::ATANREDUCE)
+				{
+					const __m512 one = _mm512_set1_ps(1.0f);
+					const __mmask16 reduceMask = _mm512_cmp_ps_mask(ratio, _mm512_set1_ps(TrigDetail::TANPIOVER8), _CMP_GT_OQ);
+
+					ratio = _mm512_mask_div_ps(ratio, reduceMask, _mm512_sub_ps(ratio, one), _mm512_add_ps(ratio, one));
+					offset = _mm512_maskz_mov_ps(reduceMask, _mm512_set1_ps(TrigDetail::QUARTERPI));
+				}
+
+				__m512 result = _mm512_fmadd_ps(ratio, Horner(_mm512_mul_ps(ratio, ratio), Coefficients::ATAN), offset);
+
+				result = _mm512_mask_sub_ps(result, _mm512_cmp_ps_mask(absY, absX, _CMP_GT_OQ), _mm512_set1_ps(HALFPI), result);
+				// Sign bits rather than compares , so -0 takes the negative branch like in std::atan2
+				const __m512i zeroInt = _mm512_setzero_si512();
+				result = _mm512_mask_sub_ps(result, _mm512_cmplt_epi32_mask(_mm512_castps_si512(x), zeroInt), _mm512_set1_ps(PI), result);
+
+				return FlipSign(result, _mm512_cmplt_epi32_mask(_mm512_castps_si512(y), zeroInt));
+			}
+
+			template <TrigPrecision Precision>
+			void SinCosArrayImpl(const float* angles, float* outSines, float* outCosines, size_t count)
+			{
+				for (size_t index = 0; index < count; index += 16)
+				{
+					const __mmask16 mask = count - index >= 16 ? static_cast<__mmask16>(0xFFFF) : TailMask(count - index);
+
+					__m512 sine, cosine;
+					SinCos16<Precision>(_mm512_maskz_loadu_ps(mask, angles + index), sine, cosine);
+
+					if (outSines) { _mm512_mask_storeu_ps(outSines + index, mask, sine); }
+					if (outCosines) { _mm512_mask_storeu_ps(outCosines + index, mask, cosine); }
+				}
+			}
+
+			template <TrigPrecision Precision>
+			void TanArrayImpl(const float* angles, float* results, size_t count)
+			{
+				for (size_t index = 0; index < count; index += 16)
+				{
+					const __mmask16 mask = count - index >= 16 ? static_cast<__mmask16>(0xFFFF) : TailMask(count - index);
+
+					__m512 sine, cosine;
+					SinCos16<Precision>(_mm512_maskz_loadu_ps(mask, angles + index), sine, cosine);
+					_mm512_mask_storeu_ps(results + index, mask, _mm512_div_ps(sine, cosine));
+				}
+			}
+
+			template <TrigPrecision Precision>
+			void ATan2ArrayImpl(const float* y, const float* x, float* results, size_t count)
+			{
+				for (size_t index = 0; index < count; index += 16)
+				{
+					const __mmask16 mask = count - index >= 16 ? static_cast<__mmask16>(0xFFFF) : TailMask(count - index);
+
+					const __m512 result = ATan2x16<Precision>(_mm512_maskz_loadu_ps(mask, y + index), _mm512_maskz_loadu_ps(mask, x + index));
+					_mm512_mask_storeu_ps(results + index, mask, result);
+				}
+			}
+		}
+
+		namespace Kernels
+		{
+			const MathKernelTable& GetAVX512Kernels()
+			{
+				static const MathKernelTable table = []()
+				{
+					MathKernelTable kernels;
+					kernels.SinCos = [](const float* angles, float* outSines, float* outCosines, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: SinCosArrayImpl<TrigPrecision::Fast>(angles, outSines, outCosines, count); break;
+						case TrigPrecision::Medium: SinCosArrayImpl<TrigPrecision::Medium>(angles, outSines, outCosines, count); break;
+						default: SinCosArrayImpl<TrigPrecision::Full>(angles, outSines, outCosines, count); break;
+						}
+					};
+					kernels.Tan = [](const float* angles, float* results, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: TanArrayImpl<TrigPrecision::Fast>(angles, results, count); break;
+						case TrigPrecision::Medium: TanArrayImpl<TrigPrecision::Medium>(angles, results, count); break;
+						default: TanArrayImpl<TrigPrecision::Full>(angles, results, count); break;
+						}
+					};
+					kernels.ATan2 = [](const float* y, const float* x, float* results, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: ATan2ArrayImpl<TrigPrecision::Fast>(y, x, results, count); break;
+						case TrigPrecision::Medium: ATan2ArrayImpl<TrigPrecision::Medium>(y, x, results, count); break;
+						default: ATan2ArrayImpl<TrigPrecision::Full>(y, x, results, count); break;
+						}
+					};
+					return kernels;
+				}();
+
+				return table;
+			}
+		}
+
+#else
+
+		namespace Kernels
+		{
+			// Built without AVX-512 code generation , the tier falls back to the AVX2 kernels
+			const MathKernelTable& GetAVX512Kernels()
+			{
+				static const MathKernelTable table;
+				return table;
+			}
+		}
+
+#endif // __AVX512F__
+	}
+}
@@ -0,0 +1,906 @@
+#include "MathDispatch.hpp"
+#include "NoiseDetail.hpp"
+#include "BoundsDetail.hpp"
+#include "TransformDetail.hpp"
+#include <cstring>
+#include <smmintrin.h>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace
+		{
+			template <TrigPrecision Precision>
+			void SinCosArrayImpl(const float* angles, float* outSines, float* outCosines, size_t count)
+			{
+				size_t index = 0;
+
+				for (; index + 4 <= count; index += 4)
+				{
+					XMVECTOR sine, cosine;
+					FastSinCos<Precision>(XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(angles + index)), &sine, &cosine);
+
+					if (outSines) { XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(outSines + index), sine); }
+					if (outCosines) { XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(outCosines + index), cosine); }
+				}
+
+				for (; index < count; ++index)
+				{
+					float sine, cosine;
+					FastSinCos<Precision>(angles[index], sine, cosine);
+
+					if (outSines) { outSines[index] = sine; }
+					if (outCosines) { outCosines[index] = cosine; }
+				}
+			}
+
+			template <TrigPrecision Precision>
+			void TanArrayImpl(const float* angles, float* results, size_t count)
+			{
+				size_t index = 0;
+
+				for (; index + 4 <= count; index += 4)
+				{
+					const XMVECTOR tangent = FastTan<Precision>(XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(angles + index)));
+					XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(results + index), tangent);
+				}
+
+				for (; index < count; ++index)
+				{
+					results[index] = FastTan<Precision>(angles[index]);
+				}
+			}
+
+			template <TrigPrecision Precision>
+			void ATan2ArrayImpl(const float* y, const float* x, float* results, size_t count)
+			{
+				size_t index = 0;
+
+				for (; index + 4 <= count; index += 4)
+				{
+					const XMVECTOR yValues = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(y + index));
+					const XMVECTOR xValues = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(x + index));
+					XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(results + index), FastATan2<Precision>(yValues, xValues));
+				}
+
+				for (; index < count; ++index)
+				{
+					results[index] = FastATan2<Precision>(y[index], x[index]);
+				}
+			}
+		}
+
+		namespace
+		{
+			enum class QuaternionBlend : uint8_t
+			{
+				NLerp,
+				Slerp,
+				SlerpApprox
+			};
+
+			inline XMVECTOR XM_CALLCONV LoadLanes(const float* stream, size_t index, size_t lanes, float padding)
+			{
+				if (lanes == 4) { return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(stream + index)); }
+
+				XMFLOAT4A values{ padding, padding, padding, padding };
+				for (size_t lane = 0; lane < lanes; ++lane) { (&values.x)[lane] = stream[index + lane]; }
+				return XMLoadFloat4A(&values);
+			}
+
+			inline void XM_CALLCONV StoreLanes(float* stream, size_t index, size_t lanes, FXMVECTOR value)
+			{
+				if (lanes == 4) { XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(stream + index), value); return; }
+
+				XMFLOAT4A values;
+				XMStoreFloat4A(&values, value);
+				for (size_t lane = 0; lane < lanes; ++lane) { stream[index + lane] = (&values.x)[lane]; }
+			}
+
+			/// <summary>
+			/// Blends 4 quaternions held as SoA registers (component major : x , y , z , w)
+			/// </summary>
+			template <QuaternionBlend Blend>
+			inline void BlendLanes(const XMVECTOR from[4], XMVECTOR to[4], FXMVECTOR weight, XMVECTOR result[4])
+			{
+				const XMVECTOR one = XMVectorSplatOne();
+
+				XMVECTOR dot = XMVectorMultiply(from[0], to[0]);
+				dot = XMVectorMultiplyAdd(from[1], to[1], dot);
+				dot = XMVectorMultiplyAdd(from[2], to[2], dot);
+				dot = XMVectorMultiplyAdd(from[3], to[3], dot);
+
+				// Shortest path : flip 'to' wherever the pair lies in opposite hemispheres
+				const XMVECTOR sign = XMVectorAndInt(dot, g_XMNegativeZero);
+				for (int component = 0; component < 4; ++component) { to[component] = XMVectorXorInt(to[component], sign); }
+
+				const XMVECTOR cosTheta = XMVectorAbs(dot);
+				XMVECTOR weightFrom;
+				XMVECTOR weightTo;
+
+				if constexpr (Blend == QuaternionBlend::Slerp)
+				{
+					const XMVECTOR sinTheta = XMVectorSqrt(XMVectorMax(XMVectorZero(), XMVectorNegativeMultiplySubtract(cosTheta, cosTheta, one)));
+					const XMVECTOR theta = FastATan2<TrigPrecision::Full>(sinTheta, cosTheta);
+					const XMVECTOR inverseSin = XMVectorReciprocal(sinTheta);
+
+					const XMVECTOR sinFrom = FastSin<TrigPrecision::Full>(XMVectorMultiply(XMVectorSubtract(one, weight), theta));
+					const XMVECTOR sinTo = FastSin<TrigPrecision::Full>(XMVectorMultiply(weight, theta));
+
+					// Nearly identical rotations fall back to a plain lerp (same threshold as XMQuaternionSlerp)
+					const XMVECTOR linear = XMVectorGreater(cosTheta, XMVectorReplicate(1.0f - 0.00001f));
+
+					weightFrom = XMVectorSelect(XMVectorMultiply(sinFrom, inverseSin), XMVectorSubtract(one, weight), linear);
+					weightTo = XMVectorSelect(XMVectorMultiply(sinTo, inverseSin), weight, linear);
+				}
+				else
+				{
+					XMVECTOR delta = weight;
+
+					if constexpr (Blend == QuaternionBlend::SlerpApprox)
+					{
+						// Cubic correction of the NLerp weight (A. Kapoulkine , "Approximating slerp")
+						const XMVECTOR half = XMVectorReplicate(0.5f);
+						const XMVECTOR centered = XMVectorSubtract(delta, half);
+
+						XMVECTOR factorA = XMVectorMultiplyAdd(cosTheta, XMVectorReplicate(-1.43519f), XMVectorReplicate(3.55645f));
+						factorA = XMVectorMultiplyAdd(cosTheta, factorA, XMVectorReplicate(-3.2452f));
+						factorA = XMVectorMultiplyAdd(cosTheta, factorA, XMVectorReplicate(1.0904f));
+
+						XMVECTOR factorB = XMVectorMultiplyAdd(cosTheta, XMVectorReplicate(0.215638f), XMVectorReplicate(-1.06021f));
+						factorB = XMVectorMultiplyAdd(cosTheta, factorB, XMVectorReplicate(0.848013f));
+
+						const XMVECTOR correction = XMVectorMultiplyAdd(XMVectorMultiply(factorA, centered), centered, factorB);
+						const XMVECTOR cubic = XMVectorMultiply(XMVectorMultiply(delta, centered), XMVectorSubtract(delta, one));
+
+						delta = XMVectorMultiplyAdd(cubic, correction, delta);
+					}
+
+					weightFrom = XMVectorSubtract(one, delta);
+					weightTo = delta;
+				}
+
+				for (int component = 0; component < 4; ++component)
+				{
+					result[component] = XMVectorMultiplyAdd(from[component], weightFrom, XMVectorMultiply(to[component], weightTo));
+				}
+
+				if constexpr (Blend != QuaternionBlend::Slerp)
+				{
+					XMVECTOR lengthSq = XMVectorMultiply(result[0], result[0]);
+					lengthSq = XMVectorMultiplyAdd(result[1], result[1], lengthSq);
+					lengthSq = XMVectorMultiplyAdd(result[2], result[2], lengthSq);
+					lengthSq = XMVectorMultiplyAdd(result[3], result[3], lengthSq);
+
+					const XMVECTOR inverseLength = XMVectorReciprocalSqrt(lengthSq);
+					for (int component = 0; component < 4; ++component) { result[component] = XMVectorMultiply(result[component], inverseLength); }
+				}
+			}
+
+			template <QuaternionBlend Blend>
+			void BlendArrayImpl(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float uniformWeight, const QuaternionSoA& result, size_t count)
+			{
+				const float* fromStreams[4] = { from.x, from.y, from.z, from.w };
+				const float* toStreams[4] = { to.x, to.y, to.z, to.w };
+				float* resultStreams[4] = { result.x, result.y, result.z, result.w };
+
+				for (size_t index = 0; index < count; index += 4)
+				{
+					const size_t lanes = count - index < 4 ? count - index : 4;
+
+					// Unused tail lanes blend identity with identity so they can't produce NaNs
+					XMVECTOR fromLanes[4], toLanes[4], resultLanes[4];
+					for (int component = 0; component < 4; ++component)
+					{
+						const float padding = component == 3 ? 1.0f : 0.0f;
+						fromLanes[component] = LoadLanes(fromStreams[component], index, lanes, padding);
+						toLanes[component] = LoadLanes(toStreams[component], index, lanes, padding);
+					}
+
+					const XMVECTOR weight = weights != nullptr ? LoadLanes(weights, index, lanes, 0.0f) : XMVectorReplicate(uniformWeight);
+
+					BlendLanes<Blend>(fromLanes, toLanes, weight, resultLanes);
+
+					for (int component = 0; component < 4; ++component)
+					{
+						StoreLanes(resultStreams[component], index, lanes, resultLanes[component]);
+					}
+				}
+			}
+		}
+
+		namespace
+		{
+			// Floats converted per iteration
+			inline static constexpr size_t PACKBLOCKSIZE = 8;
+
+			struct NormRange
+			{
+				float minimum;
+				float scale;
+			};
+
+			constexpr NormRange GetNormRange(PackedFormat format)
+			{
+				switch (format)
+				{
+				case PackedFormat::SNorm8: return NormRange{ -1.0f, 127.0f };
+				case PackedFormat::SNorm16: return NormRange{ -1.0f, 32767.0f };
+				case PackedFormat::UNorm8: return NormRange{ 0.0f, 255.0f };
+				default: return NormRange{ 0.0f, 65535.0f };
+				}
+			}
+
+			template <PackedFormat Format>
+			inline __m128i XM_CALLCONV QuantizeLanes(__m128 values)
+			{
+				constexpr NormRange range = GetNormRange(Format);
+
+				// max first so NaNs end up at the bottom of the range
+				const __m128 clamped = _mm_min_ps(_mm_max_ps(values, _mm_set1_ps(range.minimum)), _mm_set1_ps(1.0f));
+				return _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(range.scale)));
+			}
+
+			template <PackedFormat Format>
+			inline __m128 XM_CALLCONV DequantizeLanes(__m128i values)
+			{
+				constexpr NormRange range = GetNormRange(Format);
+				return _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(values), _mm_set1_ps(1.0f / range.scale)), _mm_set1_ps(range.minimum));
+			}
+
+			template <PackedFormat Format>
+			inline void PackBlock(const float* source, uint8_t* destination)
+			{
+				const __m128i low = QuantizeLanes<Format>(_mm_loadu_ps(source));
+				const __m128i high = QuantizeLanes<Format>(_mm_loadu_ps(source + 4));
+
+				if constexpr (Format == PackedFormat::SNorm16)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_packs_epi32(low, high));
+				}
+				else if constexpr (Format == PackedFormat::UNorm16)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_packus_epi32(low, high));
+				}
+				else if constexpr (Format == PackedFormat::SNorm8)
+				{
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm_packs_epi16(_mm_packs_epi32(low, high), _mm_setzero_si128()));
+				}
+				else
+				{
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm_packus_epi16(_mm_packs_epi32(low, high), _mm_setzero_si128()));
+				}
+			}
+
+			template <PackedFormat Format>
+			inline void UnpackBlock(const uint8_t* source, float* destination)
+			{
+				__m128i low;
+				__m128i high;
+
+				if constexpr (Format == PackedFormat::SNorm16 || Format == PackedFormat::UNorm16)
+				{
+					const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+					low = Format == PackedFormat::SNorm16 ? _mm_cvtepi16_epi32(words) : _mm_cvtepu16_epi32(words);
+					high = Format == PackedFormat::SNorm16 ? _mm_cvtepi16_epi32(_mm_srli_si128(words, 8)) : _mm_cvtepu16_epi32(_mm_srli_si128(words, 8));
+				}
+				else
+				{
+					const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));
+					low = Format == PackedFormat::SNorm8 ? _mm_cvtepi8_epi32(bytes) : _mm_cvtepu8_epi32(bytes);
+					high = Format == PackedFormat::SNorm8 ? _mm_cvtepi8_epi32(_mm_srli_si128(bytes, 4)) : _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4));
+				}
+
+				_mm_storeu_ps(destination, DequantizeLanes<Format>(low));
+				_mm_storeu_ps(destination + 4, DequantizeLanes<Format>(high));
+			}
+
+			template <PackedFormat Format>
+			void PackArrayImpl(const float* source, void* destination, size_t count)
+			{
+				// No F16C on the baseline , DirectXPackedVector's stream converter rounds the same way
+				if constexpr (Format == PackedFormat::Half)
+				{
+					XMConvertFloatToHalfStream(static_cast<HALF*>(destination), sizeof(HALF), source, sizeof(float), count);
+				}
+				else
+				{
+					constexpr size_t elementSize = GetPackedSize(Format);
+					uint8_t* const bytes = static_cast<uint8_t*>(destination);
+					size_t index = 0;
+
+					for (; index + PACKBLOCKSIZE <= count; index += PACKBLOCKSIZE)
+					{
+						PackBlock<Format>(source + index, bytes + index * elementSize);
+					}
+
+					// Tail goes through padded stack copies so the block code never reads or writes out of bounds
+					if (index < count)
+					{
+						float staged[PACKBLOCKSIZE] = {};
+						uint8_t packed[PACKBLOCKSIZE * 2];
+
+						memcpy(staged, source + index, (count - index) * sizeof(float));
+						PackBlock<Format>(staged, packed);
+						memcpy(bytes + index * elementSize, packed, (count - index) * elementSize);
+					}
+				}
+			}
+
+			template <PackedFormat Format>
+			void UnpackArrayImpl(const void* source, float* destination, size_t count)
+			{
+				if constexpr (Format == PackedFormat::Half)
+				{
+					XMConvertHalfToFloatStream(destination, sizeof(float), static_cast<const HALF*>(source), sizeof(HALF), count);
+				}
+				else
+				{
+					constexpr size_t elementSize = GetPackedSize(Format);
+					const uint8_t* const bytes = static_cast<const uint8_t*>(source);
+					size_t index = 0;
+
+					for (; index + PACKBLOCKSIZE <= count; index += PACKBLOCKSIZE)
+					{
+						UnpackBlock<Format>(bytes + index * elementSize, destination + index);
+					}
+
+					if (index < count)
+					{
+						uint8_t staged[PACKBLOCKSIZE * 2] = {};
+						float unpacked[PACKBLOCKSIZE];
+
+						memcpy(staged, bytes + index * elementSize, (count - index) * elementSize);
+						UnpackBlock<Format>(staged, unpacked);
+						memcpy(destination + index, unpacked, (count - index) * sizeof(float));
+					}
+				}
+			}
+		}
+
+		namespace
+		{
+			// Lanes 0 - 3 or 4 - 7 of a RandomLanes state
+			struct RandomHalf
+			{
+				__m128i s0, s1, s2, s3;
+			};
+
+			template <int Shift>
+			inline __m128i RotateLeft(__m128i value)
+			{
+				return _mm_or_si128(_mm_slli_epi32(value, Shift), _mm_srli_epi32(value, 32 - Shift));
+			}
+
+			// xoshiro128** on 4 lanes , the multiplies by 5 and 9 are shift + add
+			inline __m128i NextBits(RandomHalf& half)
+			{
+				const __m128i timesFive = _mm_add_epi32(_mm_slli_epi32(half.s1, 2), half.s1);
+				const __m128i rotated = RotateLeft<7>(timesFive);
+				const __m128i result = _mm_add_epi32(_mm_slli_epi32(rotated, 3), rotated);
+				const __m128i shifted = _mm_slli_epi32(half.s1, 9);
+
+				half.s2 = _mm_xor_si128(half.s2, half.s0);
+				half.s3 = _mm_xor_si128(half.s3, half.s1);
+				half.s1 = _mm_xor_si128(half.s1, half.s2);
+				half.s0 = _mm_xor_si128(half.s0, half.s3);
+				half.s2 = _mm_xor_si128(half.s2, shifted);
+				half.s3 = RotateLeft<11>(half.s3);
+
+				return result;
+			}
+
+			// Keeps the 8 lanes in registers for the length of a fill and writes them back at the end
+			class RandomState
+			{
+			public:
+
+				explicit RandomState(RandomLanes& lanes) : m_lanes(lanes)
+				{
+					for (int half = 0; half < 2; ++half)
+					{
+						m_halves[half].s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.state[0] + half * 4));
+						m_halves[half].s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.state[1] + half * 4));
+						m_halves[half].s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.state[2] + half * 4));
+						m_halves[half].s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes.state[3] + half * 4));
+					}
+				}
+
+				~RandomState()
+				{
+					for (int half = 0; half < 2; ++half)
+					{
+						_mm_store_si128(reinterpret_cast<__m128i*>(m_lanes.state[0] + half * 4), m_halves[half].s0);
+						_mm_store_si128(reinterpret_cast<__m128i*>(m_lanes.state[1] + half * 4), m_halves[half].s1);
+						_mm_store_si128(reinterpret_cast<__m128i*>(m_lanes.state[2] + half * 4), m_halves[half].s2);
+						_mm_store_si128(reinterpret_cast<__m128i*>(m_lanes.state[3] + half * 4), m_halves[half].s3);
+					}
+				}
+
+				// One step of all 8 lanes
+				inline void Next(__m128i& low, __m128i& high)
+				{
+					low = NextBits(m_halves[0]);
+					high = NextBits(m_halves[1]);
+				}
+
+				// One step as [0 , 1) floats
+				inline void NextUnit(XMVECTOR& low, XMVECTOR& high)
+				{
+					const XMVECTOR scale = XMVectorReplicate(RandomDetail::UNITSCALE);
+					low = XMVectorMultiply(_mm_cvtepi32_ps(_mm_srli_epi32(NextBits(m_halves[0]), 8)), scale);
+					high = XMVectorMultiply(_mm_cvtepi32_ps(_mm_srli_epi32(NextBits(m_halves[1]), 8)), scale);
+				}
+
+			private:
+
+				RandomLanes& m_lanes;
+				RandomHalf m_halves[2];
+			};
+
+			// Natural log for positive normal inputs
+			inline XMVECTOR XM_CALLCONV LogPositive(FXMVECTOR value)
+			{
+				const XMVECTOR one = XMVectorSplatOne();
+				const __m128i bits = _mm_castps_si128(value);
+
+				// value = mantissa * 2^exponent with mantissa in [0.5 , 1)
+				XMVECTOR exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+				const XMVECTOR mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+
+				// Re-center on 1 : below sqrt(1/2) the mantissa gets doubled
+				const XMVECTOR small = XMVectorLess(mantissa, XMVectorReplicate(RandomDetail::SQRTHALF));
+				exponent = XMVectorSubtract(exponent, XMVectorAndInt(small, one));
+
+				const XMVECTOR x = XMVectorSubtract(XMVectorAdd(mantissa, XMVectorAndInt(small, mantissa)), one);
+				const XMVECTOR xSquared = XMVectorMultiply(x, x);
+
+				XMVECTOR result = XMVectorMultiply(XMVectorMultiply(TrigDetail::Horner(x, RandomDetail::LOG), x), xSquared);
+				result = XMVectorMultiplyAdd(exponent, XMVectorReplicate(RandomDetail::LOGLOW), result);
+				result = XMVectorNegativeMultiplySubtract(XMVectorReplicate(0.5f), xSquared, result);
+				return XMVectorMultiplyAdd(exponent, XMVectorReplicate(RandomDetail::LOGHIGH), XMVectorAdd(x, result));
+			}
+
+			/// <summary>
+			/// Runs generator once per BlockSize outputs , the last partial block is generated into stack copies
+			/// </summary>
+			template <size_t BlockSize, size_t StreamCount, typename Element, typename Generator>
+			inline void FillBlocks(Element* const (&streams)[StreamCount], size_t count, const Generator& generator)
+			{
+				size_t index = 0;
+
+				for (; index + BlockSize <= count; index += BlockSize)
+				{
+					Element* outputs[StreamCount];
+					for (size_t stream = 0; stream < StreamCount; ++stream) { outputs[stream] = streams[stream] + index; }
+
+					generator(outputs);
+				}
+
+				if (index < count)
+				{
+					Element staged[StreamCount][BlockSize];
+					Element* outputs[StreamCount];
+					for (size_t stream = 0; stream < StreamCount; ++stream) { outputs[stream] = staged[stream]; }
+
+					generator(outputs);
+
+					for (size_t stream = 0; stream < StreamCount; ++stream)
+					{
+						memcpy(streams[stream] + index, staged[stream], (count - index) * sizeof(Element));
+					}
+				}
+			}
+
+			void RandomUIntImpl(RandomLanes& lanes, uint32_t* output, size_t count)
+			{
+				RandomState state(lanes);
+				uint32_t* const streams[1] = { output };
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](uint32_t* const* outputs)
+				{
+					__m128i low, high;
+					state.Next(low, high);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(outputs[0]), low);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(outputs[0] + 4), high);
+				});
+			}
+
+			void RandomFloatImpl(RandomLanes& lanes, float* output, size_t count, float minimum, float maximum)
+			{
+				RandomState state(lanes);
+				float* const streams[1] = { output };
+
+				const XMVECTOR offset = XMVectorReplicate(minimum);
+				const XMVECTOR span = XMVectorReplicate(maximum - minimum);
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](float* const* outputs)
+				{
+					XMVECTOR low, high;
+					state.NextUnit(low, high);
+
+					_mm_storeu_ps(outputs[0], XMVectorMultiplyAdd(low, span, offset));
+					_mm_storeu_ps(outputs[0] + 4, XMVectorMultiplyAdd(high, span, offset));
+				});
+			}
+
+			void RandomGaussianImpl(RandomLanes& lanes, float* output, size_t count, float mean, float deviation)
+			{
+				RandomState state(lanes);
+				float* const streams[1] = { output };
+
+				const XMVECTOR one = XMVectorSplatOne();
+				const XMVECTOR center = XMVectorReplicate(mean);
+				const XMVECTOR scale = XMVectorReplicate(-2.0f * deviation * deviation);
+				const XMVECTOR twoPi = XMVectorReplicate(RandomDetail::TWOPI);
+
+				// Box-Muller , every pair of steps gives 16 samples : the cosine half first , then the sine half
+				FillBlocks<RANDOMLANES * 2>(streams, count, [&](float* const* outputs)
+				{
+					XMVECTOR first[2], second[2];
+					state.NextUnit(first[0], first[1]);
+					state.NextUnit(second[0], second[1]);
+
+					for (int half = 0; half < 2; ++half)
+					{
+						// 1 - u keeps the log argument in (0 , 1]
+						const XMVECTOR radius = XMVectorSqrt(XMVectorMultiply(scale, LogPositive(XMVectorSubtract(one, first[half]))));
+
+						XMVECTOR sine, cosine;
+						FastSinCos<TrigPrecision::Full>(XMVectorMultiply(second[half], twoPi), &sine, &cosine);
+
+						_mm_storeu_ps(outputs[0] + half * 4, XMVectorMultiplyAdd(radius, cosine, center));
+						_mm_storeu_ps(outputs[0] + RANDOMLANES + half * 4, XMVectorMultiplyAdd(radius, sine, center));
+					}
+				});
+			}
+
+			void RandomOnSphereImpl(RandomLanes& lanes, float* x, float* y, float* z, size_t count, float radius)
+			{
+				RandomState state(lanes);
+				float* const streams[3] = { x, y, z };
+
+				const XMVECTOR one = XMVectorSplatOne();
+				const XMVECTOR scale = XMVectorReplicate(radius);
+				const XMVECTOR twoPi = XMVectorReplicate(RandomDetail::TWOPI);
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](float* const* outputs)
+				{
+					XMVECTOR first[2], second[2];
+					state.NextUnit(first[0], first[1]);
+					state.NextUnit(second[0], second[1]);
+
+					for (int half = 0; half < 2; ++half)
+					{
+						const XMVECTOR height = XMVectorNegativeMultiplySubtract(XMVectorReplicate(2.0f), first[half], one);
+						const XMVECTOR ring = XMVectorSqrt(XMVectorMax(XMVectorZero(), XMVectorNegativeMultiplySubtract(height, height, one)));
+
+						XMVECTOR sine, cosine;
+						FastSinCos<TrigPrecision::Full>(XMVectorMultiply(second[half], twoPi), &sine, &cosine);
+
+						_mm_storeu_ps(outputs[0] + half * 4, XMVectorMultiply(XMVectorMultiply(ring, cosine), scale));
+						_mm_storeu_ps(outputs[1] + half * 4, XMVectorMultiply(XMVectorMultiply(ring, sine), scale));
+						_mm_storeu_ps(outputs[2] + half * 4, XMVectorMultiply(height, scale));
+					}
+				});
+			}
+
+			void RandomInDiscImpl(RandomLanes& lanes, float* x, float* y, size_t count, float radius)
+			{
+				RandomState state(lanes);
+				float* const streams[2] = { x, y };
+
+				const XMVECTOR scale = XMVectorReplicate(radius);
+				const XMVECTOR twoPi = XMVectorReplicate(RandomDetail::TWOPI);
+
+				FillBlocks<RANDOMLANES>(streams, count, [&](float* const* outputs)
+				{
+					XMVECTOR first[2], second[2];
+					state.NextUnit(first[0], first[1]);
+					state.NextUnit(second[0], second[1]);
+
+					for (int half = 0; half < 2; ++half)
+					{
+						// sqrt keeps the density uniform over the area
+						const XMVECTOR distance = XMVectorMultiply(XMVectorSqrt(first[half]), scale);
+
+						XMVECTOR sine, cosine;
+						FastSinCos<TrigPrecision::Full>(XMVectorMultiply(second[half], twoPi), &sine, &cosine);
+
+						_mm_storeu_ps(outputs[0] + half * 4, XMVectorMultiply(distance, cosine));
+						_mm_storeu_ps(outputs[1] + half * 4, XMVectorMultiply(distance, sine));
+					}
+				});
+			}
+		}
+
+		namespace
+		{
+			// 4 wide lane type for the shared noise templates
+			struct NoiseLanes
+			{
+				using Float = __m128;
+				using Int = __m128i;
+				using Mask = __m128;
+
+				inline static constexpr size_t WIDTH = 4;
+
+				static Float Set(float value) { return _mm_set1_ps(value); }
+				static Int SetInt(int32_t value) { return _mm_set1_epi32(value); }
+				static Float Load(const float* source) { return _mm_loadu_ps(source); }
+				static void Store(float* destination, Float value) { _mm_storeu_ps(destination, value); }
+
+				static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+				static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+				static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+				static Float MulAdd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+				static Float Floor(Float value) { return _mm_floor_ps(value); }
+				static Float Abs(Float value) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), value); }
+				static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+
+				static Mask Greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+				static Float Select(Mask mask, Float a, Float b) { return _mm_blendv_ps(b, a, mask); }
+				static Mask MaskOr(Mask a, Mask b) { return _mm_or_ps(a, b); }
+
+				static Int ToInt(Float value) { return _mm_cvttps_epi32(value); }
+				static Float ToFloat(Int value) { return _mm_cvtepi32_ps(value); }
+
+				static Int IntAdd(Int a, Int b) { return _mm_add_epi32(a, b); }
+				static Int IntMul(Int a, Int b) { return _mm_mullo_epi32(a, b); }
+				static Int IntAnd(Int a, Int b) { return _mm_and_si128(a, b); }
+				static Int IntXor(Int a, Int b) { return _mm_xor_si128(a, b); }
+				template <int Shift> static Int IntShiftRight(Int value) { return _mm_srli_epi32(value, Shift); }
+				static Mask IntLess(Int a, Int b) { return _mm_castsi128_ps(_mm_cmplt_epi32(a, b)); }
+				static Mask IntEqual(Int a, Int b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b)); }
+				static Int IntSelect(Mask mask, Int a, Int b) { return _mm_blendv_epi8(b, a, _mm_castps_si128(mask)); }
+
+				// Moves hash bit Bit into the sign position and flips the value with it
+				template <int Bit> static Float FlipSign(Float value, Int hash)
+				{
+					const __m128i sign = _mm_and_si128(_mm_slli_epi32(hash, 31 - Bit), _mm_set1_epi32(static_cast<int32_t>(0x80000000u)));
+					return _mm_xor_ps(value, _mm_castsi128_ps(sign));
+				}
+			};
+
+			void NoiseImpl(const NoiseSettings& settings, uint32_t dimensions, const float* const* coordinates, float* output, size_t count)
+			{
+				switch (dimensions)
+				{
+				case 2: NoiseDetail::EvaluatePoints<NoiseLanes, 2>(settings, coordinates, output, count); break;
+				case 3: NoiseDetail::EvaluatePoints<NoiseLanes, 3>(settings, coordinates, output, count); break;
+				default: NoiseDetail::EvaluatePoints<NoiseLanes, 4>(settings, coordinates, output, count); break;
+				}
+			}
+		}
+
+		namespace
+		{
+			// 4 wide lane type for the shared bounding volume templates
+			struct BoundsLanes
+			{
+				using Float = __m128;
+				using Int = __m128i;
+				using Mask = __m128;
+
+				inline static constexpr size_t WIDTH = 4;
+
+				static Float Set(float value) { return _mm_set1_ps(value); }
+				static Int SetInt(int32_t value) { return _mm_set1_epi32(value); }
+				static Int LaneIndices() { return _mm_setr_epi32(0, 1, 2, 3); }
+				static Float Load(const float* source) { return _mm_loadu_ps(source); }
+				static void Store(float* destination, Float value) { _mm_storeu_ps(destination, value); }
+				static void StoreInt(int32_t* destination, Int value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value); }
+
+				static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+				static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+				static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+				static Float MulAdd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+				static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+				static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+
+				static Mask Greater(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+				static Float Select(Mask mask, Float a, Float b) { return _mm_blendv_ps(b, a, mask); }
+				static Int IntAdd(Int a, Int b) { return _mm_add_epi32(a, b); }
+				static Int IntSelect(Mask mask, Int a, Int b) { return _mm_blendv_epi8(b, a, _mm_castps_si128(mask)); }
+
+				// Four 16 byte loads , one per point , transposed so each register holds one axis
+				static void LoadPoints(const uint8_t* source, size_t stride, Float& x, Float& y, Float& z)
+				{
+					__m128 first = _mm_loadu_ps(reinterpret_cast<const float*>(source));
+					__m128 second = _mm_loadu_ps(reinterpret_cast<const float*>(source + stride));
+					__m128 third = _mm_loadu_ps(reinterpret_cast<const float*>(source + 2 * stride));
+					__m128 fourth = _mm_loadu_ps(reinterpret_cast<const float*>(source + 3 * stride));
+					_MM_TRANSPOSE4_PS(first, second, third, fourth);
+
+					x = first;
+					y = second;
+					z = third;
+				}
+			};
+
+			// Min / max is load bound , so it stays AoS : one 16 byte load and two ops per point , no transpose.
+			// Every tier uses this one
+			void BoundsMinMaxImpl(const void* points, size_t count, size_t stride, float* outMinimum, float* outMaximum)
+			{
+				const uint8_t* const bytes = static_cast<const uint8_t*>(points);
+
+				// The last point gets a 12 byte load , every other point can safely read 4 bytes into the one after it
+				const XMVECTOR last = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(bytes + (count - 1) * stride));
+				XMVECTOR minimum[2] = { last, last };
+				XMVECTOR maximum[2] = { last, last };
+
+				size_t index = 0;
+				for (; index + 2 < count; index += 2)
+				{
+					const XMVECTOR first = _mm_loadu_ps(reinterpret_cast<const float*>(bytes + index * stride));
+					const XMVECTOR second = _mm_loadu_ps(reinterpret_cast<const float*>(bytes + (index + 1) * stride));
+
+					minimum[0] = _mm_min_ps(minimum[0], first);
+					maximum[0] = _mm_max_ps(maximum[0], first);
+					minimum[1] = _mm_min_ps(minimum[1], second);
+					maximum[1] = _mm_max_ps(maximum[1], second);
+				}
+
+				if (index + 1 < count)
+				{
+					const XMVECTOR point = _mm_loadu_ps(reinterpret_cast<const float*>(bytes + index * stride));
+					minimum[0] = _mm_min_ps(minimum[0], point);
+					maximum[0] = _mm_max_ps(maximum[0], point);
+				}
+
+				XMFLOAT4 lowest, highest;
+				XMStoreFloat4(&lowest, _mm_min_ps(minimum[0], minimum[1]));
+				XMStoreFloat4(&highest, _mm_max_ps(maximum[0], maximum[1]));
+
+				outMinimum[0] = lowest.x;
+				outMinimum[1] = lowest.y;
+				outMinimum[2] = lowest.z;
+				outMaximum[0] = highest.x;
+				outMaximum[1] = highest.y;
+				outMaximum[2] = highest.z;
+			}
+
+			void BoundsFarthestImpl(const void* points, size_t count, size_t stride, const float* center, float* outDistanceSquared, size_t* outIndex)
+			{
+				BoundsDetail::Farthest<BoundsLanes>(static_cast<const uint8_t*>(points), count, stride, center, outDistanceSquared, outIndex);
+			}
+
+			void BoundsMomentsImpl(const void* points, size_t count, size_t stride, const float* origin, double* outMoments)
+			{
+				BoundsDetail::Moments<BoundsLanes>(static_cast<const uint8_t*>(points), count, stride, origin, outMoments);
+			}
+
+			void BoundsProjectImpl(const void* points, size_t count, size_t stride, const float* axes, float* outMinimum, float* outMaximum)
+			{
+				BoundsDetail::Project<BoundsLanes>(static_cast<const uint8_t*>(points), count, stride, axes, outMinimum, outMaximum);
+			}
+		}
+
+		namespace
+		{
+			// 4 wide lane type for the shared transform interpolation template
+			struct TransformLanes
+			{
+				using Float = __m128;
+
+				inline static constexpr size_t WIDTH = 4;
+
+				static Float Set(float value) { return _mm_set1_ps(value); }
+				static Float Load(const float* source) { return _mm_loadu_ps(source); }
+
+				static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+				static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+				static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+				static Float MulAdd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+				static Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+				static Float SignBit(Float a) { return _mm_and_ps(a, _mm_set1_ps(-0.0f)); }
+				static Float Xor(Float a, Float b) { return _mm_xor_ps(a, b); }
+
+				// Each group of four element registers is one matrix row for all four lanes , a 4x4 transpose turns it into that row of every matrix
+				static void StoreMatrices(float* output, const Float (&elements)[16])
+				{
+					for (int row = 0; row < 4; ++row)
+					{
+						__m128 first = elements[row * 4], second = elements[row * 4 + 1], third = elements[row * 4 + 2], fourth = elements[row * 4 + 3];
+						_MM_TRANSPOSE4_PS(first, second, third, fourth);
+
+						_mm_storeu_ps(output + row * 4, first);
+						_mm_storeu_ps(output + 16 + row * 4, second);
+						_mm_storeu_ps(output + 32 + row * 4, third);
+						_mm_storeu_ps(output + 48 + row * 4, fourth);
+					}
+				}
+			};
+
+			void InterpolateTransformsImpl(const TransformSoA& previous, const TransformSoA& current, float alpha, float* outMatrices, size_t count)
+			{
+				const float* const previousStreams[TransformDetail::STREAMCOUNT] = { previous.position[0], previous.position[1], previous.position[2],
+					previous.rotation[0], previous.rotation[1], previous.rotation[2], previous.rotation[3], previous.scale[0], previous.scale[1], previous.scale[2] };
+				const float* const currentStreams[TransformDetail::STREAMCOUNT] = { current.position[0], current.position[1], current.position[2],
+					current.rotation[0], current.rotation[1], current.rotation[2], current.rotation[3], current.scale[0], current.scale[1], current.scale[2] };
+
+				TransformDetail::Interpolate<TransformLanes>(previousStreams, currentStreams, alpha, outMatrices, count);
+			}
+		}
+
+		namespace Kernels
+		{
+			// Baseline tier : DirectXMath XMVECTOR path with a scalar tail
+			const MathKernelTable& GetSSE42Kernels()
+			{
+				static const MathKernelTable table = []()
+				{
+					MathKernelTable kernels;
+					kernels.SinCos = [](const float* angles, float* outSines, float* outCosines, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: SinCosArrayImpl<TrigPrecision::Fast>(angles, outSines, outCosines, count); break;
+						case TrigPrecision::Medium: SinCosArrayImpl<TrigPrecision::Medium>(angles, outSines, outCosines, count); break;
+						default: SinCosArrayImpl<TrigPrecision::Full>(angles, outSines, outCosines, count); break;
+						}
+					};
+					kernels.Tan = [](const float* angles, float* results, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: TanArrayImpl<TrigPrecision::Fast>(angles, results, count); break;
+						case TrigPrecision::Medium: TanArrayImpl<TrigPrecision::Medium>(angles, results, count); break;
+						default: TanArrayImpl<TrigPrecision::Full>(angles, results, count); break;
+						}
+					};
+					kernels.ATan2 = [](const float* y, const float* x, float* results, size_t count, TrigPrecision precision)
+					{
+						switch (precision)
+						{
+						case TrigPrecision::Fast: ATan2ArrayImpl<TrigPrecision::Fast>(y, x, results, count); break;
+						case TrigPrecision::Medium: ATan2ArrayImpl<TrigPrecision::Medium>(y, x, results, count); break;
+						default: ATan2ArrayImpl<TrigPrecision::Full>(y, x, results, count); break;
+						}
+					};
+					kernels.NLerp = BlendArrayImpl<QuaternionBlend::NLerp>;
+					kernels.Slerp = BlendArrayImpl<QuaternionBlend::Slerp>;
+					kernels.SlerpApprox = BlendArrayImpl<QuaternionBlend::SlerpApprox>;
+					kernels.InterpolateTransforms = InterpolateTransformsImpl;
+					kernels.PackFloats = [](const float* source, void* destination, size_t count, PackedFormat format)
+					{
+						switch (format)
+						{
+						case PackedFormat::Half: PackArrayImpl<PackedFormat::Half>(source, destination, count); break;
+						case PackedFormat::SNorm8: PackArrayImpl<PackedFormat::SNorm8>(source, destination, count); break;
+						case PackedFormat::SNorm16: PackArrayImpl<PackedFormat::SNorm16>(source, destination, count); break;
+						case PackedFormat::UNorm8: PackArrayImpl<PackedFormat::UNorm8>(source, destination, count); break;
+						default: PackArrayImpl<PackedFormat::UNorm16>(source, destination, count); break;
+						}
+					};
+					kernels.UnpackFloats = [](const void* source, float* destination, size_t count, PackedFormat format)
+					{
+						switch (format)
+						{
+						case PackedFormat::Half: UnpackArrayImpl<PackedFormat::Half>(source, destination, count); break;
+						case PackedFormat::SNorm8: UnpackArrayImpl<PackedFormat::SNorm8>(source, destination, count); break;
+						case PackedFormat::SNorm16: UnpackArrayImpl<PackedFormat::SNorm16>(source, destination, count); break;
+						case PackedFormat::UNorm8: UnpackArrayImpl<PackedFormat::UNorm8>(source, destination, count); break;
+						default: UnpackArrayImpl<PackedFormat::UNorm16>(source, destination, count); break;
+						}
+					};
+					kernels.RandomUInt = RandomUIntImpl;
+					kernels.RandomFloat = RandomFloatImpl;
+					kernels.RandomGaussian = RandomGaussianImpl;
+					kernels.RandomOnSphere = RandomOnSphereImpl;
+					kernels.RandomInDisc = RandomInDiscImpl;
+					kernels.Noise = NoiseImpl;
+					kernels.BoundsMinMax = BoundsMinMaxImpl;
+					kernels.BoundsFarthest = BoundsFarthestImpl;
+					kernels.BoundsMoments = BoundsMomentsImpl;
+					kernels.BoundsProject = BoundsProjectImpl;
+					return kernels;
+				}();
+
+				return table;
+			}
+		}
+	}
+}
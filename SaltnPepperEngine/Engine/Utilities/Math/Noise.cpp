@@ -0,0 +1,319 @@
+#include "Noise.hpp"
+#include "Utilities/Math/NoiseDetail.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace
+		{
+			// One lane , the reference the batch kernels are checked against
+			struct ScalarLanes
+			{
+				using Float = float;
+				using Int = uint32_t;
+				using Mask = bool;
+
+				inline static constexpr size_t WIDTH = 1;
+
+				static Float Set(float value) { return value; }
+				static Int SetInt(int32_t value) { return static_cast<uint32_t>(value); }
+				static Float Load(const float* source) { return *source; }
+				static void Store(float* destination, Float value) { *destination = value; }
+
+				static Float Add(Float a, Float b) { return a + b; }
+				static Float Sub(Float a, Float b) { return a - b; }
+				static Float Mul(Float a, Float b) { return a * b; }
+				static Float MulAdd(Float a, Float b, Float c) { return a * b + c; }
+				static Float Floor(Float value) { return std::floor(value); }
+				static Float Abs(Float value) { return std::fabs(value); }
+				static Float Max(Float a, Float b) { return a > b ? a : b; }
+
+				static Mask Greater(Float a, Float b) { return a > b; }
+				static Float Select(Mask mask, Float a, Float b) { return mask ? a : b; }
+				static Mask MaskOr(Mask a, Mask b) { return a || b; }
+
+				static Int ToInt(Float value) { return static_cast<uint32_t>(static_cast<int32_t>(value)); }
+				static Float ToFloat(Int value) { return static_cast<float>(static_cast<int32_t>(value)); }
+
+				// Unsigned so the lattice hash wraps like the SIMD lanes do
+				static Int IntAdd(Int a, Int b) { return a + b; }
+				static Int IntMul(Int a, Int b) { return a * b; }
+				static Int IntAnd(Int a, Int b) { return a & b; }
+				static Int IntXor(Int a, Int b) { return a ^ b; }
+				template <int Shift> static Int IntShiftRight(Int value) { return value >> Shift; }
+				static Mask IntLess(Int a, Int b) { return static_cast<int32_t>(a) < static_cast<int32_t>(b); }
+				static Mask IntEqual(Int a, Int b) { return a == b; }
+				static Int IntSelect(Mask mask, Int a, Int b) { return mask ? a : b; }
+
+				template <int Bit> static Float FlipSign(Float value, Int hash) { return ((hash >> Bit) & 1u) ? -value : value; }
+			};
+
+			void EvaluateBatch(const NoiseSettings& settings, uint32_t dimensions, const float* const* coordinates, float* output, size_t count)
+			{
+				const auto kernel = MathDispatch::GetKernels().Noise;
+
+				if (count < NOISE_PARALLELTHRESHOLD)
+				{
+					kernel(settings, dimensions, coordinates, output, count);
+					return;
+				}
+
+				Jobs::JobSystem::ParallelFor(count, NOISE_PARALLELGRAIN, [&](size_t begin, size_t end)
+				{
+					const float* slice[4] = {};
+					for (uint32_t axis = 0; axis < dimensions; ++axis) { slice[axis] = coordinates[axis] + begin; }
+
+					kernel(settings, dimensions, slice, output + begin, end - begin);
+				});
+			}
+
+			// Runs rowFunction(rowBegin , rowEnd) over the grid rows , split across the job system for large grids
+			template <typename Function>
+			void ForEachGridRow(size_t width, size_t rowCount, const Function& rowFunction)
+			{
+				if (width * rowCount < NOISE_PARALLELTHRESHOLD)
+				{
+					rowFunction(size_t{ 0 }, rowCount);
+					return;
+				}
+
+				const size_t rowsPerSlice = std::max<size_t>(1, NOISE_PARALLELGRAIN / width);
+				Jobs::JobSystem::ParallelFor(rowCount, rowsPerSlice, rowFunction);
+			}
+
+			// Feeds one grid row through the point kernel , the fixed coordinates are already set in coordinates[1 ..]
+			void EvaluateGridRow(const NoiseSettings& settings, uint32_t dimensions, float* const* coordinates, float originX, float stepX, size_t width, float* output)
+			{
+				const auto kernel = MathDispatch::GetKernels().Noise;
+
+				for (size_t spanBegin = 0; spanBegin < width; spanBegin += NoiseDetail::GRIDSPANLENGTH)
+				{
+					const size_t spanLength = std::min(width - spanBegin, NoiseDetail::GRIDSPANLENGTH);
+
+					// origin + index * step rather than a running sum , so every split produces the same coordinates
+					for (size_t index = 0; index < spanLength; ++index) { coordinates[0][index] = originX + static_cast<float>(spanBegin + index) * stepX; }
+
+					kernel(settings, dimensions, coordinates, output + spanBegin, spanLength);
+				}
+			}
+		}
+
+
+		// ===================== SINGLE SAMPLES =========================
+
+		float SimplexNoise(float x, float y, int32_t seed)
+		{
+			return NoiseDetail::Simplex<ScalarLanes>(x, y, static_cast<uint32_t>(seed));
+		}
+
+		float SimplexNoise(float x, float y, float z, int32_t seed)
+		{
+			return NoiseDetail::Simplex<ScalarLanes>(x, y, z, static_cast<uint32_t>(seed));
+		}
+
+		float SimplexNoise(float x, float y, float z, float w, int32_t seed)
+		{
+			return NoiseDetail::Simplex<ScalarLanes>(x, y, z, w, static_cast<uint32_t>(seed));
+		}
+
+		float ValueNoise(float x, float y, int32_t seed)
+		{
+			return NoiseDetail::Value<ScalarLanes>(x, y, static_cast<uint32_t>(seed));
+		}
+
+		float ValueNoise(float x, float y, float z, int32_t seed)
+		{
+			return NoiseDetail::Value<ScalarLanes>(x, y, z, static_cast<uint32_t>(seed));
+		}
+
+		float ValueNoise(float x, float y, float z, float w, int32_t seed)
+		{
+			return NoiseDetail::Value<ScalarLanes>(x, y, z, w, static_cast<uint32_t>(seed));
+		}
+
+		float EvaluateNoise(const NoiseSettings& settings, float x, float y)
+		{
+			return NoiseDetail::Evaluate<ScalarLanes, 2>(settings, { x, y });
+		}
+
+		float EvaluateNoise(const NoiseSettings& settings, float x, float y, float z)
+		{
+			return NoiseDetail::Evaluate<ScalarLanes, 3>(settings, { x, y, z });
+		}
+
+		float EvaluateNoise(const NoiseSettings& settings, float x, float y, float z, float w)
+		{
+			return NoiseDetail::Evaluate<ScalarLanes, 4>(settings, { x, y, z, w });
+		}
+
+
+		// ===================== BATCHES =========================
+
+		void EvaluateNoise2D(const NoiseSettings& settings, const float* x, const float* y, float* output, size_t count)
+		{
+			const float* coordinates[2] = { x, y };
+			EvaluateBatch(settings, 2, coordinates, output, count);
+		}
+
+		void EvaluateNoise3D(const NoiseSettings& settings, const float* x, const float* y, const float* z, float* output, size_t count)
+		{
+			const float* coordinates[3] = { x, y, z };
+			EvaluateBatch(settings, 3, coordinates, output, count);
+		}
+
+		void EvaluateNoise4D(const NoiseSettings& settings, const float* x, const float* y, const float* z, const float* w, float* output, size_t count)
+		{
+			const float* coordinates[4] = { x, y, z, w };
+			EvaluateBatch(settings, 4, coordinates, output, count);
+		}
+
+		void EvaluateNoiseGrid2D(const NoiseSettings& settings, const Vector2& origin, const Vector2& step, uint32_t width, uint32_t height, float* output)
+		{
+			if (width == 0 || height == 0) { return; }
+
+			ForEachGridRow(width, height, [&](size_t rowBegin, size_t rowEnd)
+			{
+				float spanX[NoiseDetail::GRIDSPANLENGTH];
+				float spanY[NoiseDetail::GRIDSPANLENGTH];
+				float* coordinates[2] = { spanX, spanY };
+
+				for (size_t row = rowBegin; row < rowEnd; ++row)
+				{
+					std::fill(spanY, spanY + NoiseDetail::GRIDSPANLENGTH, origin.y + static_cast<float>(row) * step.y);
+					EvaluateGridRow(settings, 2, coordinates, origin.x, step.x, width, output + row * width);
+				}
+			});
+		}
+
+		void EvaluateNoiseGrid3D(const NoiseSettings& settings, const Vector3& origin, const Vector3& step, uint32_t width, uint32_t height, uint32_t depth, float* output)
+		{
+			if (width == 0 || height == 0 || depth == 0) { return; }
+
+			ForEachGridRow(width, static_cast<size_t>(height) * depth, [&](size_t rowBegin, size_t rowEnd)
+			{
+				float spanX[NoiseDetail::GRIDSPANLENGTH];
+				float spanY[NoiseDetail::GRIDSPANLENGTH];
+				float spanZ[NoiseDetail::GRIDSPANLENGTH];
+				float* coordinates[3] = { spanX, spanY, spanZ };
+
+				for (size_t row = rowBegin; row < rowEnd; ++row)
+				{
+					const size_t slice = row / height;
+					const size_t line = row - slice * height;
+
+					std::fill(spanY, spanY + NoiseDetail::GRIDSPANLENGTH, origin.y + static_cast<float>(line) * step.y);
+					std::fill(spanZ, spanZ + NoiseDetail::GRIDSPANLENGTH, origin.z + static_cast<float>(slice) * step.z);
+					EvaluateGridRow(settings, 3, coordinates, origin.x, step.x, width, output + row * width);
+				}
+			});
+		}
+
+
+		// ===================== VERIFICATION =========================
+
+		namespace
+		{
+			inline static constexpr uint32_t GOLDENPOINTS = 3;
+
+			// Shared sample points , 2D / 3D use the leading components
+			inline static constexpr float GOLDENPOSITIONS[4][GOLDENPOINTS] =
+			{
+				{ 0.37f, 12.5f, -103.2f },
+				{ -1.25f, 7.75f, 55.1f },
+				{ 2.6f, -0.4f, 31.7f },
+				{ 0.9f, 5.3f, -17.45f }
+			};
+
+			// Reference output of VerifyNoise's settings , [dimensions - 2][type][fractal][point]
+			inline static constexpr float GOLDENVALUES[3][2][3][GOLDENPOINTS] =
+			{
+				// 2D : simplex , value
+				{
+					{ { -0.0317855701f, 0.639440417f, 0.456721127f }, { -0.344306886f, 0.250958472f, 0.348132282f }, { 0.311386257f, -0.0979486555f, 0.303735495f } },
+					{ { -0.0190815032f, -0.482625663f, 0.320432335f }, { -0.062527284f, -0.45555529f, 0.20379892f }, { 0.874945462f, -0.0354206078f, 0.499847829f } }
+				},
+				// 3D : simplex , value
+				{
+					{ { 0.204200879f, 0.0802522823f, 0.14939177f }, { 0.129500464f, 0.140742183f, 0.252942264f }, { 0.632881045f, 0.585725069f, 0.494115502f } },
+					{ { -0.232246459f, -0.456424892f, 0.0018901974f }, { -0.192733914f, -0.263551742f, 0.128166795f }, { 0.458046526f, 0.46103096f, 0.74366647f } }
+				},
+				// 4D : simplex , value
+				{
+					{ { -0.219200298f, 0.0614894815f, 0.30661419f }, { -0.115906283f, -0.0138171269f, 0.142714351f }, { 0.730783284f, 0.820682466f, 0.28052181f } },
+					{ { -0.371591955f, 0.544324875f, 0.308053792f }, { -0.210793912f, 0.215372369f, 0.253541201f }, { 0.349220425f, 0.186573595f, 0.492917657f } }
+				}
+			};
+
+			NoiseSettings GetGoldenSettings(NoiseType type, NoiseFractal fractal)
+			{
+				NoiseSettings settings;
+				settings.type = type;
+				settings.fractal = fractal;
+				settings.seed = 1337;
+				settings.frequency = 0.75f;
+				settings.octaves = 3;
+				settings.lacunarity = 2.0f;
+				settings.gain = 0.5f;
+				return settings;
+			}
+
+			bool CheckGolden(const char* path, uint32_t dimensions, const NoiseSettings& settings, const float* values, const float* expected)
+			{
+				bool passed = true;
+
+				for (uint32_t point = 0; point < GOLDENPOINTS; ++point)
+				{
+					if (!(std::fabs(values[point] - expected[point]) <= NOISE_VERIFYTOLERANCE))
+					{
+						LOG_ERROR("Noise self test mismatch ({0} , {1}D , type {2} , fractal {3} , point {4}) : got {5} , expected {6}",
+							path, dimensions, static_cast<int>(settings.type), static_cast<int>(settings.fractal), point, values[point], expected[point]);
+						passed = false;
+					}
+				}
+
+				return passed;
+			}
+		}
+
+		bool VerifyNoise()
+		{
+			const float* const positions[4] = { GOLDENPOSITIONS[0], GOLDENPOSITIONS[1], GOLDENPOSITIONS[2], GOLDENPOSITIONS[3] };
+
+			bool passed = true;
+
+			for (uint32_t dimensions = 2; dimensions <= 4; ++dimensions)
+			{
+				for (uint32_t type = 0; type < 2; ++type)
+				{
+					for (uint32_t fractal = 0; fractal < 3; ++fractal)
+					{
+						const NoiseSettings settings = GetGoldenSettings(static_cast<NoiseType>(type), static_cast<NoiseFractal>(fractal));
+						const float* expected = GOLDENVALUES[dimensions - 2][type][fractal];
+
+						float scalar[GOLDENPOINTS];
+						for (uint32_t point = 0; point < GOLDENPOINTS; ++point)
+						{
+							const float x = positions[0][point], y = positions[1][point], z = positions[2][point], w = positions[3][point];
+							scalar[point] = dimensions == 2 ? EvaluateNoise(settings, x, y) : dimensions == 3 ? EvaluateNoise(settings, x, y, z) : EvaluateNoise(settings, x, y, z, w);
+						}
+
+						// Fewer points than any kernel width , so this also runs the staged tail path
+						float batch[GOLDENPOINTS];
+						EvaluateBatch(settings, dimensions, positions, batch, GOLDENPOINTS);
+
+						passed &= CheckGolden("scalar", dimensions, settings, scalar, expected);
+						passed &= CheckGolden(MathDispatch::GetTierName(MathDispatch::GetTier()), dimensions, settings, batch, expected);
+					}
+				}
+			}
+
+			return passed;
+		}
+	}
+}
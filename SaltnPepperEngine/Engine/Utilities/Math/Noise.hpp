@@ -0,0 +1,110 @@
+#ifndef NOISE_H
+#define NOISE_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		enum class NoiseType : uint8_t
+		{
+			// Gradient noise on a simplex grid (Perlin 2001 / Gustavson)
+			Simplex,
+			// Hashed lattice values with a quintic fade
+			Value
+		};
+
+		enum class NoiseFractal : uint8_t
+		{
+			// Single octave
+			None,
+			// Fractal Brownian motion , sum of octaves with falling amplitude
+			FBm,
+			// Octaves of (1 - 2|n|) , sharp crests where the base noise crosses zero
+			Ridged
+		};
+
+		/// <summary>
+		/// Everything that shapes a noise field. Every variant returns values in roughly [-1 , 1]
+		/// </summary>
+		struct NoiseSettings
+		{
+			NoiseType type = NoiseType::Simplex;
+			NoiseFractal fractal = NoiseFractal::FBm;
+			int32_t seed = 1337;
+
+			// Scales the input coordinates before the first octave
+			float frequency = 0.01f;
+
+			// Fractal parameters , ignored for NoiseFractal::None
+			uint32_t octaves = 4;
+			float lacunarity = 2.0f;
+			float gain = 0.5f;
+		};
+
+		/// <summary>
+		/// Point arrays with at least this many samples (and grids with this many cells) get split across the job system
+		/// </summary>
+		inline static constexpr size_t NOISE_PARALLELTHRESHOLD = 4096;
+
+		/// <summary>
+		/// Samples per job slice , a multiple of every kernel width so only the last slice has a tail
+		/// </summary>
+		inline static constexpr size_t NOISE_PARALLELGRAIN = 1024;
+
+		/// <summary>
+		/// Largest difference VerifyNoise accepts against its reference values (the tiers differ by FMA rounding)
+		/// </summary>
+		inline static constexpr float NOISE_VERIFYTOLERANCE = 1.0e-5f;
+
+
+		// ===================== SINGLE SAMPLES =========================
+		// Scalar versions of exactly the same algorithms the batch kernels run (up to FMA rounding)
+
+		SNP_API float SimplexNoise(float x, float y, int32_t seed = 0);
+		SNP_API float SimplexNoise(float x, float y, float z, int32_t seed = 0);
+		SNP_API float SimplexNoise(float x, float y, float z, float w, int32_t seed = 0);
+
+		SNP_API float ValueNoise(float x, float y, int32_t seed = 0);
+		SNP_API float ValueNoise(float x, float y, float z, int32_t seed = 0);
+		SNP_API float ValueNoise(float x, float y, float z, float w, int32_t seed = 0);
+
+		/// <summary>
+		/// Evaluates the full settings (frequency , type and fractal) at one point
+		/// </summary>
+		SNP_API float EvaluateNoise(const NoiseSettings& settings, float x, float y);
+		SNP_API float EvaluateNoise(const NoiseSettings& settings, float x, float y, float z);
+		SNP_API float EvaluateNoise(const NoiseSettings& settings, float x, float y, float z, float w);
+
+
+		// ===================== BATCHES =========================
+		// SoA point arrays , evaluated 8 wide (4 on the SSE4.2 tier).
+		// Float precision falls off with the magnitude of the scaled coordinates (around 1e-4 between tiers at 1000 units) ,
+		// keep huge worlds cell relative like TransformCodec does
+
+		SNP_API void EvaluateNoise2D(const NoiseSettings& settings, const float* x, const float* y, float* output, size_t count);
+		SNP_API void EvaluateNoise3D(const NoiseSettings& settings, const float* x, const float* y, const float* z, float* output, size_t count);
+		SNP_API void EvaluateNoise4D(const NoiseSettings& settings, const float* x, const float* y, const float* z, const float* w, float* output, size_t count);
+
+		/// <summary>
+		/// Fills a row major width x height grid , sample (i , j) is taken at origin + (i , j) * step
+		/// </summary>
+		SNP_API void EvaluateNoiseGrid2D(const NoiseSettings& settings, const Vector2& origin, const Vector2& step, uint32_t width, uint32_t height, float* output);
+
+		/// <summary>
+		/// Fills a width x height x depth grid (x fastest , then y , then z) , sample (i , j , k) is taken at origin + (i , j , k) * step
+		/// </summary>
+		SNP_API void EvaluateNoiseGrid3D(const NoiseSettings& settings, const Vector3& origin, const Vector3& step, uint32_t width, uint32_t height, uint32_t depth, float* output);
+
+		/// <summary>
+		/// Checks the scalar path and the active batch kernels against reference values , logs and returns false on a mismatch.
+		/// Meant for startup / CI after touching the noise code or switching compilers
+		/// </summary>
+		SNP_API bool VerifyNoise();
+	}
+}
+
+#endif // !NOISE_H
@@ -0,0 +1,499 @@
+#ifndef NOISEDETAIL_H
+#define NOISEDETAIL_H
+#include "Utilities/Math/Noise.hpp"
+#include <cstring>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// The noise algorithms written once against a lane type , instantiated by Noise.cpp (scalar) and each MathKernels<Tier>.cpp.
+		/// Lane types are defined inside those translation units with internal linkage , so every instantiation stays local to
+		/// the TU (and the instruction set) it was compiled for.
+		/// A lane type provides Float / Int / Mask , WIDTH and : Set , SetInt , Load , Store , Add , Sub , Mul , MulAdd (a * b + c) ,
+		/// Floor , Abs , Max , Greater , Select (mask ? a : b) , MaskOr , ToInt (truncating) , ToFloat (signed) ,
+		/// IntAdd , IntMul , IntAnd , IntXor , IntShiftRight<N> (logical) , IntLess , IntEqual , IntSelect and FlipSign<Bit> (negate where hash bit Bit is set)
+		/// </summary>
+		namespace NoiseDetail
+		{
+			// Hash primes and finalizer multiplier for the integer lattice coordinates
+			inline static constexpr int32_t PRIMEX = 501125321;
+			inline static constexpr int32_t PRIMEY = 1136930381;
+			inline static constexpr int32_t PRIMEZ = 1720413743;
+			inline static constexpr int32_t PRIMEW = 1066037191;
+			inline static constexpr int32_t HASHMULTIPLIER = 0x27D4EB2D;
+
+			// 2^-31 , maps a signed 32 bit hash to [-1 , 1)
+			inline static constexpr float HASHTOUNIT = 1.0f / 2147483648.0f;
+
+			// Skew / unskew factors : F = (sqrt(n + 1) - 1) / n , G = (1 - 1 / sqrt(n + 1)) / n
+			inline static constexpr float F2 = 0.366025403784438647f;
+			inline static constexpr float G2 = 0.211324865405187118f;
+			inline static constexpr float F3 = 1.0f / 3.0f;
+			inline static constexpr float G3 = 1.0f / 6.0f;
+			inline static constexpr float F4 = 0.309016994374947424f;
+			inline static constexpr float G4 = 0.138196601125010515f;
+
+			// Kernel radius and the output scale that brings each simplex variant to about [-1 , 1]
+			inline static constexpr float RADIUS2 = 0.5f;
+			inline static constexpr float RADIUS3 = 0.6f;
+			inline static constexpr float RADIUS4 = 0.6f;
+			inline static constexpr float SCALE2 = 40.0f;
+			inline static constexpr float SCALE3 = 32.0f;
+			inline static constexpr float SCALE4 = 27.0f;
+
+			// Longest point array handled in one call by the grid helpers (rows are fed through in pieces this long)
+			inline static constexpr size_t GRIDSPANLENGTH = 256;
+
+			template <typename L>
+			inline typename L::Int Hash(typename L::Int seed, typename L::Int x, typename L::Int y, typename L::Int z, typename L::Int w)
+			{
+				typename L::Int hash = L::IntXor(L::IntXor(seed, x), L::IntXor(L::IntXor(y, z), w));
+				hash = L::IntMul(hash, L::SetInt(HASHMULTIPLIER));
+				return L::IntXor(hash, L::template IntShiftRight<15>(hash));
+			}
+
+			template <typename L>
+			inline typename L::Float HashToValue(typename L::Int hash)
+			{
+				return L::Mul(L::ToFloat(hash), L::Set(HASHTOUNIT));
+			}
+
+			// Quintic fade t^3 (t (6t - 15) + 10)
+			template <typename L>
+			inline typename L::Float Fade(typename L::Float t)
+			{
+				const typename L::Float inner = L::MulAdd(t, L::MulAdd(t, L::Set(6.0f), L::Set(-15.0f)), L::Set(10.0f));
+				return L::Mul(L::Mul(L::Mul(t, t), t), inner);
+			}
+
+			template <typename L>
+			inline typename L::Float Lerp(typename L::Float from, typename L::Float to, typename L::Float weight)
+			{
+				return L::MulAdd(L::Sub(to, from), weight, from);
+			}
+
+			template <typename L>
+			inline typename L::Float Step(typename L::Mask mask)
+			{
+				return L::Select(mask, L::Set(1.0f), L::Set(0.0f));
+			}
+
+
+			// ===================== GRADIENTS =========================
+			// Gustavson's bit twiddled gradient sets : (±1 , ±2) in 2D , the 12 cube edges in 3D and the 32 tesseract edges in 4D
+
+			template <typename L>
+			inline typename L::Float Gradient(typename L::Int hash, typename L::Float x, typename L::Float y)
+			{
+				const typename L::Int index = L::IntAnd(hash, L::SetInt(7));
+				const typename L::Mask low = L::IntLess(index, L::SetInt(4));
+
+				const typename L::Float u = L::Select(low, x, y);
+				const typename L::Float v = L::Select(low, y, x);
+
+				return L::Add(L::template FlipSign<0>(u, hash), L::template FlipSign<1>(L::Add(v, v), hash));
+			}
+
+			template <typename L>
+			inline typename L::Float Gradient(typename L::Int hash, typename L::Float x, typename L::Float y, typename L::Float z)
+			{
+				const typename L::Int index = L::IntAnd(hash, L::SetInt(15));
+				const typename L::Mask edge = L::MaskOr(L::IntEqual(index, L::SetInt(12)), L::IntEqual(index, L::SetInt(14)));
+
+				const typename L::Float u = L::Select(L::IntLess(index, L::SetInt(8)), x, y);
+				const typename L::Float v = L::Select(L::IntLess(index, L::SetInt(4)), y, L::Select(edge, x, z));
+
+				return L::Add(L::template FlipSign<0>(u, hash), L::template FlipSign<1>(v, hash));
+			}
+
+			template <typename L>
+			inline typename L::Float Gradient(typename L::Int hash, typename L::Float x, typename L::Float y, typename L::Float z, typename L::Float w)
+			{
+				const typename L::Int index = L::IntAnd(hash, L::SetInt(31));
+
+				const typename L::Float u = L::Select(L::IntLess(index, L::SetInt(24)), x, y);
+				const typename L::Float v = L::Select(L::IntLess(index, L::SetInt(16)), y, z);
+				const typename L::Float t = L::Select(L::IntLess(index, L::SetInt(8)), z, w);
+
+				return L::Add(L::Add(L::template FlipSign<0>(u, hash), L::template FlipSign<1>(v, hash)), L::template FlipSign<2>(t, hash));
+			}
+
+			// max(0 , falloff)^4 * gradient
+			template <typename L>
+			inline typename L::Float Contribution(typename L::Float falloff, typename L::Float gradient)
+			{
+				const typename L::Float clamped = L::Max(falloff, L::Set(0.0f));
+				const typename L::Float squared = L::Mul(clamped, clamped);
+				return L::Mul(L::Mul(squared, squared), gradient);
+			}
+
+			template <typename L>
+			inline typename L::Float Falloff(float radius, typename L::Float x, typename L::Float y)
+			{
+				return L::Sub(L::Set(radius), L::MulAdd(x, x, L::Mul(y, y)));
+			}
+
+			template <typename L>
+			inline typename L::Float Falloff(float radius, typename L::Float x, typename L::Float y, typename L::Float z)
+			{
+				return L::Sub(L::Set(radius), L::MulAdd(x, x, L::MulAdd(y, y, L::Mul(z, z))));
+			}
+
+			template <typename L>
+			inline typename L::Float Falloff(float radius, typename L::Float x, typename L::Float y, typename L::Float z, typename L::Float w)
+			{
+				return L::Sub(L::Set(radius), L::MulAdd(x, x, L::MulAdd(y, y, L::MulAdd(z, z, L::Mul(w, w)))));
+			}
+
+
+			// ===================== SIMPLEX =========================
+
+			template <typename L>
+			typename L::Float Simplex(typename L::Float x, typename L::Float y, typename L::Int seed)
+			{
+				using Float = typename L::Float;
+				using Int = typename L::Int;
+
+				const Float skew = L::Mul(L::Add(x, y), L::Set(F2));
+				const Float cellX = L::Floor(L::Add(x, skew));
+				const Float cellY = L::Floor(L::Add(y, skew));
+
+				const Float unskew = L::Mul(L::Add(cellX, cellY), L::Set(G2));
+				const Float x0 = L::Sub(x, L::Sub(cellX, unskew));
+				const Float y0 = L::Sub(y, L::Sub(cellY, unskew));
+
+				// Lower or upper triangle of the skewed cell
+				const typename L::Mask lower = L::Greater(x0, y0);
+				const Float stepX = Step<L>(lower);
+				const Float stepY = L::Sub(L::Set(1.0f), stepX);
+
+				const Float x1 = L::Add(L::Sub(x0, stepX), L::Set(G2));
+				const Float y1 = L::Add(L::Sub(y0, stepY), L::Set(G2));
+				const Float x2 = L::Add(x0, L::Set(2.0f * G2 - 1.0f));
+				const Float y2 = L::Add(y0, L::Set(2.0f * G2 - 1.0f));
+
+				const Int primeX = L::SetInt(PRIMEX);
+				const Int primeY = L::SetInt(PRIMEY);
+				const Int zero = L::SetInt(0);
+
+				const Int i0 = L::IntMul(L::ToInt(cellX), primeX);
+				const Int j0 = L::IntMul(L::ToInt(cellY), primeY);
+				const Int i1 = L::IntAdd(i0, L::IntSelect(lower, primeX, zero));
+				const Int j1 = L::IntAdd(j0, L::IntSelect(lower, zero, primeY));
+
+				Float total = Contribution<L>(Falloff<L>(RADIUS2, x0, y0), Gradient<L>(Hash<L>(seed, i0, j0, zero, zero), x0, y0));
+				total = L::Add(total, Contribution<L>(Falloff<L>(RADIUS2, x1, y1), Gradient<L>(Hash<L>(seed, i1, j1, zero, zero), x1, y1)));
+				total = L::Add(total, Contribution<L>(Falloff<L>(RADIUS2, x2, y2), Gradient<L>(Hash<L>(seed, L::IntAdd(i0, primeX), L::IntAdd(j0, primeY), zero, zero), x2, y2)));
+
+				return L::Mul(total, L::Set(SCALE2));
+			}
+
+			template <typename L>
+			typename L::Float Simplex(typename L::Float x, typename L::Float y, typename L::Float z, typename L::Int seed)
+			{
+				using Float = typename L::Float;
+				using Int = typename L::Int;
+				using Mask = typename L::Mask;
+
+				const Float skew = L::Mul(L::Add(L::Add(x, y), z), L::Set(F3));
+				const Float cellX = L::Floor(L::Add(x, skew));
+				const Float cellY = L::Floor(L::Add(y, skew));
+				const Float cellZ = L::Floor(L::Add(z, skew));
+
+				const Float unskew = L::Mul(L::Add(L::Add(cellX, cellY), cellZ), L::Set(G3));
+				const Float x0 = L::Sub(x, L::Sub(cellX, unskew));
+				const Float y0 = L::Sub(y, L::Sub(cellY, unskew));
+				const Float z0 = L::Sub(z, L::Sub(cellZ, unskew));
+
+				// Rank the offsets to find which of the six tetrahedra holds the point
+				const Mask xy = L::Greater(x0, y0);
+				const Mask xz = L::Greater(x0, z0);
+				const Mask yz = L::Greater(y0, z0);
+
+				const Float one = L::Set(1.0f);
+				const Float zeroF = L::Set(0.0f);
+				const Float rankX = L::Add(Step<L>(xy), Step<L>(xz));
+				const Float rankY = L::Add(L::Select(xy, zeroF, one), Step<L>(yz));
+				const Float rankZ = L::Add(L::Select(xz, zeroF, one), L::Select(yz, zeroF, one));
+
+				const Float half = L::Set(0.5f);
+				const Float threshold = L::Set(1.5f);
+				const Mask i1 = L::Greater(rankX, threshold), j1 = L::Greater(rankY, threshold), k1 = L::Greater(rankZ, threshold);
+				const Mask i2 = L::Greater(rankX, half), j2 = L::Greater(rankY, half), k2 = L::Greater(rankZ, half);
+
+				const Float x1 = L::Add(L::Sub(x0, Step<L>(i1)), L::Set(G3));
+				const Float y1 = L::Add(L::Sub(y0, Step<L>(j1)), L::Set(G3));
+				const Float z1 = L::Add(L::Sub(z0, Step<L>(k1)), L::Set(G3));
+				const Float x2 = L::Add(L::Sub(x0, Step<L>(i2)), L::Set(2.0f * G3));
+				const Float y2 = L::Add(L::Sub(y0, Step<L>(j2)), L::Set(2.0f * G3));
+				const Float z2 = L::Add(L::Sub(z0, Step<L>(k2)), L::Set(2.0f * G3));
+				const Float x3 = L::Add(x0, L::Set(3.0f * G3 - 1.0f));
+				const Float y3 = L::Add(y0, L::Set(3.0f * G3 - 1.0f));
+				const Float z3 = L::Add(z0, L::Set(3.0f * G3 - 1.0f));
+
+				const Int primeX = L::SetInt(PRIMEX);
+				const Int primeY = L::SetInt(PRIMEY);
+				const Int primeZ = L::SetInt(PRIMEZ);
+				const Int zero = L::SetInt(0);
+
+				const Int i0 = L::IntMul(L::ToInt(cellX), primeX);
+				const Int j0 = L::IntMul(L::ToInt(cellY), primeY);
+				const Int k0 = L::IntMul(L::ToInt(cellZ), primeZ);
+
+				const Int hash0 = Hash<L>(seed, i0, j0, k0, zero);
+				const Int hash1 = Hash<L>(seed, L::IntAdd(i0, L::IntSelect(i1, primeX, zero)), L::IntAdd(j0, L::IntSelect(j1, primeY, zero)), L::IntAdd(k0, L::IntSelect(k1, primeZ, zero)), zero);
+				const Int hash2 = Hash<L>(seed, L::IntAdd(i0, L::IntSelect(i2, primeX, zero)), L::IntAdd(j0, L::IntSelect(j2, primeY, zero)), L::IntAdd(k0, L::IntSelect(k2, primeZ, zero)), zero);
+				const Int hash3 = Hash<L>(seed, L::IntAdd(i0, primeX), L::IntAdd(j0, primeY), L::IntAdd(k0, primeZ), zero);
+
+				Float total = Contribution<L>(Falloff<L>(RADIUS3, x0, y0, z0), Gradient<L>(hash0, x0, y0, z0));
+				total = L::Add(total, Contribution<L>(Falloff<L>(RADIUS3, x1, y1, z1), Gradient<L>(hash1, x1, y1, z1)));
+				total = L::Add(total, Contribution<L>(Falloff<L>(RADIUS3, x2, y2, z2), Gradient<L>(hash2, x2, y2, z2)));
+				total = L::Add(total, Contribution<L>(Falloff<L>(RADIUS3, x3, y3, z3), Gradient<L>(hash3, x3, y3, z3)));
+
+				return L::Mul(total, L::Set(SCALE3));
+			}
+
+			template <typename L>
+			typename L::Float Simplex(typename L::Float x, typename L::Float y, typename L::Float z, typename L::Float w, typename L::Int seed)
+			{
+				using Float = typename L::Float;
+				using Int = typename L::Int;
+				using Mask = typename L::Mask;
+
+				const Float skew = L::Mul(L::Add(L::Add(x, y), L::Add(z, w)), L::Set(F4));
+				const Float cell[4] = { L::Floor(L::Add(x, skew)), L::Floor(L::Add(y, skew)), L::Floor(L::Add(z, skew)), L::Floor(L::Add(w, skew)) };
+
+				const Float unskew = L::Mul(L::Add(L::Add(cell[0], cell[1]), L::Add(cell[2], cell[3])), L::Set(G4));
+				const Float offset[4] = { L::Sub(x, L::Sub(cell[0], unskew)), L::Sub(y, L::Sub(cell[1], unskew)), L::Sub(z, L::Sub(cell[2], unskew)), L::Sub(w, L::Sub(cell[3], unskew)) };
+
+				// Rank every axis against the others , the rank picks which of the 24 simplices holds the point
+				const Float one = L::Set(1.0f);
+				const Float zeroF = L::Set(0.0f);
+				Float rank[4] = { zeroF, zeroF, zeroF, zeroF };
+
+				for (int first = 0; first < 4; ++first)
+				{
+					for (int second = first + 1; second < 4; ++second)
+					{
+						const Mask greater = L::Greater(offset[first], offset[second]);
+						rank[first] = L::Add(rank[first], Step<L>(greater));
+						rank[second] = L::Add(rank[second], L::Select(greater, zeroF, one));
+					}
+				}
+
+				const Int zero = L::SetInt(0);
+				const Int prime[4] = { L::SetInt(PRIMEX), L::SetInt(PRIMEY), L::SetInt(PRIMEZ), L::SetInt(PRIMEW) };
+
+				Int base[4];
+				for (int axis = 0; axis < 4; ++axis) { base[axis] = L::IntMul(L::ToInt(cell[axis]), prime[axis]); }
+
+				Float total = zeroF;
+
+				// Corner c steps along every axis whose rank is at least 4 - c
+				for (int corner = 0; corner < 5; ++corner)
+				{
+					const Float threshold = L::Set(3.5f - static_cast<float>(corner));
+					const Float unskewCorner = L::Set(static_cast<float>(corner) * G4);
+
+					Float local[4];
+					Int lattice[4];
+
+					for (int axis = 0; axis < 4; ++axis)
+					{
+						const Mask stepped = L::Greater(rank[axis], threshold);
+						local[axis] = L::Add(L::Sub(offset[axis], Step<L>(stepped)), unskewCorner);
+						lattice[axis] = L::IntAdd(base[axis], L::IntSelect(stepped, prime[axis], zero));
+					}
+
+					const Int hash = Hash<L>(seed, lattice[0], lattice[1], lattice[2], lattice[3]);
+					const Float falloff = Falloff<L>(RADIUS4, local[0], local[1], local[2], local[3]);
+					total = L::Add(total, Contribution<L>(falloff, Gradient<L>(hash, local[0], local[1], local[2], local[3])));
+				}
+
+				return L::Mul(total, L::Set(SCALE4));
+			}
+
+
+			// ===================== VALUE =========================
+
+			template <typename L>
+			typename L::Float Value(typename L::Float x, typename L::Float y, typename L::Int seed)
+			{
+				using Float = typename L::Float;
+				using Int = typename L::Int;
+
+				const Float cellX = L::Floor(x);
+				const Float cellY = L::Floor(y);
+				const Float fadeX = Fade<L>(L::Sub(x, cellX));
+				const Float fadeY = Fade<L>(L::Sub(y, cellY));
+
+				const Int zero = L::SetInt(0);
+				const Int x0 = L::IntMul(L::ToInt(cellX), L::SetInt(PRIMEX));
+				const Int y0 = L::IntMul(L::ToInt(cellY), L::SetInt(PRIMEY));
+				const Int x1 = L::IntAdd(x0, L::SetInt(PRIMEX));
+				const Int y1 = L::IntAdd(y0, L::SetInt(PRIMEY));
+
+				const Float bottom = Lerp<L>(HashToValue<L>(Hash<L>(seed, x0, y0, zero, zero)), HashToValue<L>(Hash<L>(seed, x1, y0, zero, zero)), fadeX);
+				const Float top = Lerp<L>(HashToValue<L>(Hash<L>(seed, x0, y1, zero, zero)), HashToValue<L>(Hash<L>(seed, x1, y1, zero, zero)), fadeX);
+
+				return Lerp<L>(bottom, top, fadeY);
+			}
+
+			// Trilinear blend of one 3D lattice cell , w is the (already primed) fourth coordinate or zero
+			template <typename L>
+			typename L::Float ValueCell(typename L::Int seed, const typename L::Int (&low)[3], const typename L::Int (&high)[3], typename L::Int w, const typename L::Float (&fade)[3])
+			{
+				using Float = typename L::Float;
+
+				const Float x00 = Lerp<L>(HashToValue<L>(Hash<L>(seed, low[0], low[1], low[2], w)), HashToValue<L>(Hash<L>(seed, high[0], low[1], low[2], w)), fade[0]);
+				const Float x10 = Lerp<L>(HashToValue<L>(Hash<L>(seed, low[0], high[1], low[2], w)), HashToValue<L>(Hash<L>(seed, high[0], high[1], low[2], w)), fade[0]);
+				const Float x01 = Lerp<L>(HashToValue<L>(Hash<L>(seed, low[0], low[1], high[2], w)), HashToValue<L>(Hash<L>(seed, high[0], low[1], high[2], w)), fade[0]);
+				const Float x11 = Lerp<L>(HashToValue<L>(Hash<L>(seed, low[0], high[1], high[2], w)), HashToValue<L>(Hash<L>(seed, high[0], high[1], high[2], w)), fade[0]);
+
+				return Lerp<L>(Lerp<L>(x00, x10, fade[1]), Lerp<L>(x01, x11, fade[1]), fade[2]);
+			}
+
+			template <typename L>
+			void SetupValueCell(const typename L::Float (&position)[3], typename L::Int (&low)[3], typename L::Int (&high)[3], typename L::Float (&fade)[3])
+			{
+				const int32_t primes[3] = { PRIMEX, PRIMEY, PRIMEZ };
+
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					const typename L::Float cell = L::Floor(position[axis]);
+					fade[axis] = Fade<L>(L::Sub(position[axis], cell));
+					low[axis] = L::IntMul(L::ToInt(cell), L::SetInt(primes[axis]));
+					high[axis] = L::IntAdd(low[axis], L::SetInt(primes[axis]));
+				}
+			}
+
+			template <typename L>
+			typename L::Float Value(typename L::Float x, typename L::Float y, typename L::Float z, typename L::Int seed)
+			{
+				typename L::Int low[3], high[3];
+				typename L::Float fade[3];
+				SetupValueCell<L>({ x, y, z }, low, high, fade);
+
+				return ValueCell<L>(seed, low, high, L::SetInt(0), fade);
+			}
+
+			template <typename L>
+			typename L::Float Value(typename L::Float x, typename L::Float y, typename L::Float z, typename L::Float w, typename L::Int seed)
+			{
+				typename L::Int low[3], high[3];
+				typename L::Float fade[3];
+				SetupValueCell<L>({ x, y, z }, low, high, fade);
+
+				const typename L::Float cellW = L::Floor(w);
+				const typename L::Float fadeW = Fade<L>(L::Sub(w, cellW));
+				const typename L::Int w0 = L::IntMul(L::ToInt(cellW), L::SetInt(PRIMEW));
+				const typename L::Int w1 = L::IntAdd(w0, L::SetInt(PRIMEW));
+
+				return Lerp<L>(ValueCell<L>(seed, low, high, w0, fade), ValueCell<L>(seed, low, high, w1, fade), fadeW);
+			}
+
+
+			// ===================== FRACTALS =========================
+
+			template <typename L, size_t Dimensions>
+			inline typename L::Float Single(NoiseType type, const typename L::Float (&position)[Dimensions], typename L::Int seed)
+			{
+				static_assert(Dimensions >= 2 && Dimensions <= 4, "Noise is available in 2 , 3 and 4 dimensions");
+
+				if constexpr (Dimensions == 2)
+				{
+					return type == NoiseType::Simplex ? Simplex<L>(position[0], position[1], seed) : Value<L>(position[0], position[1], seed);
+				}
+				else if constexpr (Dimensions == 3)
+				{
+					return type == NoiseType::Simplex ? Simplex<L>(position[0], position[1], position[2], seed) : Value<L>(position[0], position[1], position[2], seed);
+				}
+				else
+				{
+					return type == NoiseType::Simplex ? Simplex<L>(position[0], position[1], position[2], position[3], seed) : Value<L>(position[0], position[1], position[2], position[3], seed);
+				}
+			}
+
+			/// <summary>
+			/// Full settings evaluation : frequency , then one octave or an fBm / ridged sum normalised by the total amplitude.
+			/// Octave o uses seed + o so the layers don't line up
+			/// </summary>
+			template <typename L, size_t Dimensions>
+			typename L::Float Evaluate(const NoiseSettings& settings, const typename L::Float (&coordinates)[Dimensions])
+			{
+				using Float = typename L::Float;
+
+				Float position[Dimensions];
+				for (size_t axis = 0; axis < Dimensions; ++axis) { position[axis] = L::Mul(coordinates[axis], L::Set(settings.frequency)); }
+
+				if (settings.fractal == NoiseFractal::None || settings.octaves <= 1)
+				{
+					const Float single = Single<L, Dimensions>(settings.type, position, L::SetInt(settings.seed));
+					return settings.fractal == NoiseFractal::Ridged ? L::Sub(L::Set(1.0f), L::Add(L::Abs(single), L::Abs(single))) : single;
+				}
+
+				const bool ridged = settings.fractal == NoiseFractal::Ridged;
+				const Float lacunarity = L::Set(settings.lacunarity);
+
+				Float total = L::Set(0.0f);
+				float amplitude = 1.0f;
+				float amplitudeSum = 0.0f;
+
+				for (uint32_t octave = 0; octave < settings.octaves; ++octave)
+				{
+					const int32_t seed = static_cast<int32_t>(static_cast<uint32_t>(settings.seed) + octave);
+					Float sample = Single<L, Dimensions>(settings.type, position, L::SetInt(seed));
+
+					if (ridged) { sample = L::Sub(L::Set(1.0f), L::Add(L::Abs(sample), L::Abs(sample))); }
+
+					total = L::MulAdd(sample, L::Set(amplitude), total);
+					amplitudeSum += amplitude;
+					amplitude *= settings.gain;
+
+					for (size_t axis = 0; axis < Dimensions; ++axis) { position[axis] = L::Mul(position[axis], lacunarity); }
+				}
+
+				return amplitudeSum > 0.0f ? L::Mul(total, L::Set(1.0f / amplitudeSum)) : total;
+			}
+
+			/// <summary>
+			/// SoA point array loop , the partial last step is staged through zero padded lanes
+			/// </summary>
+			template <typename L, size_t Dimensions>
+			void EvaluatePoints(const NoiseSettings& settings, const float* const* coordinates, float* output, size_t count)
+			{
+				using Float = typename L::Float;
+
+				size_t index = 0;
+
+				for (; index + L::WIDTH <= count; index += L::WIDTH)
+				{
+					Float position[Dimensions];
+					for (size_t axis = 0; axis < Dimensions; ++axis) { position[axis] = L::Load(coordinates[axis] + index); }
+
+					L::Store(output + index, Evaluate<L, Dimensions>(settings, position));
+				}
+
+				if (index < count)
+				{
+					const size_t remaining = count - index;
+					float staged[L::WIDTH] = {};
+					Float position[Dimensions];
+
+					for (size_t axis = 0; axis < Dimensions; ++axis)
+					{
+						std::memcpy(staged, coordinates[axis] + index, remaining * sizeof(float));
+						position[axis] = L::Load(staged);
+					}
+
+					L::Store(staged, Evaluate<L, Dimensions>(settings, position));
+					std::memcpy(output + index, staged, remaining * sizeof(float));
+				}
+			}
+		}
+	}
+}
+
+#endif // !NOISEDETAIL_H
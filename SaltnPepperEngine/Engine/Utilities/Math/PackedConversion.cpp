@@ -0,0 +1,192 @@
+#include "PackedConversion.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace
+		{
+			// Crosses the parallel threshold with a tail that isn't a multiple of any kernel width
+			inline static constexpr size_t VERIFYLARGECOUNT = 2 * PACKED_PARALLELTHRESHOLD + 13;
+			inline static constexpr size_t VERIFYSMALLCOUNT = 1021;
+
+			// Slack on the round trip bounds for the rounding of the decode multiply itself
+			inline static constexpr float VERIFYSLACK = 1.0e-7f;
+
+			inline static constexpr PackedFormat VERIFYFORMATS[] = { PackedFormat::Half, PackedFormat::SNorm8, PackedFormat::SNorm16, PackedFormat::UNorm8, PackedFormat::UNorm16 };
+			inline static constexpr const char* FORMATNAMES[] = { "Half", "SNorm8", "SNorm16", "UNorm8", "UNorm16" };
+
+			struct NormRange
+			{
+				float minimum;
+				float scale;
+				float maxError;
+			};
+
+			NormRange GetNormRange(PackedFormat format)
+			{
+				switch (format)
+				{
+				case PackedFormat::SNorm8: return NormRange{ -1.0f, 127.0f, PACKED_SNORM8_MAXERROR };
+				case PackedFormat::SNorm16: return NormRange{ -1.0f, 32767.0f, PACKED_SNORM16_MAXERROR };
+				case PackedFormat::UNorm8: return NormRange{ 0.0f, 255.0f, PACKED_UNORM8_MAXERROR };
+				default: return NormRange{ 0.0f, 65535.0f, PACKED_UNORM16_MAXERROR };
+				}
+			}
+
+			// The packed element the kernels must produce , read back as a sign extended integer (or the raw HALF bits)
+			int32_t PackReference(float value, PackedFormat format)
+			{
+				if (format == PackedFormat::Half) { return DirectX::PackedVector::XMConvertFloatToHalf(value); }
+
+				const NormRange range = GetNormRange(format);
+				return static_cast<int32_t>(std::nearbyint(std::clamp(value, range.minimum, 1.0f) * range.scale));
+			}
+
+			int32_t ReadPacked(const uint8_t* bytes, size_t index, PackedFormat format)
+			{
+				switch (format)
+				{
+				case PackedFormat::SNorm8: return static_cast<int8_t>(bytes[index]);
+				case PackedFormat::UNorm8: return bytes[index];
+				default: break;
+				}
+
+				uint16_t word = 0;
+				std::memcpy(&word, bytes + index * 2, sizeof(word));
+				return format == PackedFormat::SNorm16 ? static_cast<int16_t>(word) : static_cast<int32_t>(word);
+			}
+
+			// Half covers magnitudes from the subnormals to past the overflow point , the norm formats get a sweep a bit wider than their range
+			std::vector<float> MakeVerifyValues(size_t count, PackedFormat format)
+			{
+				std::vector<float> values(count);
+				for (size_t index = 0; index < count; ++index)
+				{
+					const float t = static_cast<float>(index) / static_cast<float>(count - 1);
+
+					if (format == PackedFormat::Half)
+					{
+						const float magnitude = std::exp2(-26.0f + 43.0f * t);
+						values[index] = (index & 1) ? -magnitude : magnitude;
+					}
+					else
+					{
+						values[index] = -1.25f + 2.5f * t;
+					}
+				}
+				return values;
+			}
+
+			bool VerifyFormat(PackedFormat format, size_t count)
+			{
+				const char* name = FORMATNAMES[static_cast<size_t>(format)];
+				const std::vector<float> values = MakeVerifyValues(count, format);
+
+				std::vector<uint8_t> packed(count * GetPackedSize(format));
+				std::vector<float> unpacked(count);
+
+				PackFloats(values.data(), packed.data(), count, format);
+				UnpackFloats(packed.data(), unpacked.data(), count, format);
+
+				for (size_t index = 0; index < count; ++index)
+				{
+					const float value = values[index];
+					const int32_t expected = PackReference(value, format);
+					const int32_t result = ReadPacked(packed.data(), index, format);
+
+					if (result != expected)
+					{
+						LOG_ERROR("Packed self test ({0} , {1} elements) : {2} packed to {3} , expected {4}", name, count, value, result, expected);
+						return false;
+					}
+
+					float error = 0.0f;
+					float bound = 0.0f;
+
+					if (format == PackedFormat::Half)
+					{
+						// Only the normal half range has a relative bound , subnormals and overflow are covered by the bit match above
+						const float magnitude = std::fabs(value);
+						if (magnitude < 6.103515625e-5f || magnitude > 65504.0f) { continue; }
+
+						error = std::fabs(unpacked[index] - value);
+						bound = magnitude * PACKED_HALF_MAXRELATIVEERROR;
+					}
+					else
+					{
+						const NormRange range = GetNormRange(format);
+						error = std::fabs(unpacked[index] - std::clamp(value, range.minimum, 1.0f));
+						bound = range.maxError + VERIFYSLACK;
+					}
+
+					if (!(error <= bound))
+					{
+						LOG_ERROR("Packed self test ({0} , {1} elements) : {2} came back as {3} , error {4} above the bound {5}", name, count, value, unpacked[index], error, bound);
+						return false;
+					}
+				}
+
+				return true;
+			}
+		}
+
+		void PackFloats(const float* source, void* destination, size_t count, PackedFormat format)
+		{
+			const MathKernelTable& kernels = MathDispatch::GetKernels();
+
+			if (count < PACKED_PARALLELTHRESHOLD)
+			{
+				kernels.PackFloats(source, destination, count, format);
+				return;
+			}
+
+			uint8_t* const bytes = static_cast<uint8_t*>(destination);
+			const size_t elementSize = GetPackedSize(format);
+
+			Jobs::JobSystem::ParallelFor(count, PACKED_PARALLELGRAIN, [&](size_t begin, size_t end)
+			{
+				kernels.PackFloats(source + begin, bytes + begin * elementSize, end - begin, format);
+			});
+		}
+
+		void UnpackFloats(const void* source, float* destination, size_t count, PackedFormat format)
+		{
+			const MathKernelTable& kernels = MathDispatch::GetKernels();
+
+			if (count < PACKED_PARALLELTHRESHOLD)
+			{
+				kernels.UnpackFloats(source, destination, count, format);
+				return;
+			}
+
+			const uint8_t* const bytes = static_cast<const uint8_t*>(source);
+			const size_t elementSize = GetPackedSize(format);
+
+			Jobs::JobSystem::ParallelFor(count, PACKED_PARALLELGRAIN, [&](size_t begin, size_t end)
+			{
+				kernels.UnpackFloats(bytes + begin * elementSize, destination + begin, end - begin, format);
+			});
+		}
+
+		bool VerifyPackedConversion()
+		{
+			bool passed = true;
+
+			for (PackedFormat format : VERIFYFORMATS)
+			{
+				passed &= VerifyFormat(format, VERIFYSMALLCOUNT);
+				passed &= VerifyFormat(format, VERIFYLARGECOUNT);
+			}
+
+			return passed;
+		}
+	}
+}
@@ -0,0 +1,93 @@
+#ifndef PACKEDCONVERSION_H
+#define PACKEDCONVERSION_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Compact storage formats for float streams (vertex attributes , animation tracks , network payloads)
+		/// </summary>
+		enum class PackedFormat : uint8_t
+		{
+			// IEEE 754 binary16 (DirectX::PackedVector::HALF) , round to nearest even
+			Half,
+
+			// [-1 , 1] -> int8 / int16 (value * 127 / 32767) , -128 / -32768 decode to -1 like D3D
+			SNorm8,
+			SNorm16,
+
+			// [0 , 1] -> uint8 / uint16 (value * 255 / 65535)
+			UNorm8,
+			UNorm16
+		};
+
+		/// <summary>
+		/// Arrays with at least this many elements get split across the job system
+		/// </summary>
+		inline static constexpr size_t PACKED_PARALLELTHRESHOLD = 1 << 16;
+
+		/// <summary>
+		/// Elements per job slice , a multiple of every kernel width so only the last slice has a tail
+		/// </summary>
+		inline static constexpr size_t PACKED_PARALLELGRAIN = 1 << 14;
+
+		// Worst case round trip error (float -> packed -> float) for values inside the format's range.
+		// Half is relative (half an ulp of the 11 bit significand) , the norm formats are absolute (half a step)
+		inline static constexpr float PACKED_HALF_MAXRELATIVEERROR = 1.0f / 2048.0f;
+		inline static constexpr float PACKED_SNORM8_MAXERROR = 0.5f / 127.0f;
+		inline static constexpr float PACKED_SNORM16_MAXERROR = 0.5f / 32767.0f;
+		inline static constexpr float PACKED_UNORM8_MAXERROR = 0.5f / 255.0f;
+		inline static constexpr float PACKED_UNORM16_MAXERROR = 0.5f / 65535.0f;
+
+		/// <summary>
+		/// Size in bytes of a single packed element
+		/// </summary>
+		inline constexpr size_t GetPackedSize(PackedFormat format)
+		{
+			return (format == PackedFormat::SNorm8 || format == PackedFormat::UNorm8) ? 1 : 2;
+		}
+
+		/// <summary>
+		/// Converts count floats into the packed format. Out of range values are clamped (Half saturates to infinity)
+		/// </summary>
+		SNP_API void PackFloats(const float* source, void* destination, size_t count, PackedFormat format);
+
+		/// <summary>
+		/// Expands count packed elements back to floats
+		/// </summary>
+		SNP_API void UnpackFloats(const void* source, float* destination, size_t count, PackedFormat format);
+
+
+		/// <summary>
+		/// Checks PackFloats / UnpackFloats for every format against DirectXPackedVector / the scalar formulas and the round trip bounds above ,
+		/// on an array small enough for the single threaded path and one large enough to be split across the job system.
+		/// Logs and returns false on a mismatch
+		/// </summary>
+		SNP_API bool VerifyPackedConversion();
+
+
+		// ================= TYPED WRAPPERS ======================
+
+		inline void ConvertFloatToHalf(const float* source, HALF* destination, size_t count) { PackFloats(source, destination, count, PackedFormat::Half); }
+		inline void ConvertHalfToFloat(const HALF* source, float* destination, size_t count) { UnpackFloats(source, destination, count, PackedFormat::Half); }
+
+		inline void ConvertFloatToSNorm8(const float* source, int8_t* destination, size_t count) { PackFloats(source, destination, count, PackedFormat::SNorm8); }
+		inline void ConvertSNorm8ToFloat(const int8_t* source, float* destination, size_t count) { UnpackFloats(source, destination, count, PackedFormat::SNorm8); }
+
+		inline void ConvertFloatToSNorm16(const float* source, int16_t* destination, size_t count) { PackFloats(source, destination, count, PackedFormat::SNorm16); }
+		inline void ConvertSNorm16ToFloat(const int16_t* source, float* destination, size_t count) { UnpackFloats(source, destination, count, PackedFormat::SNorm16); }
+
+		inline void ConvertFloatToUNorm8(const float* source, uint8_t* destination, size_t count) { PackFloats(source, destination, count, PackedFormat::UNorm8); }
+		inline void ConvertUNorm8ToFloat(const uint8_t* source, float* destination, size_t count) { UnpackFloats(source, destination, count, PackedFormat::UNorm8); }
+
+		inline void ConvertFloatToUNorm16(const float* source, uint16_t* destination, size_t count) { PackFloats(source, destination, count, PackedFormat::UNorm16); }
+		inline void ConvertUNorm16ToFloat(const uint16_t* source, float* destination, size_t count) { UnpackFloats(source, destination, count, PackedFormat::UNorm16); }
+	}
+}
+
+#endif // !PACKEDCONVERSION_H
@@ -0,0 +1,94 @@
+#include "QuaternionBatch.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace
+		{
+			// Quaternions transposed per block , 64 keeps the scratch streams inside a few KB of stack
+			inline static constexpr size_t PACKEDBLOCKSIZE = 64;
+
+			using BlendKernel = void (*)(const QuaternionSoA&, const QuaternionSoA&, const float*, float, const QuaternionSoA&, size_t);
+
+			struct PackedBlock
+			{
+				float x[PACKEDBLOCKSIZE];
+				float y[PACKEDBLOCKSIZE];
+				float z[PACKEDBLOCKSIZE];
+				float w[PACKEDBLOCKSIZE];
+
+				QuaternionSoA GetView() { return QuaternionSoA{ x, y, z, w }; }
+
+				void Deinterleave(const Quaternion* source, size_t count)
+				{
+					for (size_t index = 0; index < count; ++index)
+					{
+						x[index] = source[index].x;
+						y[index] = source[index].y;
+						z[index] = source[index].z;
+						w[index] = source[index].w;
+					}
+				}
+
+				void Interleave(Quaternion* destination, size_t count) const
+				{
+					for (size_t index = 0; index < count; ++index)
+					{
+						destination[index] = Quaternion(x[index], y[index], z[index], w[index]);
+					}
+				}
+			};
+
+			void BlendPacked(BlendKernel kernel, const Quaternion* from, const Quaternion* to, const float* weights, float weight, Quaternion* result, size_t count)
+			{
+				PackedBlock fromBlock;
+				PackedBlock toBlock;
+
+				for (size_t offset = 0; offset < count; offset += PACKEDBLOCKSIZE)
+				{
+					const size_t blockCount = count - offset < PACKEDBLOCKSIZE ? count - offset : PACKEDBLOCKSIZE;
+
+					fromBlock.Deinterleave(from + offset, blockCount);
+					toBlock.Deinterleave(to + offset, blockCount);
+
+					// The 'from' block doubles as the output , the kernels allow result to alias an input
+					kernel(fromBlock.GetView(), toBlock.GetView(), weights != nullptr ? weights + offset : nullptr, weight, fromBlock.GetView(), blockCount);
+
+					fromBlock.Interleave(result + offset, blockCount);
+				}
+			}
+		}
+
+		void NLerpBatch(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float weight, const QuaternionSoA& result, size_t count)
+		{
+			MathDispatch::GetKernels().NLerp(from, to, weights, weight, result, count);
+		}
+
+		void SlerpBatch(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float weight, const QuaternionSoA& result, size_t count)
+		{
+			MathDispatch::GetKernels().Slerp(from, to, weights, weight, result, count);
+		}
+
+		void SlerpApproxBatch(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float weight, const QuaternionSoA& result, size_t count)
+		{
+			MathDispatch::GetKernels().SlerpApprox(from, to, weights, weight, result, count);
+		}
+
+		void NLerpBatch(const Quaternion* from, const Quaternion* to, const float* weights, float weight, Quaternion* result, size_t count)
+		{
+			BlendPacked(MathDispatch::GetKernels().NLerp, from, to, weights, weight, result, count);
+		}
+
+		void SlerpBatch(const Quaternion* from, const Quaternion* to, const float* weights, float weight, Quaternion* result, size_t count)
+		{
+			BlendPacked(MathDispatch::GetKernels().Slerp, from, to, weights, weight, result, count);
+		}
+
+		void SlerpApproxBatch(const Quaternion* from, const Quaternion* to, const float* weights, float weight, Quaternion* result, size_t count)
+		{
+			BlendPacked(MathDispatch::GetKernels().SlerpApprox, from, to, weights, weight, result, count);
+		}
+	}
+}
@@ -0,0 +1,57 @@
+#ifndef QUATERNIONBATCH_H
+#define QUATERNIONBATCH_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cstddef>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Structure of arrays view over a stream of quaternions (one array per component).
+		/// The arrays don't need any alignment , a result stream may alias either input stream
+		/// </summary>
+		struct QuaternionSoA
+		{
+			float* x = nullptr;
+			float* y = nullptr;
+			float* z = nullptr;
+			float* w = nullptr;
+		};
+
+		/// <summary>
+		/// Max angle error of SlerpApproxBatch against an exact slerp (radians , for unit inputs).
+		/// Measured at 7.7e-4 (about 0.045 degrees) , SlerpBatch itself stays under 1e-6
+		/// </summary>
+		inline static constexpr float SLERPAPPROX_MAXERROR = 8.0e-4f;
+
+		// ================= STRUCTURE OF ARRAYS ======================
+		// weights == nullptr means every element uses 'weight'
+
+		/// <summary>
+		/// Normalized lerp along the shortest path for every pair of quaternions
+		/// </summary>
+		SNP_API void NLerpBatch(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float weight, const QuaternionSoA& result, size_t count);
+
+		/// <summary>
+		/// Spherical lerp along the shortest path for every pair (constant angular velocity , matches XMQuaternionSlerp)
+		/// </summary>
+		SNP_API void SlerpBatch(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float weight, const QuaternionSoA& result, size_t count);
+
+		/// <summary>
+		/// NLerp with a cubic correction of the weight , within SLERPAPPROX_MAXERROR of the exact slerp at nearly the cost of NLerp
+		/// </summary>
+		SNP_API void SlerpApproxBatch(const QuaternionSoA& from, const QuaternionSoA& to, const float* weights, float weight, const QuaternionSoA& result, size_t count);
+
+
+		// ================= PACKED (ARRAY OF QUATERNIONS) ======================
+		// Transposed to SoA in small blocks on the stack , result may alias either input
+
+		SNP_API void NLerpBatch(const Quaternion* from, const Quaternion* to, const float* weights, float weight, Quaternion* result, size_t count);
+		SNP_API void SlerpBatch(const Quaternion* from, const Quaternion* to, const float* weights, float weight, Quaternion* result, size_t count);
+		SNP_API void SlerpApproxBatch(const Quaternion* from, const Quaternion* to, const float* weights, float weight, Quaternion* result, size_t count);
+	}
+}
+
+#endif // !QUATERNIONBATCH_H
@@ -0,0 +1,225 @@
+#include "Random.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+#include "Utilities/Math/FastTrig.hpp"
+#include "Core/Jobs/JobSystem.hpp"
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		namespace
+		{
+			// Points staged on the stack per block when writing packed vectors
+			inline static constexpr size_t PACKEDBLOCKSIZE = 64;
+
+			uint64_t GetStreamMixer(uint64_t seed, uint64_t stream)
+			{
+				uint64_t streamState = stream;
+				return seed ^ RandomDetail::SplitMix64(streamState);
+			}
+
+			void FillWords(uint32_t (&words)[4], uint64_t& mixer)
+			{
+				// xoshiro must never start from an all zero state
+				do
+				{
+					const uint64_t first = RandomDetail::SplitMix64(mixer);
+					const uint64_t second = RandomDetail::SplitMix64(mixer);
+
+					words[0] = static_cast<uint32_t>(first);
+					words[1] = static_cast<uint32_t>(first >> 32);
+					words[2] = static_cast<uint32_t>(second);
+					words[3] = static_cast<uint32_t>(second >> 32);
+				}
+				while ((words[0] | words[1] | words[2] | words[3]) == 0);
+			}
+
+			template <typename Function>
+			void ParallelBlocks(uint64_t seed, size_t count, const Function& function)
+			{
+				Jobs::JobSystem::ParallelFor(count, RANDOM_PARALLELBLOCK, [&](size_t begin, size_t end)
+				{
+					for (size_t blockBegin = begin; blockBegin < end; blockBegin += RANDOM_PARALLELBLOCK)
+					{
+						const size_t blockEnd = end - blockBegin < RANDOM_PARALLELBLOCK ? end : blockBegin + RANDOM_PARALLELBLOCK;
+
+						RandomBatch batch(seed, blockBegin / RANDOM_PARALLELBLOCK);
+						function(batch, blockBegin, blockEnd);
+					}
+				});
+			}
+		}
+
+		void SeedRandomLanes(RandomLanes& lanes, uint64_t seed, uint64_t stream)
+		{
+			uint64_t mixer = GetStreamMixer(seed, stream);
+
+			for (uint32_t lane = 0; lane < RANDOMLANES; ++lane)
+			{
+				uint32_t words[4];
+				FillWords(words, mixer);
+
+				for (uint32_t word = 0; word < 4; ++word) { lanes.state[word][lane] = words[word]; }
+			}
+		}
+
+
+		// ===================== SCALAR GENERATOR =========================
+
+		RandomGenerator::RandomGenerator(uint64_t seed, uint64_t stream)
+		{
+			uint64_t mixer = GetStreamMixer(seed, stream);
+			FillWords(m_state, mixer);
+		}
+
+		int32_t RandomGenerator::Range(int32_t minimum, int32_t maximum)
+		{
+			if (maximum <= minimum) { return minimum; }
+
+			const uint32_t span = static_cast<uint32_t>(maximum) - static_cast<uint32_t>(minimum) + 1u;
+
+			// span wraps to 0 for the full 32 bit range
+			const uint32_t offset = span == 0 ? NextUInt() : NextBounded(span);
+			return static_cast<int32_t>(static_cast<uint32_t>(minimum) + offset);
+		}
+
+		uint32_t RandomGenerator::NextBounded(uint32_t bound)
+		{
+			// Lemire's multiply and reject
+			uint64_t product = static_cast<uint64_t>(NextUInt()) * bound;
+			uint32_t low = static_cast<uint32_t>(product);
+
+			if (low < bound)
+			{
+				const uint32_t threshold = (0u - bound) % bound;
+				while (low < threshold)
+				{
+					product = static_cast<uint64_t>(NextUInt()) * bound;
+					low = static_cast<uint32_t>(product);
+				}
+			}
+
+			return static_cast<uint32_t>(product >> 32);
+		}
+
+		float RandomGenerator::Gaussian(float mean, float deviation)
+		{
+			// 1 - u keeps the log argument in (0 , 1]
+			const float radius = std::sqrt(-2.0f * std::log(1.0f - NextFloat()));
+			const float angle = NextFloat() * RandomDetail::TWOPI;
+
+			return mean + deviation * radius * FastCos<TrigPrecision::Full>(angle);
+		}
+
+		Vector3 RandomGenerator::OnSphere(float radius)
+		{
+			const float z = 1.0f - 2.0f * NextFloat();
+			const float ring = std::sqrt(std::max(0.0f, 1.0f - z * z));
+
+			float sine, cosine;
+			FastSinCos<TrigPrecision::Full>(NextFloat() * RandomDetail::TWOPI, sine, cosine);
+
+			return Vector3(ring * cosine, ring * sine, z) * radius;
+		}
+
+		Vector2 RandomGenerator::InDisc(float radius)
+		{
+			const float distance = radius * std::sqrt(NextFloat());
+
+			float sine, cosine;
+			FastSinCos<TrigPrecision::Full>(NextFloat() * RandomDetail::TWOPI, sine, cosine);
+
+			return Vector2(distance * cosine, distance * sine);
+		}
+
+
+		// ===================== BATCH GENERATOR =========================
+
+		RandomBatch::RandomBatch(uint64_t seed, uint64_t stream)
+		{
+			SeedRandomLanes(m_lanes, seed, stream);
+		}
+
+		void RandomBatch::FillUInt(uint32_t* output, size_t count)
+		{
+			MathDispatch::GetKernels().RandomUInt(m_lanes, output, count);
+		}
+
+		void RandomBatch::FillFloat(float* output, size_t count, float minimum, float maximum)
+		{
+			MathDispatch::GetKernels().RandomFloat(m_lanes, output, count, minimum, maximum);
+		}
+
+		void RandomBatch::FillGaussian(float* output, size_t count, float mean, float deviation)
+		{
+			MathDispatch::GetKernels().RandomGaussian(m_lanes, output, count, mean, deviation);
+		}
+
+		void RandomBatch::FillOnSphere(float* x, float* y, float* z, size_t count, float radius)
+		{
+			MathDispatch::GetKernels().RandomOnSphere(m_lanes, x, y, z, count, radius);
+		}
+
+		void RandomBatch::FillOnSphere(Vector3* output, size_t count, float radius)
+		{
+			float x[PACKEDBLOCKSIZE];
+			float y[PACKEDBLOCKSIZE];
+			float z[PACKEDBLOCKSIZE];
+
+			for (size_t offset = 0; offset < count; offset += PACKEDBLOCKSIZE)
+			{
+				const size_t blockCount = count - offset < PACKEDBLOCKSIZE ? count - offset : PACKEDBLOCKSIZE;
+				FillOnSphere(x, y, z, blockCount, radius);
+
+				for (size_t index = 0; index < blockCount; ++index) { output[offset + index] = Vector3(x[index], y[index], z[index]); }
+			}
+		}
+
+		void RandomBatch::FillInDisc(float* x, float* y, size_t count, float radius)
+		{
+			MathDispatch::GetKernels().RandomInDisc(m_lanes, x, y, count, radius);
+		}
+
+		void RandomBatch::FillInDisc(Vector2* output, size_t count, float radius)
+		{
+			float x[PACKEDBLOCKSIZE];
+			float y[PACKEDBLOCKSIZE];
+
+			for (size_t offset = 0; offset < count; offset += PACKEDBLOCKSIZE)
+			{
+				const size_t blockCount = count - offset < PACKEDBLOCKSIZE ? count - offset : PACKEDBLOCKSIZE;
+				FillInDisc(x, y, blockCount, radius);
+
+				for (size_t index = 0; index < blockCount; ++index) { output[offset + index] = Vector2(x[index], y[index]); }
+			}
+		}
+
+
+		// ===================== PARALLEL FILLS =========================
+
+		void ParallelFillUInt(uint64_t seed, uint32_t* output, size_t count)
+		{
+			ParallelBlocks(seed, count, [&](RandomBatch& batch, size_t begin, size_t end) { batch.FillUInt(output + begin, end - begin); });
+		}
+
+		void ParallelFillFloat(uint64_t seed, float* output, size_t count, float minimum, float maximum)
+		{
+			ParallelBlocks(seed, count, [&](RandomBatch& batch, size_t begin, size_t end) { batch.FillFloat(output + begin, end - begin, minimum, maximum); });
+		}
+
+		void ParallelFillGaussian(uint64_t seed, float* output, size_t count, float mean, float deviation)
+		{
+			ParallelBlocks(seed, count, [&](RandomBatch& batch, size_t begin, size_t end) { batch.FillGaussian(output + begin, end - begin, mean, deviation); });
+		}
+
+		void ParallelFillOnSphere(uint64_t seed, Vector3* output, size_t count, float radius)
+		{
+			ParallelBlocks(seed, count, [&](RandomBatch& batch, size_t begin, size_t end) { batch.FillOnSphere(output + begin, end - begin, radius); });
+		}
+
+		void ParallelFillInDisc(uint64_t seed, Vector2* output, size_t count, float radius)
+		{
+			ParallelBlocks(seed, count, [&](RandomBatch& batch, size_t begin, size_t end) { batch.FillInDisc(output + begin, end - begin, radius); });
+		}
+	}
+}
@@ -0,0 +1,191 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		inline static constexpr uint64_t DEFAULTRANDOMSEED = 0x5A17AB1E5EED1234ull;
+
+		/// <summary>
+		/// Number of interleaved generators in a RandomLanes state (one AVX2 register)
+		/// </summary>
+		inline static constexpr uint32_t RANDOMLANES = 8;
+
+		/// <summary>
+		/// Elements per independently seeded block in the ParallelFill functions.
+		/// Block b always uses stream b , which is what keeps the results independent of the thread count
+		/// </summary>
+		inline static constexpr size_t RANDOM_PARALLELBLOCK = 4096;
+
+		namespace RandomDetail
+		{
+			// 2^-24 , turns the top 24 bits of a draw into an exact float in [0 , 1)
+			inline static constexpr float UNITSCALE = 1.0f / 16777216.0f;
+			inline static constexpr float TWOPI = 6.28318530717958647f;
+
+			// Cephes logf : log(1 + x) = x - x^2 / 2 + x^3 * P(x) , for x in [sqrt(1/2) - 1 , sqrt(2) - 1]
+			inline static constexpr float LOG[] = { 3.3333331174e-01f, -2.4999993993e-01f, 2.0000714765e-01f, -1.6668057665e-01f, 1.4249322787e-01f, -1.2420140846e-01f, 1.1676998740e-01f, -1.1514610310e-01f, 7.0376836292e-02f };
+			inline static constexpr float LOGHIGH = 0.693359375f;
+			inline static constexpr float LOGLOW = -2.12194440e-4f;
+			inline static constexpr float SQRTHALF = 0.707106781186547524f;
+
+			/// <summary>
+			/// SplitMix64 step , used to expand (seed , stream) pairs into full generator states
+			/// </summary>
+			inline uint64_t SplitMix64(uint64_t& state)
+			{
+				uint64_t value = (state += 0x9E3779B97F4A7C15ull);
+				value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+				value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+				return value ^ (value >> 31);
+			}
+
+			inline uint32_t RotateLeft(uint32_t value, int shift)
+			{
+				return (value << shift) | (value >> (32 - shift));
+			}
+		}
+
+		/// <summary>
+		/// State of RANDOMLANES interleaved xoshiro128** generators , stored word major (state[word][lane])
+		/// </summary>
+		struct alignas(32) RandomLanes
+		{
+			uint32_t state[4][RANDOMLANES];
+		};
+
+		/// <summary>
+		/// Seeds every lane from (seed , stream). Different streams of the same seed are statistically independent
+		/// </summary>
+		SNP_API void SeedRandomLanes(RandomLanes& lanes, uint64_t seed, uint64_t stream);
+
+
+		// ===================== SCALAR GENERATOR =========================
+
+		/// <summary>
+		/// xoshiro128** , small and fast general purpose generator (not for cryptography).
+		/// Inside jobs , seed with the job / slice index as the stream , never with the thread index
+		/// </summary>
+		class SNP_API RandomGenerator
+		{
+		public:
+
+			explicit RandomGenerator(uint64_t seed = DEFAULTRANDOMSEED, uint64_t stream = 0);
+
+			/// <summary>
+			/// Uniform 32 bit value
+			/// </summary>
+			inline uint32_t NextUInt()
+			{
+				using RandomDetail::RotateLeft;
+
+				const uint32_t result = RotateLeft(m_state[1] * 5, 7) * 9;
+				const uint32_t shifted = m_state[1] << 9;
+
+				m_state[2] ^= m_state[0];
+				m_state[3] ^= m_state[1];
+				m_state[1] ^= m_state[2];
+				m_state[0] ^= m_state[3];
+				m_state[2] ^= shifted;
+				m_state[3] = RotateLeft(m_state[3], 11);
+
+				return result;
+			}
+
+			/// <summary>
+			/// Uniform float in [0 , 1)
+			/// </summary>
+			inline float NextFloat()
+			{
+				return static_cast<float>(NextUInt() >> 8) * RandomDetail::UNITSCALE;
+			}
+
+			/// <summary>
+			/// Uniform float in [minimum , maximum) (float rounding can still land exactly on maximum for wide ranges)
+			/// </summary>
+			inline float Range(float minimum, float maximum)
+			{
+				return minimum + NextFloat() * (maximum - minimum);
+			}
+
+			/// <summary>
+			/// Uniform integer in [minimum , maximum] (both inclusive)
+			/// </summary>
+			int32_t Range(int32_t minimum, int32_t maximum);
+
+			/// <summary>
+			/// Unbiased uniform integer in [0 , bound) , bound must be non zero
+			/// </summary>
+			uint32_t NextBounded(uint32_t bound);
+
+			/// <summary>
+			/// Normal distribution sample (Box-Muller)
+			/// </summary>
+			float Gaussian(float mean = 0.0f, float deviation = 1.0f);
+
+			/// <summary>
+			/// Uniform point on the surface of a sphere around the origin
+			/// </summary>
+			Vector3 OnSphere(float radius = 1.0f);
+
+			/// <summary>
+			/// Uniform point inside a disc around the origin
+			/// </summary>
+			Vector2 InDisc(float radius = 1.0f);
+
+		private:
+
+			uint32_t m_state[4];
+		};
+
+
+		// ===================== BATCH GENERATOR =========================
+
+		/// <summary>
+		/// 8 lane generator for filling arrays through the SIMD kernels.
+		/// Output i of a fill comes from lane (i % 8) , so raw bits and [0 , 1) floats are bit identical on every SIMD tier.
+		/// Shaped samples (range , Gaussian , sphere , disc) may differ in the last ulp between tiers (FMA) ,
+		/// never between runs on the same tier
+		/// </summary>
+		class SNP_API RandomBatch
+		{
+		public:
+
+			explicit RandomBatch(uint64_t seed = DEFAULTRANDOMSEED, uint64_t stream = 0);
+
+			void FillUInt(uint32_t* output, size_t count);
+			void FillFloat(float* output, size_t count, float minimum = 0.0f, float maximum = 1.0f);
+			void FillGaussian(float* output, size_t count, float mean = 0.0f, float deviation = 1.0f);
+
+			void FillOnSphere(float* x, float* y, float* z, size_t count, float radius = 1.0f);
+			void FillOnSphere(Vector3* output, size_t count, float radius = 1.0f);
+
+			void FillInDisc(float* x, float* y, size_t count, float radius = 1.0f);
+			void FillInDisc(Vector2* output, size_t count, float radius = 1.0f);
+
+			RandomLanes& GetLanes() { return m_lanes; }
+
+		private:
+
+			RandomLanes m_lanes;
+		};
+
+
+		// ===================== PARALLEL FILLS =========================
+		// Split into RANDOM_PARALLELBLOCK sized blocks across the job system , block b is generated by RandomBatch(seed , b).
+		// The output only depends on the seed and the count (a fill that fits in one block equals RandomBatch(seed , 0))
+
+		SNP_API void ParallelFillUInt(uint64_t seed, uint32_t* output, size_t count);
+		SNP_API void ParallelFillFloat(uint64_t seed, float* output, size_t count, float minimum = 0.0f, float maximum = 1.0f);
+		SNP_API void ParallelFillGaussian(uint64_t seed, float* output, size_t count, float mean = 0.0f, float deviation = 1.0f);
+		SNP_API void ParallelFillOnSphere(uint64_t seed, Vector3* output, size_t count, float radius = 1.0f);
+		SNP_API void ParallelFillInDisc(uint64_t seed, Vector2* output, size_t count, float radius = 1.0f);
+	}
+}
+
+#endif // !RANDOM_H
@@ -0,0 +1,15 @@
+#include "TransformBatch.hpp"
+#include "Utilities/Math/MathDispatch.hpp"
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		void InterpolateTransformBatch(const TransformSoA& previous, const TransformSoA& current, float alpha, Matrix* result, size_t count)
+		{
+			static_assert(sizeof(Matrix) == 16 * sizeof(float), "The kernels write matrices as 16 packed floats");
+
+			MathDispatch::GetKernels().InterpolateTransforms(previous, current, alpha, reinterpret_cast<float*>(result), count);
+		}
+	}
+}
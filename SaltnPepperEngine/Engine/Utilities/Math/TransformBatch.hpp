@@ -0,0 +1,30 @@
+#ifndef TRANSFORMBATCH_H
+#define TRANSFORMBATCH_H
+#include "Core/EngineDefines.hpp"
+#include "Utilities/Math/MathDefinitions.hpp"
+#include <cstddef>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// Structure of arrays view over a stream of position / rotation / scale triples (one array per component : x , y , z (, w)).
+		/// The arrays don't need any alignment
+		/// </summary>
+		struct TransformSoA
+		{
+			float* position[3] = {};
+			float* rotation[4] = {};
+			float* scale[3] = {};
+		};
+
+		/// <summary>
+		/// Blends every pair of transforms by alpha (lerped position and scale , shortest path nlerp of the rotation) and writes
+		/// the S * R * T world matrices into result. Matches XMMatrixAffineTransformation of the blended TRS to float precision
+		/// </summary>
+		SNP_API void InterpolateTransformBatch(const TransformSoA& previous, const TransformSoA& current, float alpha, Matrix* result, size_t count);
+	}
+}
+
+#endif // !TRANSFORMBATCH_H
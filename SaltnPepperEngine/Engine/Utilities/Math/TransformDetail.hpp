@@ -0,0 +1,138 @@
+#ifndef TRANSFORMDETAIL_H
+#define TRANSFORMDETAIL_H
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SaltnPepperEngine
+{
+	namespace Math
+	{
+		/// <summary>
+		/// The transform interpolation kernel written once against a lane type , instantiated by each MathKernels<Tier>.cpp.
+		/// A lane type provides Float , WIDTH and : Set , Load , Add , Sub , Mul , MulAdd (a * b + c) , Div , SignBit (a & -0.0f) , Xor
+		/// and StoreMatrices (WIDTH row major 4x4 matrices from 16 registers that each hold one element for every lane)
+		/// </summary>
+		namespace TransformDetail
+		{
+			// Stream order in the arrays below : position x , y , z , rotation x , y , z , w , scale x , y , z
+			inline static constexpr size_t STREAMCOUNT = 10;
+
+			// Identity TRS , pads the unused lanes of the tail
+			inline static constexpr float IDENTITY[STREAMCOUNT] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+
+			/// <summary>
+			/// Lerps WIDTH transforms , the rotation along the shortest path , and writes their S * R * T world matrices
+			/// (DirectX row vector layout : scaled basis in rows 0 - 2 , position in row 3).
+			/// The nlerp result isn't renormalized , the matrix build divides by its squared length instead , which comes out exact
+			/// for any non zero quaternion at the price of one division
+			/// </summary>
+			template <typename L>
+			inline void InterpolateLanes(const typename L::Float (&previous)[STREAMCOUNT], const typename L::Float (&current)[STREAMCOUNT], typename L::Float alpha, float* output)
+			{
+				using Float = typename L::Float;
+
+				const Float one = L::Set(1.0f);
+				const Float zero = L::Set(0.0f);
+
+				// Flip the current rotation wherever the pair lies in opposite hemispheres
+				Float dot = L::Mul(previous[3], current[3]);
+				dot = L::MulAdd(previous[4], current[4], dot);
+				dot = L::MulAdd(previous[5], current[5], dot);
+				dot = L::MulAdd(previous[6], current[6], dot);
+				const Float sign = L::SignBit(dot);
+
+				Float blended[STREAMCOUNT];
+				for (size_t stream = 0; stream < STREAMCOUNT; ++stream)
+				{
+					const Float target = stream >= 3 && stream < 7 ? L::Xor(current[stream], sign) : current[stream];
+					blended[stream] = L::MulAdd(L::Sub(target, previous[stream]), alpha, previous[stream]);
+				}
+
+				const Float x = blended[3], y = blended[4], z = blended[5], w = blended[6];
+
+				const Float lengthSq = L::MulAdd(w, w, L::MulAdd(z, z, L::MulAdd(y, y, L::Mul(x, x))));
+				const Float scale = L::Div(L::Set(2.0f), lengthSq);
+
+				const Float xs = L::Mul(x, scale), ys = L::Mul(y, scale), zs = L::Mul(z, scale);
+				const Float xx = L::Mul(x, xs), yy = L::Mul(y, ys), zz = L::Mul(z, zs);
+				const Float xy = L::Mul(x, ys), xz = L::Mul(x, zs), yz = L::Mul(y, zs);
+				const Float wx = L::Mul(w, xs), wy = L::Mul(w, ys), wz = L::Mul(w, zs);
+
+				const Float scaleX = blended[7], scaleY = blended[8], scaleZ = blended[9];
+
+				Float elements[16];
+				elements[0] = L::Mul(L::Sub(one, L::Add(yy, zz)), scaleX);
+				elements[1] = L::Mul(L::Add(xy, wz), scaleX);
+				elements[2] = L::Mul(L::Sub(xz, wy), scaleX);
+				elements[3] = zero;
+
+				elements[4] = L::Mul(L::Sub(xy, wz), scaleY);
+				elements[5] = L::Mul(L::Sub(one, L::Add(xx, zz)), scaleY);
+				elements[6] = L::Mul(L::Add(yz, wx), scaleY);
+				elements[7] = zero;
+
+				elements[8] = L::Mul(L::Add(xz, wy), scaleZ);
+				elements[9] = L::Mul(L::Sub(yz, wx), scaleZ);
+				elements[10] = L::Mul(L::Sub(one, L::Add(xx, yy)), scaleZ);
+				elements[11] = zero;
+
+				elements[12] = blended[0];
+				elements[13] = blended[1];
+				elements[14] = blended[2];
+				elements[15] = one;
+
+				L::StoreMatrices(output, elements);
+			}
+
+			/// <summary>
+			/// Interpolates count transforms into count row major matrices (16 floats each). The last partial block is staged
+			/// through the stack with identity padding , so nothing past the streams or the output is touched
+			/// </summary>
+			template <typename L>
+			void Interpolate(const float* const (&previous)[STREAMCOUNT], const float* const (&current)[STREAMCOUNT], float alpha, float* output, size_t count)
+			{
+				using Float = typename L::Float;
+
+				const Float weight = L::Set(alpha);
+				Float previousLanes[STREAMCOUNT];
+				Float currentLanes[STREAMCOUNT];
+
+				size_t index = 0;
+				for (; index + L::WIDTH <= count; index += L::WIDTH)
+				{
+					for (size_t stream = 0; stream < STREAMCOUNT; ++stream)
+					{
+						previousLanes[stream] = L::Load(previous[stream] + index);
+						currentLanes[stream] = L::Load(current[stream] + index);
+					}
+
+					InterpolateLanes<L>(previousLanes, currentLanes, weight, output + index * 16);
+				}
+
+				if (index == count) { return; }
+
+				const size_t remaining = count - index;
+				for (size_t stream = 0; stream < STREAMCOUNT; ++stream)
+				{
+					float stagedPrevious[L::WIDTH];
+					float stagedCurrent[L::WIDTH];
+					for (size_t lane = 0; lane < L::WIDTH; ++lane)
+					{
+						stagedPrevious[lane] = lane < remaining ? previous[stream][index + lane] : IDENTITY[stream];
+						stagedCurrent[lane] = lane < remaining ? current[stream][index + lane] : IDENTITY[stream];
+					}
+
+					previousLanes[stream] = L::Load(stagedPrevious);
+					currentLanes[stream] = L::Load(stagedCurrent);
+				}
+
+				float staged[L::WIDTH * 16];
+				InterpolateLanes<L>(previousLanes, currentLanes, weight, staged);
+				std::memcpy(output + index * 16, staged, remaining * 16 * sizeof(float));
+			}
+		}
+	}
+}
+
+#endif // !TRANSFORMDETAIL_H
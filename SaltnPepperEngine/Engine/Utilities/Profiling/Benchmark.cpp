@@ -0,0 +1,216 @@
+#include "Benchmark.hpp"
+#include "Utilities/Time/Timer.hpp"
+#include "Utilities/Logging/Log.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace SaltnPepperEngine
+{
+	namespace Profiling
+	{
+		namespace
+		{
+			// Upper limit for the calibration , keeps a case whose body got optimised away from looping forever
+			inline static constexpr uint64_t MAXITERATIONS = uint64_t{ 1 } << 40;
+
+			double TimeIterations(const BenchmarkFunction& function, uint64_t iterations)
+			{
+				const TimeStamp start = Timer::Now();
+				function(iterations);
+				const TimeStamp end = Timer::Now();
+
+				return std::chrono::duration<double>(end - start).count();
+			}
+
+			// Nearest rank percentile of sorted values
+			double Percentile(const std::vector<double>& sorted, double fraction)
+			{
+				const size_t rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+				return sorted[rank > 0 ? rank - 1 : 0];
+			}
+
+			void AppendEscaped(std::string& output, std::string_view text)
+			{
+				output += '"';
+
+				for (const char character : text)
+				{
+					switch (character)
+					{
+					case '"': output += "\\\""; break;
+					case '\\': output += "\\\\"; break;
+					case '\n': output += "\\n"; break;
+					case '\t': output += "\\t"; break;
+					default:
+						if (static_cast<unsigned char>(character) < 0x20)
+						{
+							char escaped[8];
+							std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(character));
+							output += escaped;
+						}
+						else
+						{
+							output += character;
+						}
+						break;
+					}
+				}
+
+				output += '"';
+			}
+
+			void AppendNumber(std::string& output, double value)
+			{
+				char buffer[32];
+				std::snprintf(buffer, sizeof(buffer), "%.4f", value);
+				output += buffer;
+			}
+		}
+
+		BenchmarkSuite::BenchmarkSuite(const BenchmarkSettings& settings)
+			: m_settings(settings)
+		{
+			m_settings.samples = std::max<uint32_t>(m_settings.samples, 1);
+		}
+
+		void BenchmarkSuite::Add(std::string_view group, std::string_view name, std::string_view variant, uint64_t operationsPerIteration, BenchmarkFunction function)
+		{
+			BenchmarkCase benchmark;
+			benchmark.group = group;
+			benchmark.name = name;
+			benchmark.variant = variant;
+			benchmark.operationsPerIteration = std::max<uint64_t>(operationsPerIteration, 1);
+			benchmark.function = std::move(function);
+
+			m_cases.push_back(std::move(benchmark));
+		}
+
+		void BenchmarkSuite::Run(std::string_view filter)
+		{
+			m_results.clear();
+
+			for (const BenchmarkCase& benchmark : m_cases)
+			{
+				const std::string id = benchmark.group + "/" + benchmark.name + "/" + benchmark.variant;
+				if (!filter.empty() && id.find(filter) == std::string::npos) { continue; }
+
+				m_results.push_back(Measure(benchmark));
+
+				const BenchmarkResult& result = m_results.back();
+				LOG_INFO("{0} : median {1:.3f} ns , p90 {2:.3f} ns , p99 {3:.3f} ns", id, result.median, result.p90, result.p99);
+			}
+		}
+
+		void BenchmarkSuite::SetMetadata(std::string_view key, std::string_view value)
+		{
+			for (auto& entry : m_metadata)
+			{
+				if (entry.first == key)
+				{
+					entry.second = value;
+					return;
+				}
+			}
+
+			m_metadata.emplace_back(std::string(key), std::string(value));
+		}
+
+		BenchmarkResult BenchmarkSuite::Measure(const BenchmarkCase& benchmark) const
+		{
+			// Double the iteration count until a single sample is long enough for the clock resolution
+			uint64_t iterations = 1;
+			while (iterations < MAXITERATIONS && TimeIterations(benchmark.function, iterations) < m_settings.minSampleSeconds)
+			{
+				iterations *= 2;
+			}
+
+			for (uint32_t warmup = 0; warmup < m_settings.warmupSamples; ++warmup)
+			{
+				benchmark.function(iterations);
+			}
+
+			const double operations = static_cast<double>(iterations * benchmark.operationsPerIteration);
+
+			std::vector<double> timings(m_settings.samples);
+			for (double& timing : timings)
+			{
+				timing = TimeIterations(benchmark.function, iterations) * 1.0e9 / operations;
+			}
+
+			std::sort(timings.begin(), timings.end());
+
+			BenchmarkResult result;
+			result.group = benchmark.group;
+			result.name = benchmark.name;
+			result.variant = benchmark.variant;
+			result.operationsPerSample = iterations * benchmark.operationsPerIteration;
+			result.samples = m_settings.samples;
+
+			double total = 0.0;
+			for (const double timing : timings) { total += timing; }
+
+			result.mean = total / static_cast<double>(timings.size());
+			result.median = Percentile(timings, 0.5);
+			result.p90 = Percentile(timings, 0.9);
+			result.p99 = Percentile(timings, 0.99);
+			result.minimum = timings.front();
+			result.maximum = timings.back();
+
+			return result;
+		}
+
+		std::string BenchmarkSuite::ToJson() const
+		{
+			std::string output = "{\n  \"metadata\": {";
+
+			for (size_t index = 0; index < m_metadata.size(); ++index)
+			{
+				output += index == 0 ? "\n    " : ",\n    ";
+				AppendEscaped(output, m_metadata[index].first);
+				output += ": ";
+				AppendEscaped(output, m_metadata[index].second);
+			}
+
+			output += m_metadata.empty() ? "},\n" : "\n  },\n";
+			output += "  \"unit\": \"ns/op\",\n  \"results\": [";
+
+			for (size_t index = 0; index < m_results.size(); ++index)
+			{
+				const BenchmarkResult& result = m_results[index];
+
+				output += index == 0 ? "\n    { " : ",\n    { ";
+				output += "\"group\": "; AppendEscaped(output, result.group);
+				output += ", \"name\": "; AppendEscaped(output, result.name);
+				output += ", \"variant\": "; AppendEscaped(output, result.variant);
+				output += ", \"operations\": " + std::to_string(result.operationsPerSample);
+				output += ", \"samples\": " + std::to_string(result.samples);
+				output += ", \"mean\": "; AppendNumber(output, result.mean);
+				output += ", \"median\": "; AppendNumber(output, result.median);
+				output += ", \"p90\": "; AppendNumber(output, result.p90);
+				output += ", \"p99\": "; AppendNumber(output, result.p99);
+				output += ", \"min\": "; AppendNumber(output, result.minimum);
+				output += ", \"max\": "; AppendNumber(output, result.maximum);
+				output += " }";
+			}
+
+			output += m_results.empty() ? "]\n}\n" : "\n  ]\n}\n";
+			return output;
+		}
+
+		bool BenchmarkSuite::WriteJson(const std::string& path) const
+		{
+			std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+			if (!file.is_open())
+			{
+				LOG_ERROR("Benchmark : could not open {0} for writing", path);
+				return false;
+			}
+
+			file << ToJson();
+			return file.good();
+		}
+	}
+}
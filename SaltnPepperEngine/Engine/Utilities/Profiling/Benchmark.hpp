@@ -0,0 +1,118 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+#include "Core/EngineDefines.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace SaltnPepperEngine
+{
+	namespace Profiling
+	{
+		struct BenchmarkSettings
+		{
+			// Untimed samples run before measuring (caches , branch predictors , turbo)
+			uint32_t warmupSamples = 3;
+
+			// Timed samples per case , the percentiles are taken over these
+			uint32_t samples = 31;
+
+			// Iterations per sample are doubled until one sample takes at least this long
+			double minSampleSeconds = 0.002;
+		};
+
+		/// <summary>
+		/// Per operation timings of one case , all in nanoseconds
+		/// </summary>
+		struct BenchmarkResult
+		{
+			std::string group;
+			std::string name;
+			std::string variant;
+
+			uint64_t operationsPerSample = 0;
+			uint32_t samples = 0;
+
+			double mean = 0.0;
+			double median = 0.0;
+			double p90 = 0.0;
+			double p99 = 0.0;
+			double minimum = 0.0;
+			double maximum = 0.0;
+		};
+
+		/// <summary>
+		/// Runs the case body 'iterations' times , every iteration counts as operationsPerIteration operations
+		/// </summary>
+		using BenchmarkFunction = std::function<void(uint64_t iterations)>;
+
+		/// <summary>
+		/// Keeps the compiler from dropping a computation whose result is otherwise unused
+		/// </summary>
+		template <typename Type>
+		inline void KeepAlive(const Type& value)
+		{
+#if defined(_MSC_VER)
+			const volatile char* volatile sink = &reinterpret_cast<const volatile char&>(value);
+			(void)sink;
+			_ReadWriteBarrier();
+#else
+			asm volatile("" : : "r"(&value) : "memory");
+#endif
+		}
+
+		/// <summary>
+		/// Collects benchmark cases , times them and writes the results as JSON for tracking across commits.
+		/// Cases are identified by group / name / variant (for example "Vector3" / "Length" / "DirectXMath")
+		/// </summary>
+		class SNP_API BenchmarkSuite
+		{
+		public:
+
+			explicit BenchmarkSuite(const BenchmarkSettings& settings = BenchmarkSettings{});
+
+			void Add(std::string_view group, std::string_view name, std::string_view variant, uint64_t operationsPerIteration, BenchmarkFunction function);
+
+			/// <summary>
+			/// Runs every case whose "group/name/variant" id contains filter (all of them for an empty filter)
+			/// </summary>
+			void Run(std::string_view filter = {});
+
+			const std::vector<BenchmarkResult>& GetResults() const { return m_results; }
+
+			/// <summary>
+			/// Free form key / value pairs written to the JSON header (commit , machine , SIMD tier ...)
+			/// </summary>
+			void SetMetadata(std::string_view key, std::string_view value);
+
+			std::string ToJson() const;
+			bool WriteJson(const std::string& path) const;
+
+		private:
+
+			struct BenchmarkCase
+			{
+				std::string group;
+				std::string name;
+				std::string variant;
+				uint64_t operationsPerIteration = 1;
+				BenchmarkFunction function;
+			};
+
+			BenchmarkResult Measure(const BenchmarkCase& benchmark) const;
+
+			BenchmarkSettings m_settings;
+			std::vector<BenchmarkCase> m_cases;
+			std::vector<BenchmarkResult> m_results;
+			std::vector<std::pair<std::string, std::string>> m_metadata;
+		};
+	}
+}
+
+#endif // !BENCHMARK_H